@@ -56,12 +56,14 @@ public:
     {
         toType = IFactoryNS::kUnknown;
         force = false;
+        index = false;
     }
 
     std::vector<std::string>    inFiles;
     std::string                 outFile;
     IFactoryNS::CoreType        toType;
     bool                        force;
+    bool                        index;
 };
 
 void copyProps(Alembic::Abc::ICompoundProperty & iRead,
@@ -83,6 +85,13 @@ void copyProps(Alembic::Abc::ICompoundProperty & iRead,
 
             for (std::size_t j = 0; j < numSamples; ++j)
             {
+                // Ogawa to Ogawa the stored sample can be copied as is
+                if (outProp.copySample(inProp.getPtr(),
+                                       (Alembic::Abc::index_t) j))
+                {
+                    continue;
+                }
+
                 Alembic::AbcCoreAbstract::ArraySamplePtr samp;
                 Alembic::Abc::ISampleSelector sel(
                     (Alembic::Abc::index_t) j);
@@ -177,7 +186,10 @@ void displayHelp()
     printf ("be printed out.\n");
     printf ("OPTION has to be one of these:\n\n");
     printf ("  -toHDF   Convert to HDF.\n");
-    printf ("  -toOgawa Convert to Ogawa.\n");
+    printf ("  -toOgawa Convert to Ogawa.\n\n");
+    printf ("  -index   With -toOgawa, also write an index of the object\n");
+    printf ("           hierarchy so readers can find objects by path\n");
+    printf ("           without walking down to them.\n");
 }
 
 bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDoConversion )
@@ -206,6 +218,10 @@ bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDo
                 {
                     oOptions.force = true;
                 }
+                else if(arg == "-index")
+                {
+                    oOptions.index = true;
+                }
                 else if(arg == "-in" )
                 {
                     argMode = kInFiles;
@@ -319,7 +335,7 @@ int main(int argc, char *argv[])
                        options.inFiles.begin()->c_str());
                 return 1;
             }
-            else if ( !options.force && (
+            else if ( !options.force && !options.index && (
                 (coreType == IFactoryNS::kHDF5 &&
                  options.toType == IFactoryNS::kHDF5) ||
                 (coreType == IFactoryNS::kOgawa &&
@@ -347,8 +363,9 @@ int main(int argc, char *argv[])
         }
         else if (options.toType == IFactoryNS::kOgawa)
         {
-            outArchive = Alembic::Abc::OArchive(
-                Alembic::AbcCoreOgawa::WriteArchive(),
+            Alembic::AbcCoreOgawa::WriteArchive writer;
+            writer.setHierarchyIndex(options.index);
+            outArchive = Alembic::Abc::OArchive(writer,
                 options.outFile, inTop.getMetaData(),
                 Alembic::Abc::ErrorHandler::kThrowPolicy);
         }
@@ -37,100 +37,14 @@
 #include <Alembic/AbcGeom/All.h>
 #include <Alembic/AbcCoreFactory/All.h>
 
-#include <Imath/ImathBoxAlgo.h>
-
 #include <iostream>
 
 //-*****************************************************************************
 using namespace ::Alembic::AbcGeom;
 
-static Box3d g_bounds;
-
 //-*****************************************************************************
-void accumXform( M44d &xf, IObject obj, chrono_t seconds )
-{
-    if ( IXform::matches( obj.getHeader() ) )
-    {
-        IXform x( obj );
-        XformSample xs;
-        ISampleSelector sel( seconds );
-        x.getSchema().get( xs, sel );
-        xf *= xs.getMatrix();
-    }
-}
-
-//-*****************************************************************************
-M44d getFinalMatrix( IObject &iObj, chrono_t seconds )
-{
-    M44d xf;
-    xf.makeIdentity();
-
-    IObject parent = iObj.getParent();
-
-    while ( parent )
-    {
-        accumXform( xf, parent, seconds );
-        parent = parent.getParent();
-    }
-
-    return xf;
-}
-
-//-*****************************************************************************
-Box3d getBounds( IObject iObj, chrono_t seconds )
-{
-    Box3d bnds;
-    bnds.makeEmpty();
-
-    M44d xf = getFinalMatrix( iObj, seconds );
-    IBox3dProperty boxProp;
-
-    if ( ICurves::matches( iObj.getMetaData() ) )
-    {
-        ICurves curves( iObj );
-        ICurvesSchema cs = curves.getSchema();
-        boxProp = cs.getSelfBoundsProperty();
-    }
-    else if ( INuPatch::matches( iObj.getMetaData() ) )
-    {
-        INuPatch patch( iObj );
-        INuPatchSchema ps = patch.getSchema();
-        boxProp = ps.getSelfBoundsProperty();
-    }
-    else if ( IPolyMesh::matches( iObj.getMetaData() ) )
-    {
-        IPolyMesh mesh( iObj );
-        IPolyMeshSchema ms = mesh.getSchema();
-        boxProp = ms.getSelfBoundsProperty();
-    }
-    else if ( IPoints::matches( iObj.getMetaData() ) )
-    {
-        IPoints pts( iObj );
-        IPointsSchema ps = pts.getSchema();
-        boxProp = ps.getSelfBoundsProperty();
-    }
-    else if ( ISubD::matches( iObj.getMetaData() ) )
-    {
-        ISubD mesh( iObj );
-        ISubDSchema ms = mesh.getSchema();
-        boxProp = ms.getSelfBoundsProperty();
-    }
-
-    if ( boxProp.valid() )
-    {
-        ISampleSelector sel( seconds );
-        bnds = boxProp.getValue( sel );
-        bnds = Imath::transform( bnds, xf );
-        g_bounds.extendBy( bnds );
-    }
-
-    g_bounds.extendBy( bnds );
-
-    return bnds;
-}
-
-//-*****************************************************************************
-void visitObject( IObject iObj, chrono_t seconds )
+void visitObject( IObject iObj, const BoundsHierarchy & iHier,
+                  const BoundsHierarchySample & iBounds )
 {
     std::string path = iObj.getFullName();
 
@@ -142,7 +56,14 @@ void visitObject( IObject iObj, chrono_t seconds )
         IPolyMesh::matches( md ) ||
         ISubDSchema::matches( md ) )
     {
-        Box3d bnds = getBounds( iObj, seconds );
+        Box3d bnds;
+        bnds.makeEmpty();
+
+        std::size_t index = iHier.find( path );
+        if ( index != BoundsHierarchy::NO_OBJECT )
+        {
+            bnds = iBounds.getSelfBounds( index );
+        }
         std::cout << path << " " << bnds.min << " " << bnds.max << std::endl;
     }
 
@@ -150,7 +71,7 @@ void visitObject( IObject iObj, chrono_t seconds )
     for ( size_t i = 0 ; i < iObj.getNumChildren() ; i++ )
     {
         visitObject( IObject( iObj, iObj.getChildHeader( i ).getName() ),
-                     seconds );
+                     iHier, iBounds );
     }
 }
 
@@ -175,7 +96,7 @@ int main( int argc, char *argv[] )
     }
 
     // Scoped.
-    g_bounds.makeEmpty();
+    Box3d bounds;
     {
         Alembic::AbcCoreFactory::IFactory factory;
         factory.setPolicy(ErrorHandler::kQuietNoopPolicy);
@@ -186,10 +107,14 @@ int main( int argc, char *argv[] )
             exit( -1 );
         }
 
-        visitObject( archive.getTop(), seconds );
+        // every object's bounds are wanted, so .childBnds can't be used
+        BoundsHierarchy hier( archive, false, 0 );
+        BoundsHierarchySamplePtr samp = hier.get( ISampleSelector( seconds ) );
+        visitObject( archive.getTop(), hier, *samp );
+        bounds = samp->getArchiveBounds();
     }
 
-    std::cout << "/" << " " << g_bounds.min << " " << g_bounds.max << std::endl;
+    std::cout << "/" << " " << bounds.min << " " << bounds.max << std::endl;
 
     return 0;
 }
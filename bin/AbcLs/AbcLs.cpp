@@ -174,20 +174,28 @@ void printParent( Abc::ICompoundProperty iProp,
 }
 
 //-*****************************************************************************
-void printParent( AbcG::IObject iObj,
-                  bool all = false,
+void printParent( const std::string & iFullName,
                   bool long_list = false,
-                  bool recursive = false,
                   bool first = false )
 {
     if ( !first && !long_list )
         std::cout << std::endl;
     std::cout << CYANCOLOR
-              << iObj.getFullName() << ":"
+              << iFullName << ":"
               << RESETCOLOR
               << std::endl;
 }
 
+//-*****************************************************************************
+void printParent( AbcG::IObject iObj,
+                  bool all = false,
+                  bool long_list = false,
+                  bool recursive = false,
+                  bool first = false )
+{
+    printParent( iObj.getFullName(), long_list, first );
+}
+
 //-*****************************************************************************
 void printMetaData( AbcA::MetaData md, bool all = false,
                     bool long_list = false )
@@ -483,12 +491,11 @@ void printChild( Abc::ICompoundProperty iParent, Abc::PropertyHeader header,
 }
 
 //-*****************************************************************************
-void printChild( AbcG::IObject iParent, AbcG::IObject iObj,
-                 bool all = false, bool long_list = false, bool meta = false,
-                 bool values = false )
+void printChild( const AbcA::ObjectHeader & iHeader,
+                 bool all = false, bool long_list = false, bool meta = false )
 {
 
-    AbcA::MetaData md = iObj.getMetaData();
+    const AbcA::MetaData & md = iHeader.getMetaData();
 
     if ( long_list ) {
         std::string schema = md.get( "schema" );
@@ -502,7 +509,7 @@ void printChild( AbcG::IObject iParent, AbcG::IObject iObj,
             std::cout << schema;
 
     }
-    std::cout << GREENCOLOR << iObj.getName();
+    std::cout << GREENCOLOR << iHeader.getName();
 
     if ( meta )
          printMetaData( md, all, long_list );
@@ -515,6 +522,14 @@ void printChild( AbcG::IObject iParent, AbcG::IObject iObj,
         std::cout << "   ";
 }
 
+//-*****************************************************************************
+void printChild( AbcG::IObject iParent, AbcG::IObject iObj,
+                 bool all = false, bool long_list = false, bool meta = false,
+                 bool values = false )
+{
+    printChild( iObj.getHeader(), all, long_list, meta );
+}
+
 //-*****************************************************************************
 void visit( Abc::ICompoundProperty iProp,
             bool all = false,
@@ -598,6 +613,42 @@ void visit( AbcG::IObject iObj,
     }
 }
 
+//-*****************************************************************************
+//-*****************************************************************************
+// lists the objects below iFullName from the archive's hierarchy index
+// without reading any of them, returns false if there isn't an index
+bool visitIndexed( Abc::IArchive & iArchive,
+                   const std::string & iFullName,
+                   bool long_list = false,
+                   bool meta = false,
+                   bool recursive = false,
+                   bool first = false )
+{
+    std::vector< AbcA::ObjectHeader > children;
+    if ( !iArchive.getIndexedChildHeaders( iFullName, children ) )
+        return false;
+
+    // header
+    if ( recursive && !children.empty() ) {
+        printParent( iFullName, long_list, first );
+    }
+
+    // children
+    for( size_t c = 0; c < children.size(); ++c ) {
+        printChild( children[c], false, long_list, meta );
+    }
+
+    // visit object children
+    if ( recursive ) {
+        for( size_t c = 0; c < children.size(); ++c ) {
+            visitIndexed( iArchive, children[c].getFullName(), long_list,
+                          meta, recursive, false );
+        }
+    }
+
+    return true;
+}
+
 //-*****************************************************************************
 bool isFile( const std::string& filename )
 {
@@ -628,11 +679,14 @@ int main( int argc, char *argv[] )
     bool opt_size = false; // array sample size option
     bool opt_time = false; // time info option
     bool opt_values = false; // show all 0th values
+    bool opt_index = false; // list objects from the hierarchy index
     int index = -1; // sample number, at tail of path
     std::string desc( "abcls [OPTION] FILE[/NAME] \n"
     "  -a          include property listings\n"
     "  -f          show time sampling as 24 fps\n"
     "  -h, --help  show this help message\n"
+    "  -i          list objects by name from the hierarchy index, if the\n"
+    "              archive was written with one, without reading them\n"
     "  -l          long listing format\n"
     "  -m          show archive metadata\n"
     "  -r          list entries recursively\n"
@@ -693,6 +747,7 @@ int main( int argc, char *argv[] )
     opt_size = optionExists( options, "s" );
     opt_time = optionExists( options, "t" );
     opt_values = optionExists( options, "v" );
+    opt_index = optionExists( options, "i" );
     if ( optionExists( options, "f" ) ) {
         fps = 24.0;
         opt_time = true;
@@ -854,7 +909,9 @@ int main( int argc, char *argv[] )
                 visit( props, opt_all, opt_long, opt_meta, opt_recursive, true, opt_values );
             else if ( found && header->isSimple() )
                 printChild( props, *header, opt_all, opt_long, opt_values );
-            else
+            else if ( !opt_index || opt_all ||
+                      !visitIndexed( archive, iObj.getFullName(), opt_long,
+                                     opt_meta, opt_recursive, true ) )
                 visit( iObj, opt_all, opt_long, opt_meta, opt_recursive, true, opt_values );
             std::cout << RESETCOLOR;
             if ( !opt_long )
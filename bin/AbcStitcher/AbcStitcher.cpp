@@ -1248,6 +1248,13 @@ int main( int argc, char *argv[] )
         }
 #endif
 
+        // keep computing sample digests the way the inputs did, so their
+        // keys can be reused
+        if (md.get("_ai_DigestAlgorithm") == "Murmur3Chunked")
+        {
+            oArchive.setDigestAlgorithm(kChunkedMurmur3Digest);
+        }
+
         OObject oRoot = oArchive.getTop();
         if (!oRoot.valid())
         {
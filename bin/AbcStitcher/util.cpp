@@ -147,6 +147,19 @@ void checkAcyclic(const TimeSamplingType & tsType,
 }
 
 
+// The keys of the input samples can be handed to the writer, which saves
+// hashing every sample again, when both archives compute them the same way.
+static bool canReuseKeys(IArrayProperty & iReader, OArrayProperty & iWriter)
+{
+    bool readChunked =
+        iReader.getObject().getArchive().getTop().getMetaData().get(
+            "_ai_DigestAlgorithm") == "Murmur3Chunked";
+    bool writeChunked =
+        iWriter.getObject().getArchive().getDigestAlgorithm() ==
+        kChunkedMurmur3Digest;
+    return readChunked == writeChunked;
+}
+
 void stitchArrayProp(const PropertyHeader & propHeader,
                      const ICompoundPropertyVec & iCompoundProps,
                      OCompoundProperty & oCompoundProp,
@@ -185,6 +198,8 @@ void stitchArrayProp(const PropertyHeader & propHeader,
 
         IArrayProperty reader(iCompoundProps[iCpIndex], propName);
         index_t numSamples = reader.getNumSamples();
+        bool reuseKeys = canReuseKeys(reader, writer);
+        ArraySampleKey key;
 
         ArraySamplePtr dataPtr;
         index_t numEmpty;
@@ -212,8 +227,21 @@ void stitchArrayProp(const PropertyHeader & propHeader,
 
         for (; k < numSamples; k++)
         {
+            // Ogawa to Ogawa the stored sample can be copied as is
+            if (writer.copySample(reader.getPtr(), k))
+            {
+                continue;
+            }
+
             reader.get(dataPtr, k);
-            writer.set(*dataPtr);
+            if (reuseKeys && reader.getKey(key, k))
+            {
+                writer.set(*dataPtr, key);
+            }
+            else
+            {
+                writer.set(*dataPtr);
+            }
         }
     }
 
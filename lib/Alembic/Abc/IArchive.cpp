@@ -75,6 +75,64 @@ IObject IArchive::getTop() const
     return IObject();
 }
 
+//-*****************************************************************************
+IObject IArchive::findObject( const std::string & iFullName ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::findObject()" );
+
+    AbcA::ObjectReaderPtr obj = m_archive->findObject( iFullName );
+    if ( obj )
+    {
+        return IObject( obj );
+    }
+
+    // it might be under an instance, which only IObject knows about
+    IObject ret = getTop();
+    std::size_t start = 0;
+    while ( ret.valid() && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            ret = ret.getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    return ret;
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return IObject();
+}
+
+//-*****************************************************************************
+void IArchive::getMemoryUsage( AbcA::MemoryUsage & oUsage )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getMemoryUsage" );
+
+    m_archive->getMemoryUsage( oUsage );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IArchive::trim()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::trim" );
+
+    m_archive->trim();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
 {
@@ -142,6 +200,35 @@ int32_t IArchive::getArchiveVersion( )
     return 0;
 }
 
+//-*****************************************************************************
+bool IArchive::getIndexedObjectHeader( const std::string & iFullName,
+                                       AbcA::ObjectHeader & oHeader )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getIndexedObjectHeader" );
+
+    return m_archive->getIndexedObjectHeader( iFullName, oHeader );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return false;
+}
+
+//-*****************************************************************************
+bool IArchive::getIndexedChildHeaders( const std::string & iFullName,
+                                       std::vector< AbcA::ObjectHeader > &
+                                       oHeaders )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getIndexedChildHeaders" );
+
+    return m_archive->getIndexedChildHeaders( iFullName, oHeaders );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return false;
+}
+
 //-*****************************************************************************
 void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
 {
@@ -152,6 +239,30 @@ void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+AbcA::SampleBufferAllocatorPtr IArchive::getSampleBufferAllocator()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getSampleBufferAllocator" );
+
+    return m_archive->getSampleBufferAllocator();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw,
+    // so return a NO-OP value.
+    return AbcA::SampleBufferAllocatorPtr();
+}
+
+//-*****************************************************************************
+void IArchive::setSampleBufferAllocator( AbcA::SampleBufferAllocatorPtr iPtr )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::setSampleBufferAllocator" );
+
+    m_archive->setSampleBufferAllocator( iPtr );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Abc
 } // End namespace Alembic
@@ -129,6 +129,24 @@ public:
     //! automatically as part of the archive.
     IObject getTop() const;
 
+    //! Returns the object at iFullName, like "/a/b/c", without walking
+    //! down to it with IObject::getChild when the archive type can avoid
+    //! it.  Paths through instances are still resolved like getChild does.
+    //! If there is no such object an invalid IObject is returned.
+    //! The archive may remember the headers it read along the way to make
+    //! later lookups cheaper, which keeps growing with each new part of
+    //! the hierarchy looked up until IArchive::trim is called.
+    IObject findObject( const std::string & iFullName ) const;
+
+    //! Fills oUsage with roughly how many bytes the archive is holding on
+    //! to, broken down by what for.
+    void getMemoryUsage( AbcA::MemoryUsage & oUsage );
+
+    //! Drops what the archive keeps around that it can read again when it
+    //! needs to.  Objects, properties and samples which are still held onto
+    //! stay valid.
+    void trim();
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will be disabled if a NULL cache is returned here.
@@ -139,6 +157,15 @@ public:
     //! will be disabled if a NULL cache is passed here.
     void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
+    //! Get the allocator array samples are read into. It may be a NULL
+    //! pointer, in which case they are allocated with new[].
+    AbcA::SampleBufferAllocatorPtr getSampleBufferAllocator();
+
+    //! Set the allocator array samples are read into from now on.  It may
+    //! be a NULL pointer.  Allocators can be shared amongst separate
+    //! archives.  Archives which don't support it ignore it.
+    void setSampleBufferAllocator( AbcA::SampleBufferAllocatorPtr iPtr );
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -178,6 +205,18 @@ public:
     //! of this archive file.
     int32_t getArchiveVersion();
 
+    //! If the archive was written with a hierarchy index, fills oHeader
+    //! with the header of the object at iFullName without walking down
+    //! to it.  Returns false if there is no index or no such object.
+    bool getIndexedObjectHeader( const std::string & iFullName,
+                                 AbcA::ObjectHeader & oHeader );
+
+    //! If the archive was written with a hierarchy index, fills oHeaders
+    //! with the headers of the children of iFullName in name order.
+    //! Returns false if there is no index.
+    bool getIndexedChildHeaders( const std::string & iFullName,
+                                 std::vector< AbcA::ObjectHeader > & oHeaders );
+
     //! The unspecified-bool-type operator casts the object to "true"
     //! if it is valid, and "false" otherwise.
     ALEMBIC_OPERATOR_BOOL( valid() );
@@ -350,7 +350,8 @@ IObject IObject::getChild( const std::string &iChildName ) const
         IObject obj( m_object->getChild( iChildName ),
                      getErrorHandlerPolicy() );
 
-        if ( !m_instancedFullName.empty() )
+        // the child might not be there
+        if ( obj.valid() && !m_instancedFullName.empty() )
         {
             obj.setInstancedFullName(
                 m_instancedFullName + std::string("/") + obj.getName() );
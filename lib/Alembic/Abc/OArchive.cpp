@@ -91,6 +91,30 @@ void OArchive::setCompressionHint( int8_t iCh )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+AbcA::DigestAlgorithm OArchive::getDigestAlgorithm() const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArchive::getDigestAlgorithm" );
+
+    return m_archive->getDigestAlgorithm();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw,
+    // so return a NO-OP value
+    return AbcA::kMurmur3Digest;
+}
+
+//-*****************************************************************************
+void OArchive::setDigestAlgorithm( AbcA::DigestAlgorithm iAlgorithm )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArchive::setDigestAlgorithm" );
+
+    m_archive->setDigestAlgorithm( iAlgorithm );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 uint32_t OArchive::addTimeSampling( const AbcA::TimeSampling & iTs )
 {
@@ -139,8 +139,24 @@ public:
     //! Set the compression applied to array properties.
     //! Value of -1 means uncompressed, and values of 0-9 indicate increasingly
     //! compressed data, at the expense of time.
+    //! For Ogawa archives 0 uses a fast LZ4 compression, and 1-9 use zlib
+    //! at that level.  Array properties use the hint that was set when their
+    //! first sample was written.  Archives with compressed samples can not
+    //! be read by older versions of the library.
     void setCompressionHint( int8_t iCh );
 
+    //! Get the algorithm used for the digests of array samples.
+    AbcA::DigestAlgorithm getDigestAlgorithm() const;
+
+    //! Set the algorithm used for the digests of array samples, which are
+    //! used to find and share identical samples.
+    //! AbcA::kChunkedMurmur3Digest hashes samples larger than
+    //! Util::MURMUR3_CHUNK_SIZE in parallel.  Array properties use the
+    //! algorithm that was set when their first sample was written.  The
+    //! archive can be read the same either way, Ogawa archives note its use
+    //! with a "_ai_DigestAlgorithm" metadata value.
+    void setDigestAlgorithm( AbcA::DigestAlgorithm iAlgorithm );
+
     //! Adds the TimeSampling to the Archive TimeSampling pool.
     //! If the TimeSampling already exists in the pool, the index for the match
     //! should be returned.
@@ -78,6 +78,32 @@ void OArrayProperty::set( const AbcA::ArraySample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::set( const AbcA::ArraySample &iSamp,
+                          const AbcA::ArraySampleKey &iKey )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::set(key)" );
+
+    m_property->setSampleWithKey( iSamp, iKey );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+bool OArrayProperty::copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                                 index_t iSampleIndex )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::copySample()" );
+
+    return m_property->copySample( iReader, iSampleIndex );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw,
+    // so return a NO-OP value
+    return false;
+}
+
 //-*****************************************************************************
 void OArrayProperty::setFromPrevious()
 {
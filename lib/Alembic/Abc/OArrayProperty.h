@@ -111,6 +111,21 @@ public:
     //! ...
     void set( const AbcA::ArraySample &iSample );
 
+    //! Set a sample whose key is already known, for instance from
+    //! IArrayProperty::getKey when copying samples from another archive,
+    //! which saves hashing the sample.  The key digest has to have been
+    //! computed with this archive's digest algorithm.
+    void set( const AbcA::ArraySample &iSample,
+              const AbcA::ArraySampleKey &iKey );
+
+    //! Set the next sample to sample iSampleIndex of iReader, copied as it
+    //! was stored, without decoding or hashing it.  This is only possible
+    //! between some cores (Ogawa to Ogawa) and archives which store their
+    //! samples the same way, if it isn't nothing is set and false is
+    //! returned, and the sample should be read and set as usual.
+    bool copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                     index_t iSampleIndex );
+
     //! Set a sample from the previous sample.
     //! ...
     void setFromPrevious( );
@@ -165,6 +165,12 @@ public:
         OArrayProperty::set( iVal );
     }
 
+    //! Set a sample whose key is already known, see OArrayProperty::set
+    void set( const sample_type &iVal, const AbcA::ArraySampleKey &iKey )
+    {
+        OArrayProperty::set( iVal, iKey );
+    }
+
 private:
 
     void init( AbcA::CompoundPropertyWriterPtr iParent,
@@ -0,0 +1,179 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Not run as part of the tests.  Writes a hierarchy a few levels deep, then
+// times resolving random full paths to objects, once by walking down with
+// IObject::getChild the way the procedurals' PathUtil does, and then with
+// IArchive::findObject with and without the hierarchy index.
+//
+// usage: Abc_FindObject_Bench [numLookups] [childrenPerObject] [depth]
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace Alembic::Abc;
+
+namespace
+{
+
+//-*****************************************************************************
+void addChildren( OObject & iParent, const std::string & iFullName,
+                  std::size_t iNumChildren, std::size_t iDepth,
+                  std::vector< std::string > & oPaths )
+{
+    if ( iDepth == 0 )
+    {
+        return;
+    }
+
+    for ( std::size_t i = 0; i < iNumChildren; ++i )
+    {
+        std::stringstream strm;
+        strm << "object" << i;
+        OObject child( iParent, strm.str() );
+        std::string fullName = iFullName + "/" + strm.str();
+        oPaths.push_back( fullName );
+        addChildren( child, fullName, iNumChildren, iDepth - 1, oPaths );
+    }
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iFileName, bool iIndex,
+                   std::size_t iNumChildren, std::size_t iDepth,
+                   std::vector< std::string > & oPaths )
+{
+    Alembic::AbcCoreOgawa::WriteArchive writer;
+    writer.setHierarchyIndex( iIndex );
+    OArchive archive( writer, iFileName );
+    OObject top = archive.getTop();
+    oPaths.clear();
+    addChildren( top, "", iNumChildren, iDepth, oPaths );
+}
+
+//-*****************************************************************************
+IObject walkTo( IArchive & iArchive, const std::string & iFullName )
+{
+    IObject obj = iArchive.getTop();
+    std::size_t start = 1;
+    while ( obj.valid() && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        obj = obj.getChild( iFullName.substr( start, end - start ) );
+        start = end + 1;
+    }
+
+    return obj;
+}
+
+//-*****************************************************************************
+void timeLookups( const std::string & iFileName, const std::string & iLabel,
+           bool iWalk, const std::vector< std::string > & iLookups )
+{
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iFileName );
+
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < iLookups.size(); ++i )
+    {
+        IObject obj = iWalk ? walkTo( archive, iLookups[i] ) :
+            archive.findObject( iLookups[i] );
+        count += obj.getNumChildren();
+    }
+
+    double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << iLabel << ": " << seconds << " s (" << count << ")"
+              << std::endl;
+}
+
+}
+
+int main( int argc, char *argv[] )
+{
+    std::size_t numLookups = 100000;
+    if ( argc > 1 )
+    {
+        numLookups = strtoul( argv[1], NULL, 10 );
+    }
+
+    std::size_t numChildren = 10;
+    if ( argc > 2 )
+    {
+        numChildren = strtoul( argv[2], NULL, 10 );
+    }
+
+    std::size_t depth = 4;
+    if ( argc > 3 )
+    {
+        depth = strtoul( argv[3], NULL, 10 );
+    }
+
+    std::vector< std::string > paths;
+    writeArchive( "findObjectBench.abc", false, numChildren, depth, paths );
+    writeArchive( "findObjectBenchIndexed.abc", true, numChildren, depth,
+                  paths );
+
+    // the same random paths every run
+    srand( 42 );
+    std::vector< std::string > lookups( numLookups );
+    for ( std::size_t i = 0; i < numLookups; ++i )
+    {
+        lookups[i] = paths[rand() % paths.size()];
+    }
+
+    std::cout << paths.size() << " objects, " << numLookups << " lookups"
+              << std::endl;
+
+    timeLookups( "findObjectBench.abc", "getChild walk", true, lookups );
+    timeLookups( "findObjectBench.abc", "findObject", false, lookups );
+    timeLookups( "findObjectBenchIndexed.abc", "findObject with index", false,
+          lookups );
+
+    return 0;
+}
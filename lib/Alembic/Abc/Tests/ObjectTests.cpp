@@ -40,6 +40,8 @@
 #include <Alembic/Abc/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <thread>
+
 #ifdef ALEMBIC_WITH_HDF5
 #include <Alembic/AbcCoreHDF5/All.h>
 #endif
@@ -340,6 +342,130 @@ void errorHandlerTest(bool useOgawa)
     }
 }
 
+void writeFindObjectArchive(const std::string &archiveName, bool useOgawa,
+                            bool useIndex)
+{
+    OArchive archive;
+    if (useOgawa)
+    {
+        Alembic::AbcCoreOgawa::WriteArchive writer;
+        writer.setHierarchyIndex(useIndex);
+        archive = OArchive( writer, archiveName, ErrorHandler::kThrowPolicy );
+    }
+#ifdef ALEMBIC_WITH_HDF5
+    else
+    {
+        archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+            archiveName, ErrorHandler::kThrowPolicy );
+    }
+#endif
+
+    OObject a( archive.getTop(), "a" );
+    OObject b( a, "b" );
+    OObject c( b, "c" );
+    OObject d( b, "d" );
+    OObject e( a, "e" );
+    OObject f( archive.getTop(), "f" );
+    f.addChildInstance( b, "inst" );
+}
+
+void findObjectTest(const std::string &archiveName)
+{
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( archiveName );
+    TESTING_ASSERT( archive.valid() );
+
+    IObject c = archive.findObject( "/a/b/c" );
+    TESTING_ASSERT( c.valid() );
+    TESTING_ASSERT( c.getFullName() == "/a/b/c" );
+    TESTING_ASSERT( c.getName() == "c" );
+
+    // same object when asked again, the full name doesn't need the slashes
+    TESTING_ASSERT( archive.findObject( "a/b//c/" ).getPtr() == c.getPtr() );
+
+    IObject b = c.getParent();
+    TESTING_ASSERT( b.getFullName() == "/a/b" );
+    TESTING_ASSERT( b.getNumChildren() == 2 );
+    TESTING_ASSERT( b.getChild( "d" ).getFullName() == "/a/b/d" );
+    TESTING_ASSERT( b.getParent().getParent().getFullName() == "/" );
+
+    TESTING_ASSERT( archive.findObject( "/" ).getFullName() == "/" );
+    TESTING_ASSERT( archive.findObject( "" ).getFullName() == "/" );
+    TESTING_ASSERT( archive.findObject( "/a/e" ).getNumChildren() == 0 );
+
+    TESTING_ASSERT( !archive.findObject( "/a/b/x" ).valid() );
+    TESTING_ASSERT( !archive.findObject( "/a/e/c" ).valid() );
+    TESTING_ASSERT( !archive.findObject( "/x/b" ).valid() );
+    TESTING_ASSERT( !archive.findObject( "/a/bc" ).valid() );
+
+    // through an instance of /a/b, same as walking down with getChild
+    IObject inst = archive.findObject( "/f/inst" );
+    TESTING_ASSERT( inst.valid() );
+    TESTING_ASSERT( inst.isInstanceRoot() );
+    TESTING_ASSERT( inst.getNumChildren() == 2 );
+    IObject instC = archive.findObject( "/f/inst/c" );
+    TESTING_ASSERT( instC.valid() );
+    TESTING_ASSERT( instC.getFullName() == "/f/inst/c" );
+    TESTING_ASSERT( instC.isInstanceDescendant() );
+    TESTING_ASSERT( !archive.findObject( "/f/inst/x" ).valid() );
+}
+
+void findObjectThreadedTest(const std::string &archiveName)
+{
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( archiveName );
+    TESTING_ASSERT( archive.valid() );
+
+    // the first lookups all race to read the same headers
+    const std::size_t numThreads = 8;
+    std::vector< IObject > found( numThreads * 2 );
+    std::vector< std::thread > threads;
+    for ( std::size_t t = 0; t < numThreads; ++t )
+    {
+        threads.push_back( std::thread( [&archive, &found, t]()
+        {
+            found[t * 2] = archive.findObject( "/a/b/c" );
+            found[t * 2 + 1] = archive.findObject( "/a/b/d" );
+        } ) );
+    }
+
+    for ( std::size_t t = 0; t < numThreads; ++t )
+    {
+        threads[t].join();
+    }
+
+    for ( std::size_t i = 0; i < found.size(); ++i )
+    {
+        TESTING_ASSERT( found[i].getPtr() == found[i % 2].getPtr() );
+    }
+
+    TESTING_ASSERT( found[0].getFullName() == "/a/b/c" );
+    TESTING_ASSERT( found[1].getFullName() == "/a/b/d" );
+}
+
+void findLayeredObjectTest(const std::string &archiveName)
+{
+    std::string otherName = "findLayeredObject.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), otherName );
+        OObject a( archive.getTop(), "a" );
+        OObject g( a, "g" );
+    }
+
+    std::vector< std::string > files;
+    files.push_back( archiveName );
+    files.push_back( otherName );
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( files );
+    TESTING_ASSERT( archive.valid() );
+    TESTING_ASSERT( archive.findObject( "/a/g" ).getFullName() == "/a/g" );
+    TESTING_ASSERT( archive.findObject( "/a/b/c" ).getFullName() ==
+                    "/a/b/c" );
+    TESTING_ASSERT( archive.findObject( "/a" ).getNumChildren() == 3 );
+    TESTING_ASSERT( !archive.findObject( "/a/g/c" ).valid() );
+}
+
 void fuzzer26643_test()
 {
     AbcF::IFactory factory;
@@ -414,6 +540,22 @@ int main( int argc, char *argv[] )
 
     errorHandlerTest(true);
 
+    {
+        std::string archiveName("findObject.abc");
+        writeFindObjectArchive( archiveName, true, false );
+        findObjectTest( archiveName );
+        findObjectThreadedTest( archiveName );
+        findLayeredObjectTest( archiveName );
+        writeFindObjectArchive( archiveName, true, true );
+        findObjectTest( archiveName );
+        findObjectThreadedTest( archiveName );
+        findLayeredObjectTest( archiveName );
+#ifdef ALEMBIC_WITH_HDF5
+        writeFindObjectArchive( archiveName, false, false );
+        findObjectTest( archiveName );
+#endif
+    }
+
     fuzzer26643_test();
 
     return 0;
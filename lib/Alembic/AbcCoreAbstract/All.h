@@ -43,6 +43,7 @@
 #include <Alembic/AbcCoreAbstract/ArrayPropertyWriter.h>
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 #include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleRequest.h>
 #include <Alembic/AbcCoreAbstract/BasePropertyReader.h>
 #include <Alembic/AbcCoreAbstract/BasePropertyWriter.h>
 #include <Alembic/AbcCoreAbstract/CompoundPropertyReader.h>
@@ -56,6 +57,7 @@
 #include <Alembic/AbcCoreAbstract/ObjectReader.h>
 #include <Alembic/AbcCoreAbstract/ObjectWriter.h>
 #include <Alembic/AbcCoreAbstract/PropertyHeader.h>
+#include <Alembic/AbcCoreAbstract/SampleBufferAllocator.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyReader.h>
 #include <Alembic/AbcCoreAbstract/ScalarPropertyWriter.h>
 #include <Alembic/AbcCoreAbstract/ScalarSample.h>
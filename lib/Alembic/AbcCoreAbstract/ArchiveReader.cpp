@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreAbstract/ArchiveReader.h>
+#include <Alembic/AbcCoreAbstract/ObjectReader.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -46,6 +47,68 @@ ArchiveReader::~ArchiveReader()
     // Nothing
 }
 
+//-*****************************************************************************
+SampleBufferAllocatorPtr ArchiveReader::getSampleBufferAllocator()
+{
+    return SampleBufferAllocatorPtr();
+}
+
+//-*****************************************************************************
+void ArchiveReader::setSampleBufferAllocator( SampleBufferAllocatorPtr iPtr )
+{
+}
+
+//-*****************************************************************************
+bool ArchiveReader::getIndexedObjectHeader( const std::string & iFullName,
+                                            ObjectHeader & oHeader )
+{
+    return false;
+}
+
+//-*****************************************************************************
+bool ArchiveReader::getIndexedChildHeaders( const std::string & iFullName,
+                                            std::vector< ObjectHeader > &
+                                            oHeaders )
+{
+    return false;
+}
+
+//-*****************************************************************************
+ObjectReaderPtr ArchiveReader::findObject( const std::string & iFullName )
+{
+    ObjectReaderPtr obj = getTop();
+
+    std::size_t start = 0;
+    while ( obj && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            obj = obj->getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    return obj;
+}
+
+//-*****************************************************************************
+void ArchiveReader::getMemoryUsage( MemoryUsage & oUsage )
+{
+    oUsage = MemoryUsage();
+}
+
+//-*****************************************************************************
+void ArchiveReader::trim()
+{
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
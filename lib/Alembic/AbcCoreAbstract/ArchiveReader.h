@@ -40,7 +40,9 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
+#include <Alembic/AbcCoreAbstract/ObjectHeader.h>
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/SampleBufferAllocator.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -69,6 +71,49 @@ struct ALEMBIC_EXPORT ArchiveReaderConstructor
 };
 } // End namespace IllustrationOnly
 
+//-*****************************************************************************
+//! Roughly how many bytes an open archive is holding on to, broken down by
+//! what it is held for.  See ArchiveReader::getMemoryUsage.
+struct MemoryUsage
+{
+    MemoryUsage()
+      : headers( 0 )
+      , metaData( 0 )
+      , samples( 0 )
+      , timeSamplings( 0 )
+      , streams( 0 )
+      , readers( 0 ) {}
+
+    //! Object and property headers of the readers that are alive, and
+    //! anything kept around to find objects by name.
+    std::size_t headers;
+
+    //! MetaData shared by many headers, and the archive's own.
+    std::size_t metaData;
+
+    //! Samples this archive put in the read array sample cache, even when
+    //! the cache is shared with other archives, and buffers kept by the
+    //! sample buffer allocator to be used again.  An allocator shared by
+    //! several archives is counted in each of them.
+    std::size_t samples;
+
+    //! The time samplings and the number of samples written for each.
+    std::size_t timeSamplings;
+
+    //! Parts of the file kept in memory to make small reads cheaper.
+    std::size_t streams;
+
+    //! Memory the readers themselves are made in, which may be kept for
+    //! new readers after the old ones go away rather than given back.
+    std::size_t readers;
+
+    std::size_t total() const
+    {
+        return headers + metaData + samples + timeSamplings + streams +
+            readers;
+    }
+};
+
 //-*****************************************************************************
 //! The Archive is "the file". It has a single object, it's top object.
 //! It has no properties, but does have metadata.
@@ -106,6 +151,16 @@ public:
     //! will be disabled if a NULL cache is passed here.
     virtual void setReadArraySampleCachePtr( ReadArraySampleCachePtr iPtr ) = 0;
 
+    //! Get the allocator array samples are read into.  It may be a NULL
+    //! pointer, in which case they are allocated with new[].
+    //! The default implementation always returns NULL.
+    virtual SampleBufferAllocatorPtr getSampleBufferAllocator();
+
+    //! Set the allocator array samples are read into from now on, it may be
+    //! a NULL pointer.  Allocators can be shared amongst separate archives.
+    //! The default implementation ignores it.
+    virtual void setSampleBufferAllocator( SampleBufferAllocatorPtr iPtr );
+
     //! Returns the TimeSampling at a given index.
     virtual TimeSamplingPtr getTimeSampling( uint32_t iIndex ) = 0;
 
@@ -123,6 +178,45 @@ public:
     //! of this archive file.
     virtual int32_t getArchiveVersion() = 0;
 
+    //! Some archives carry an index of their whole object hierarchy.
+    //! If this one does, fills oHeader with the header of the object at
+    //! iFullName (like "/a/b/c") straight from the index, without reading
+    //! any of the objects above it.
+    //! Returns false if there is no index, or no such object in it.
+    //! The default implementation always returns false.
+    virtual bool getIndexedObjectHeader( const std::string & iFullName,
+                                         ObjectHeader & oHeader );
+
+    //! Fills oHeaders with the headers of the children of the object at
+    //! iFullName, in name order, straight from the hierarchy index.
+    //! Returns false if there is no index.
+    //! The default implementation always returns false.
+    virtual bool getIndexedChildHeaders( const std::string & iFullName,
+                                         std::vector< ObjectHeader > &
+                                         oHeaders );
+
+    //! Returns the object at iFullName (like "/a/b/c"), or an empty
+    //! pointer if there isn't one.  Empty path elements are ignored, so
+    //! "a/b/" is the same as "/a/b".
+    //! The default implementation walks down from getTop() one child at a
+    //! time, implementations can override it to get at the object without
+    //! creating readers for everything above it.  What they remember to
+    //! do so is counted by getMemoryUsage and let go of by trim.
+    virtual ObjectReaderPtr findObject( const std::string & iFullName );
+
+    //! Fills oUsage with roughly how many bytes this archive is holding on
+    //! to.  The default implementation reports nothing.
+    virtual void getMemoryUsage( MemoryUsage & oUsage );
+
+    //! Drops anything this archive keeps around that it can read again when
+    //! it needs to, like cached samples and parts of the file.  A read
+    //! array sample cache shared with other archives only loses the
+    //! samples this archive put there.
+    //! Readers which are still held onto, and what they hand out, stay
+    //! valid.
+    //! The default implementation does nothing.
+    virtual void trim();
+
     //! Return self
     //! ...
     virtual ArchiveReaderPtr asArchivePtr() = 0;
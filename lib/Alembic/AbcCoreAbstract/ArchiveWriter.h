@@ -39,6 +39,7 @@
 
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
 #include <Alembic/AbcCoreAbstract/MetaData.h>
 #include <Alembic/AbcCoreAbstract/ForwardDeclarations.h>
 
@@ -71,7 +72,8 @@ class ALEMBIC_EXPORT ArchiveWriter
 {
 protected:
     ArchiveWriter()
-      : m_compressionHint( -1 ) {}
+      : m_compressionHint( -1 )
+      , m_digestAlgorithm( kMurmur3Digest ) {}
 
 public:
     //! Virtual destructor
@@ -108,6 +110,18 @@ public:
             ( iCh > 9 ? 9 : iCh );
     }
 
+    //! Get the algorithm used for the digests of array samples.
+    //! Implementations are free to disregard this.
+    DigestAlgorithm getDigestAlgorithm() const { return m_digestAlgorithm; }
+
+    //! Set the algorithm used for the digests of array samples, which are
+    //! used to find and share identical samples.
+    //! Implementations are free to disregard this.
+    void setDigestAlgorithm( DigestAlgorithm iAlgorithm )
+    {
+        m_digestAlgorithm = iAlgorithm;
+    }
+
     //! Return self
     //! May sometimes be spoofed.
     virtual ArchiveWriterPtr asArchivePtr() = 0;
@@ -141,6 +155,7 @@ public:
 
 private:
     int8_t m_compressionHint;
+    DigestAlgorithm m_digestAlgorithm;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
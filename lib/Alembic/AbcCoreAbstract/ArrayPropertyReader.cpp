@@ -40,12 +40,55 @@ namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+namespace {
+
+// the samples were all read up front
+class ReadSampleRequest : public ArraySampleRequest
+{
+public:
+    ReadSampleRequest( const std::vector< ArraySamplePtr > & iSamples )
+      : m_samples( iSamples ) {}
+
+    virtual std::size_t getNumSamples() const { return m_samples.size(); }
+
+    virtual bool isReady() { return true; }
+
+    virtual void wait() {}
+
+    virtual ArraySamplePtr getSample( std::size_t iIndex )
+    {
+        ABCA_ASSERT( iIndex < m_samples.size(),
+                     "Invalid request index: " << iIndex );
+        return m_samples[iIndex];
+    }
+
+private:
+    std::vector< ArraySamplePtr > m_samples;
+};
+
+}
+
 //-*****************************************************************************
 ArrayPropertyReader::~ArrayPropertyReader()
 {
     // Nothing
 }
 
+//-*****************************************************************************
+ArraySampleRequestPtr
+ArrayPropertyReader::requestSamples(
+    const std::vector< index_t > & iSampleIndices )
+{
+    std::vector< ArraySamplePtr > samples( iSampleIndices.size() );
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        getSample( iSampleIndices[i], samples[i] );
+    }
+
+    return ArraySampleRequestPtr( new ReadSampleRequest( samples ) );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -41,6 +41,7 @@
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/BasePropertyReader.h>
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleRequest.h>
 
 namespace Alembic {
 namespace AbcCoreAbstract {
@@ -141,6 +142,16 @@ public:
     //! and std::wstring as core language-level primitives.
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod ) = 0;
+
+    //! Asks for all of the samples at iSampleIndices at once, they are the
+    //! same as what getSample would return for each of them.
+    //! Implementations may read them in the background, and merge reads
+    //! which are close together, so the returned request can be polled or
+    //! waited on while other requests are made.
+    //! Out-of-range indices throw here, not when the request is waited on.
+    //! The default implementation reads them all before returning.
+    virtual ArraySampleRequestPtr
+    requestSamples( const std::vector< index_t > & iSampleIndices );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -46,6 +46,19 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyWriter::setSampleWithKey( const ArraySample & iSamp,
+                                            const ArraySampleKey & )
+{
+    setSample( iSamp );
+}
+
+//-*****************************************************************************
+bool ArrayPropertyWriter::copySample( ArrayPropertyReaderPtr, index_t )
+{
+    return false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
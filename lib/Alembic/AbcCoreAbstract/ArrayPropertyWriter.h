@@ -75,6 +75,24 @@ public:
     //! treated just like regular data elements.
     virtual void setSample( const ArraySample & iSamp ) = 0;
 
+    //! Sets a sample whose key is already known, for instance from
+    //! ArrayPropertyReader::getKey when copying samples between archives,
+    //! so implementations which key their samples can skip computing it.
+    //! The key digest must have been computed with the archive's digest
+    //! algorithm, debug builds may check that it matches the sample.
+    //! The default implementation ignores the key and calls setSample.
+    virtual void setSampleWithKey( const ArraySample & iSamp,
+                                   const ArraySampleKey & iKey );
+
+    //! Sets the next sample to sample iSampleIndex of iReader by copying
+    //! it as it is stored, without reading it into an ArraySample, when the
+    //! implementation can (for instance when both are from the same core).
+    //! Returns false without setting anything when it can't, in which case
+    //! the sample should be read and set as usual.
+    //! The default implementation always returns false.
+    virtual bool copySample( ArrayPropertyReaderPtr iReader,
+                             index_t iSampleIndex );
+
     //! Set the next sample to equal the previous sample.
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
@@ -37,12 +37,20 @@
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 #include <Alembic/Util/Murmur3.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 ArraySample::Key ArraySample::getKey() const
+{
+    return getKey( kMurmur3Digest );
+}
+
+//-*****************************************************************************
+ArraySample::Key ArraySample::getKey( DigestAlgorithm iAlgorithm ) const
 {
 
     // Depending on data type, loop over everything.
@@ -70,60 +78,79 @@ ArraySample::Key ArraySample::getKey() const
     case kFloat32POD:
     case kFloat64POD:
     {
-        MurmurHash3_x64_128( m_data, numBytes, PODNumBytes(m_dataType.getPod()),
-            k.digest.words );
+        if ( iAlgorithm == kChunkedMurmur3Digest )
+        {
+            ChunkedMurmurHash3_x64_128( m_data, numBytes,
+                PODNumBytes( m_dataType.getPod() ), k.digest.words );
+        }
+        else
+        {
+            MurmurHash3_x64_128( m_data, numBytes,
+                PODNumBytes( m_dataType.getPod() ), k.digest.words );
+        }
     }
     break;
 
+    // The strings are hashed as if their characters had been copied into
+    // one buffer, each string followed by a 0 for the NULL seperator
+    // character, but are streamed into the hash directly.
     case kStringPOD:
     {
-        std::vector <int8_t> v;
+        const std::string * strs = static_cast<const std::string*>( m_data );
+        const int8_t sep = 0;
+
+        Util::Murmur3Hash hash( sizeof( int8_t ) );
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::string &str =
-                static_cast<const std::string*>( m_data )[j];
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            hash.update( strs[j].data(), strs[j].length() );
+            hash.update( &sep, sizeof( int8_t ) );
         }
-
-        int8_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int8_t), k.digest.words );
+        hash.final( k.digest.words );
     }
     break;
 
     case kWstringPOD:
     {
-        std::vector <int32_t> v;
+        const std::wstring * wstrs =
+            static_cast<const std::wstring*>( m_data );
+
+        // The wide characters are widened (or narrowed) to int32_t, but
+        // only the first (number of characters) bytes of them have ever been
+        // hashed, and that is kept as is so existing digests don't change.
+        size_t numChars = 0;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::wstring &wstr =
-                static_cast<const std::wstring*>( m_data )[j];
+            numChars += wstrs[j].length() + 1;
+        }
+
+        Util::Murmur3Hash hash( sizeof( int32_t ) );
+        size_t remaining = numChars;
+        int32_t buf[256];
+        size_t bufSize = 0;
+        for ( size_t j = 0; j < numPods && remaining > 0; ++j )
+        {
+            size_t wlen = wstrs[j].length();
 
-            size_t wlen = wstr.length();
-            for (size_t k = 0; k < wlen; ++k)
+            // the extra character is the NULL seperator
+            for ( size_t c = 0; c <= wlen && remaining > 0; ++c )
             {
-                v.push_back(wstr[k]);
+                buf[bufSize++] = c < wlen ? int32_t( wstrs[j][c] ) : 0;
+                if ( bufSize == 256 )
+                {
+                    size_t n = std::min( remaining, sizeof( buf ) );
+                    hash.update( buf, n );
+                    remaining -= n;
+                    bufSize = 0;
+                }
             }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
         }
 
-        int32_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int32_t), k.digest.words );
+        if ( bufSize > 0 && remaining > 0 )
+        {
+            hash.update( buf, std::min( remaining,
+                                        bufSize * sizeof( int32_t ) ) );
+        }
+        hash.final( k.digest.words );
     }
     break;
 
@@ -102,6 +102,10 @@ public:
     //! This is a calculation.
     Key getKey() const;
 
+    //! Compute the Key, with the digest computed by the given algorithm.
+    //! Keys are only comparable when they use the same algorithm.
+    Key getKey( DigestAlgorithm iAlgorithm ) const;
+
     //! Return if it is valid.
     //! An empty ArraySample is valid.
     //! however, an ArraySample that is empty and has a scalar
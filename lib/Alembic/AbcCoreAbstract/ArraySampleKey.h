@@ -44,6 +44,20 @@ namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! How the digest of an ArraySampleKey is computed.
+//! kMurmur3Digest is MurmurHash3_x64_128 over the whole sample, and is what
+//! every archive written before kChunkedMurmur3Digest existed uses.
+//! kChunkedMurmur3Digest gives the same digest for samples of up to
+//! Util::MURMUR3_CHUNK_SIZE bytes, and hashes larger samples in parallel
+//! chunks (see Util::ChunkedMurmurHash3_x64_128).  String samples are
+//! hashed the same way by both.
+enum DigestAlgorithm
+{
+    kMurmur3Digest = 0,
+    kChunkedMurmur3Digest = 1
+};
+
 struct ArraySampleKey : public Alembic::Util::totally_ordered<ArraySampleKey>
 {
     //! total number of bytes of the sample as originally stored
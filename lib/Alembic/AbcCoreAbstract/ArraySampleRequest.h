@@ -0,0 +1,83 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+#ifndef Alembic_AbcCoreAbstract_ArraySampleRequest_h
+#define Alembic_AbcCoreAbstract_ArraySampleRequest_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ArraySample.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The samples asked for by ArrayPropertyReader::requestSamples.
+//! Implementations may read them in the background, so that the reads of
+//! many requests overlap, instead of waiting on each read in turn.
+class ALEMBIC_EXPORT ArraySampleRequest
+    : private Alembic::Util::noncopyable
+{
+public:
+    //! Virtual destructor
+    //! ...
+    virtual ~ArraySampleRequest();
+
+    //! The number of samples which were requested.
+    virtual std::size_t getNumSamples() const = 0;
+
+    //! Returns whether all of the samples have been read, without waiting.
+    virtual bool isReady() = 0;
+
+    //! Waits until all of the samples have been read.  If reading any of
+    //! them failed, the exception is thrown from here.
+    virtual void wait() = 0;
+
+    //! Waits, and then returns the sample for the iIndex'th requested
+    //! sample index.
+    virtual ArraySamplePtr getSample( std::size_t iIndex ) = 0;
+};
+
+//-*****************************************************************************
+typedef Alembic::Util::shared_ptr<ArraySampleRequest> ArraySampleRequestPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
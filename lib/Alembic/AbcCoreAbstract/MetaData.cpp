@@ -0,0 +1,237 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/MetaData.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// FNV-1a, our keys are short so this is cheaper than comparing the strings
+Alembic::Util::uint32_t hashKey( const std::string &iKey )
+{
+    Alembic::Util::uint32_t h = 2166136261U;
+    for ( std::size_t i = 0; i < iKey.size(); ++i )
+    {
+        h ^= ( unsigned char ) iKey[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+//-*****************************************************************************
+bool keyLess( const MetaData::value_type &iA, const MetaData::value_type &iB )
+{
+    return iA.first < iB.first;
+}
+
+//-*****************************************************************************
+bool keyEqual( const MetaData::value_type &iA, const MetaData::value_type &iB )
+{
+    return iA.first == iB.first;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void MetaData::deserialize( const std::string &iFrom )
+{
+    EntriesPtr entries( new Entries() );
+    std::vector<value_type> & pairs = entries->pairs;
+
+    // same rules as TokenMap::setUnique when quiet
+    std::size_t lastPair = 0;
+    while ( 1 )
+    {
+        std::size_t curPair = iFrom.find( ';', lastPair );
+        std::size_t curAssign = iFrom.find( '=', lastPair );
+
+        if ( curAssign > curPair )
+        {
+            break;
+        }
+
+        if ( curAssign != std::string::npos )
+        {
+            std::size_t endPos = std::string::npos;
+            if ( curPair != endPos )
+            {
+                endPos = curPair - curAssign - 1;
+            }
+
+            pairs.push_back( value_type(
+                iFrom.substr( lastPair, curAssign - lastPair ),
+                iFrom.substr( curAssign + 1, endPos ) ) );
+        }
+
+        if ( curPair == std::string::npos )
+        {
+            break;
+        }
+
+        lastPair = curPair + 1;
+    }
+
+    if ( pairs.empty() )
+    {
+        m_entries.reset();
+        return;
+    }
+
+    // the first of any repeated keys wins
+    std::stable_sort( pairs.begin(), pairs.end(), keyLess );
+    pairs.erase( std::unique( pairs.begin(), pairs.end(), keyEqual ),
+                 pairs.end() );
+
+    entries->hashes.reserve( pairs.size() );
+    for ( std::size_t i = 0; i < pairs.size(); ++i )
+    {
+        entries->hashes.push_back( hashKey( pairs[i].first ) );
+    }
+
+    m_entries = entries;
+}
+
+//-*****************************************************************************
+std::string MetaData::serialize() const
+{
+    std::string output;
+
+    for ( const_iterator iter = begin(); iter != end(); ++iter )
+    {
+        const std::string & token = (*iter).first;
+        const std::string & value = (*iter).second;
+
+        if ( token.find_first_of( ";=" ) != std::string::npos ||
+             value.find_first_of( ";=" ) != std::string::npos )
+        {
+            // same message as TokenMap::get which this used to call
+            ABCA_THROW( "TokenMap::get: Token-Value pair " <<
+                " contains separator characters: ; or = for " <<
+                token << " or "  << value );
+        }
+
+        if ( value.empty() )
+        {
+            continue;
+        }
+
+        if ( !output.empty() )
+        {
+            output += ';';
+        }
+
+        output += token;
+        output += '=';
+        output += value;
+    }
+
+    return output;
+}
+
+//-*****************************************************************************
+void MetaData::set( const std::string &iKey, const std::string &iData )
+{
+    if ( !m_entries )
+    {
+        m_entries.reset( new Entries() );
+    }
+    else if ( m_entries.use_count() > 1 )
+    {
+        // somebody else is looking at these entries, so change a copy
+        m_entries.reset( new Entries( *m_entries ) );
+    }
+
+    std::vector<value_type> & pairs = m_entries->pairs;
+    value_type entry( iKey, iData );
+    std::vector<value_type>::iterator it =
+        std::lower_bound( pairs.begin(), pairs.end(), entry, keyLess );
+
+    if ( it != pairs.end() && it->first == iKey )
+    {
+        it->second = iData;
+        return;
+    }
+
+    std::size_t index = it - pairs.begin();
+    pairs.insert( it, entry );
+    m_entries->hashes.insert( m_entries->hashes.begin() + index,
+                              hashKey( iKey ) );
+}
+
+//-*****************************************************************************
+const MetaData::value_type *
+MetaData::find( const std::string &iKey ) const
+{
+    if ( !m_entries )
+    {
+        return NULL;
+    }
+
+    Alembic::Util::uint32_t hash = hashKey( iKey );
+    const std::vector<Alembic::Util::uint32_t> & hashes = m_entries->hashes;
+    for ( std::size_t i = 0; i < hashes.size(); ++i )
+    {
+        if ( hashes[i] == hash && m_entries->pairs[i].first == iKey )
+        {
+            return &m_entries->pairs[i];
+        }
+    }
+
+    return NULL;
+}
+
+//-*****************************************************************************
+const std::vector<MetaData::value_type> & MetaData::emptyPairs()
+{
+    static const std::vector<value_type> empty;
+    return empty;
+}
+
+//-*****************************************************************************
+const std::string & MetaData::emptyString()
+{
+    static const std::string empty;
+    return empty;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -52,45 +52,48 @@ namespace ALEMBIC_VERSION_NS {
 //! This is not a virtual class, nor is it intended to be used as a base
 //! for derivation. It is explicitly declared and implemented as part of
 //! the AbcCoreAbstract library.
-//! It is composed (not inherited) from \ref Alembic::Util::TokenMap.
 //! In order to not have duplicated (and possibly conflicting) policy
 //! implementation, we present this class here as a MOSTLY-WRITE-ONCE interface,
 //! with selective exception throwing behavior for failed writes.
-class MetaData
+//!
+//! The entries are kept in a small vector sorted by key, next to a hash of
+//! each key, so lookups are a scan over integers rather than a walk through
+//! a tree of strings.  The entries are shared between copies and only
+//! cloned when a copy is changed, so every header which was read with the
+//! same indexed MetaData from an archive shares one table.
+class ALEMBIC_EXPORT MetaData
 {
 public:
     //-*************************************************************************
     // TYPEDEFS
     //-*************************************************************************
 
-    //! Our internals are handled by a TokenMap, which we expose
-    //! through these typedefs.
-    typedef Alembic::Util::TokenMap token_map_type;
-
     //! Key type.
     //! Keys are unique within each MetaData instance.
-    typedef token_map_type::key_type key_type;
+    typedef std::string key_type;
 
     //! Data type.
     //! Data is associated with a key, with each key being unique.
-    typedef token_map_type::data_type data_type;
+    typedef std::string data_type;
 
     //! Value-type
     //! This is what the MetaData class "contains", when viewed
     //! as a standard container.
-    typedef token_map_type::value_type value_type;
+    typedef std::pair<key_type, data_type> value_type;
 
     //! Const reference type
     //! This is what the iterators dereference to.
-    typedef token_map_type::const_reference const_reference;
+    typedef const value_type & const_reference;
 
     //! const_iterator typedef
     //! this dereferences to a const \ref value_type reference.
-    typedef token_map_type::const_iterator const_iterator;
+    //! Iteration is in key order.
+    typedef std::vector<value_type>::const_iterator const_iterator;
 
     //! const_reverse_iterator typedef
     //! this dereferences to a const \ref value_type instance.
-    typedef token_map_type::const_reverse_iterator const_reverse_iterator;
+    typedef std::vector<value_type>::const_reverse_iterator
+        const_reverse_iterator;
 
     //-*************************************************************************
     // CONSTRUCTION
@@ -101,14 +104,14 @@ public:
     MetaData() {}
 
     //! Copy constructor copies another MetaData.
-    //! ...
-    MetaData( const MetaData &iCopy ) : m_tokenMap( iCopy.m_tokenMap ) {}
+    //! This only shares the entries of iCopy, it doesn't copy the strings.
+    MetaData( const MetaData &iCopy ) : m_entries( iCopy.m_entries ) {}
 
     //! Assignment operator copies the contents of another
     //! MetaData instance.
     MetaData& operator=( const MetaData &iCopy )
     {
-        m_tokenMap = iCopy.m_tokenMap;
+        m_entries = iCopy.m_entries;
         return *this;
     }
 
@@ -118,26 +121,20 @@ public:
 
     //! Deserialization will replace the contents of this class with the
     //! parsed contents of a string. It will just clear the contents first.
-    //! It will throw an exception if the string is mal-formed.
+    //! Malformed pairs and repeated keys are quietly skipped.
     //! \internal For library implementation internal use.
-    void deserialize( const std::string &iFrom )
-    {
-        m_tokenMap.clear();
-        m_tokenMap.setUnique( iFrom, ';', '=', true );
-    }
+    void deserialize( const std::string &iFrom );
 
     //! Serialization will convert the contents of this MetaData into a
     //! single string.
+    //! It will throw an exception if a key or value contains ';' or '='.
     //! \internal For library implementation internal use.
-    std::string serialize() const
-    {
-        return m_tokenMap.get( ';', '=', true );
-    }
+    std::string serialize() const;
 
     //-*************************************************************************
     // SIZE
     //-*************************************************************************
-    size_t size() const { return m_tokenMap.size(); }
+    size_t size() const { return m_entries ? m_entries->pairs.size() : 0; }
 
     //-*************************************************************************
     // ITERATION
@@ -145,19 +142,19 @@ public:
 
     //! Returns a \ref const_iterator corresponding to the beginning of the
     //! MetaData or the end of the MetaData if empty.
-    const_iterator begin() const { return m_tokenMap.begin(); }
+    const_iterator begin() const { return pairs().begin(); }
 
     //! Returns a \ref const_iterator corresponding to the end of the
     //! MetaData.
-    const_iterator end() const { return m_tokenMap.end(); }
+    const_iterator end() const { return pairs().end(); }
 
     //! Returns a \ref const_reverse_iterator corresponding to the beginning
     //! of the MetaData or the end of the MetaData if empty.
-    const_reverse_iterator rbegin() const { return m_tokenMap.rbegin(); }
+    const_reverse_iterator rbegin() const { return pairs().rbegin(); }
 
     //! Returns an \ref const_reverse_iterator corresponding to the end
     //! of the MetaData.
-    const_reverse_iterator rend() const { return m_tokenMap.rend(); }
+    const_reverse_iterator rend() const { return pairs().rend(); }
 
     //-*************************************************************************
     // ACCESS/ASSIGNMENT
@@ -165,21 +162,17 @@ public:
 
     //! set lets you set a key/data pair.
     //! This will silently overwrite an existing value.
-    void set( const std::string &iKey, const std::string &iData )
-    {
-        m_tokenMap.setValue( iKey, iData );
-    }
+    void set( const std::string &iKey, const std::string &iData );
 
     //! setUnique lets you set a key/data pair,
     //! but throws an exception if you attempt to change the value
     //! of an existing field. It is fine if you set the same value.
-    //! \remarks Not the most efficient implementation at the moment.
     void setUnique( const std::string &iKey, const std::string &iData )
     {
-        std::string found = m_tokenMap.value( iKey );
-        if ( found == "" )
+        const std::string & found = get( iKey );
+        if ( found.empty() )
         {
-            m_tokenMap.setValue( iKey, iData );
+            set( iKey, iData );
         }
         else if ( found != iData )
         {
@@ -188,18 +181,19 @@ public:
     }
 
     //! get returns the value, or an empty string if it is not set.
-    //! ...
-    std::string get( const std::string &iKey ) const
+    //! The reference is good until this MetaData is changed or destroyed.
+    const std::string & get( const std::string &iKey ) const
     {
-        return m_tokenMap.value( iKey );
+        const value_type * found = find( iKey );
+        return found ? found->second : emptyString();
     }
 
     //! getRequired returns the value, and throws an exception if it is
     //! not found.
-    std::string getRequired( const std::string &iKey ) const
+    const std::string & getRequired( const std::string &iKey ) const
     {
-        std::string ret = m_tokenMap.value( iKey );
-        if ( ret == "" )
+        const std::string & ret = get( iKey );
+        if ( ret.empty() )
         {
             ABCA_THROW( "Key: " << iKey << " did not exist in MetaData" );
         }
@@ -210,6 +204,12 @@ public:
     //! overwritten.
     void append( const MetaData &iMetaData )
     {
+        if ( !m_entries )
+        {
+            m_entries = iMetaData.m_entries;
+            return;
+        }
+
         for ( const_iterator iter = iMetaData.begin();
               iter != iMetaData.end(); ++iter )
         {
@@ -221,10 +221,16 @@ public:
     //! are ignored, and the original value remains untouched
     void appendOnlyUnique( const MetaData &iMetaData )
     {
+        if ( !m_entries )
+        {
+            m_entries = iMetaData.m_entries;
+            return;
+        }
+
         for ( const_iterator iter = iMetaData.begin();
               iter != iMetaData.end(); ++iter )
         {
-            if ( !m_tokenMap.tokenExists( (*iter).first ) )
+            if ( !find( (*iter).first ) )
             {
                 set( (*iter).first, (*iter).second );
             }
@@ -255,6 +261,11 @@ public:
     //! This should be the default "matching" function.
     bool matches( const MetaData &iMetaData ) const
     {
+        if ( m_entries == iMetaData.m_entries )
+        {
+            return true;
+        }
+
         for ( const_iterator iter = iMetaData.begin();
               iter != iMetaData.end(); ++iter )
         {
@@ -270,11 +281,16 @@ public:
     //! in the passed iMetaData, we have either no entry, or the same entry.
     bool matchesOverlap( const MetaData &iMetaData ) const
     {
+        if ( m_entries == iMetaData.m_entries )
+        {
+            return true;
+        }
+
         for ( const_iterator iter = iMetaData.begin();
               iter != iMetaData.end(); ++iter )
         {
-            std::string found = get( (*iter).first );
-            if ( found != "" && found != (*iter).second )
+            const std::string & found = get( (*iter).first );
+            if ( !found.empty() && found != (*iter).second )
             {
                 return false;
             }
@@ -287,11 +303,35 @@ public:
     //! It is for this reason that we explicitly do not overload the == operator.
     bool matchesExactly( const MetaData &iMetaData ) const
     {
-        return m_tokenMap.exactMatch( iMetaData.m_tokenMap );
+        return m_entries == iMetaData.m_entries ||
+            pairs() == iMetaData.pairs();
     }
 
 private:
-    Alembic::Util::TokenMap m_tokenMap;
+
+    // kept sorted by key, hashes[i] is the hash of pairs[i].first
+    struct Entries
+    {
+        std::vector<value_type> pairs;
+        std::vector<Alembic::Util::uint32_t> hashes;
+    };
+
+    typedef Alembic::Util::shared_ptr<Entries> EntriesPtr;
+
+    // the entry for iKey, or NULL if there isn't one
+    const value_type * find( const std::string &iKey ) const;
+
+    const std::vector<value_type> & pairs() const
+    {
+        return m_entries ? m_entries->pairs : emptyPairs();
+    }
+
+    static const std::vector<value_type> & emptyPairs();
+    static const std::string & emptyString();
+
+    // NULL when empty, may be shared with other copies so it is cloned
+    // before it is changed
+    EntriesPtr m_entries;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
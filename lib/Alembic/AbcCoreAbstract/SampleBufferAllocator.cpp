@@ -0,0 +1,116 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/SampleBufferAllocator.h>
+
+#include <string.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+SampleBufferAllocator::~SampleBufferAllocator()
+{
+    // Nothing!
+}
+
+//-*****************************************************************************
+std::size_t SampleBufferAllocator::getNumFreeBytes()
+{
+    return 0;
+}
+
+//-*****************************************************************************
+void SampleBufferAllocator::trim()
+{
+}
+
+//-*****************************************************************************
+namespace {
+
+// gives the data back to the allocator it came from
+struct SampleBufferDeleter
+{
+    SampleBufferDeleter( SampleBufferAllocatorPtr iAllocator,
+                         std::size_t iNumBytes )
+        : allocator( iAllocator ), numBytes( iNumBytes ) {}
+
+    void operator()( ArraySample * iSample ) const
+    {
+        if ( iSample )
+        {
+            allocator->deallocate( const_cast< void * >( iSample->getData() ),
+                                   numBytes );
+        }
+        delete iSample;
+    }
+
+    SampleBufferAllocatorPtr allocator;
+    std::size_t numBytes;
+};
+
+}
+
+//-*****************************************************************************
+ArraySamplePtr AllocateArraySample( const DataType &iDtype,
+                                    const Dimensions &iDims,
+                                    SampleBufferAllocatorPtr iAllocator )
+{
+    PlainOldDataType pod = iDtype.getPod();
+    std::size_t numBytes = iDims.numPoints() * iDtype.getNumBytes();
+
+    // strings have to be constructed, and empty samples have no data
+    if ( !iAllocator || pod == kStringPOD || pod == kWstringPOD ||
+         pod == kUnknownPOD || numBytes == 0 )
+    {
+        return AllocateArraySample( iDtype, iDims );
+    }
+
+    void * data = iAllocator->allocate( numBytes );
+
+    if ( pod == kBooleanPOD )
+    {
+        memset( data, 0, numBytes );
+    }
+
+    ArraySamplePtr ret( new ArraySample( data, iDtype, iDims ),
+                        SampleBufferDeleter( iAllocator, numBytes ) );
+    return ret;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -0,0 +1,100 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreAbstract_SampleBufferAllocator_h
+#define Alembic_AbcCoreAbstract_SampleBufferAllocator_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+#include <Alembic/AbcCoreAbstract/ArraySample.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Where the memory that array samples are read into comes from.  Without
+//! one every sample read is a new[] and a delete[], and reading big samples
+//! over and over, like playing back a heavy mesh, keeps handing the same
+//! sized buffers back and forth with the system.  An allocator can hold
+//! onto buffers which are given back and hand them out again instead.
+//! Allocators can be shared amongst separate archives, and so may be called
+//! from many threads at once.
+class ALEMBIC_EXPORT SampleBufferAllocator
+    : private Alembic::Util::noncopyable
+{
+public:
+    //! Virtual destructor
+    //! ...
+    virtual ~SampleBufferAllocator();
+
+    //! Returns at least iNumBytes of memory, aligned for any POD.
+    //! iNumBytes is never 0.
+    virtual void * allocate( std::size_t iNumBytes ) = 0;
+
+    //! Gives back what allocate returned, iNumBytes is what was asked for.
+    virtual void deallocate( void * iBuffer, std::size_t iNumBytes ) = 0;
+
+    //! How many bytes are being held onto which aren't in use.
+    //! The default implementation returns 0.
+    virtual std::size_t getNumFreeBytes();
+
+    //! Gives back to the system everything that isn't in use.
+    //! The default implementation does nothing.
+    virtual void trim();
+};
+
+//-*****************************************************************************
+typedef Alembic::Util::shared_ptr<SampleBufferAllocator>
+    SampleBufferAllocatorPtr;
+
+//-*****************************************************************************
+//! Like AllocateArraySample, but the data of samples of anything but strings
+//! comes from iAllocator, which is held onto by the returned sample until it
+//! goes away.  The data isn't initialized, except for booleans which are all
+//! false.  A NULL iAllocator is the same as calling AllocateArraySample.
+ALEMBIC_EXPORT ArraySamplePtr
+AllocateArraySample( const DataType &iDtype,
+                     const Dimensions &iDims,
+                     SampleBufferAllocatorPtr iAllocator );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
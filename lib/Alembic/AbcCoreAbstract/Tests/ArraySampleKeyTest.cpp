@@ -0,0 +1,124 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Murmur3.h>
+
+#include "Assert.h"
+
+#include <string>
+#include <vector>
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void testStringKeys()
+{
+    // digests from before the strings were streamed into the hash, these must
+    // never change since they are stored in and compared across archives
+    std::string strs[3] = { "hello", "", "world!" };
+    AbcA::ArraySample strSamp( strs, AbcA::DataType( kStringPOD, 1 ),
+                               Dimensions( 3 ) );
+    AbcA::ArraySample::Key k = strSamp.getKey();
+    TESTING_ASSERT( k.digest.words[0] == 0xeb666b38005e7266ULL );
+    TESTING_ASSERT( k.digest.words[1] == 0xf3268a8accd4aa90ULL );
+    TESTING_ASSERT( k == strSamp.getKey( AbcA::kChunkedMurmur3Digest ) );
+
+    std::wstring wstrs[3] = { L"hello", L"", L"world! wide strings" };
+    AbcA::ArraySample wstrSamp( wstrs, AbcA::DataType( kWstringPOD, 1 ),
+                                Dimensions( 3 ) );
+    k = wstrSamp.getKey();
+    TESTING_ASSERT( k.digest.words[0] == 0xb1a544b175546893ULL );
+    TESTING_ASSERT( k.digest.words[1] == 0xdb76b79060638dd5ULL );
+    TESTING_ASSERT( k == wstrSamp.getKey( AbcA::kChunkedMurmur3Digest ) );
+
+    // long enough to need more than one internal buffer of characters
+    std::vector< std::wstring > longWstrs( 50, std::wstring( 99, L'x' ) );
+    longWstrs[49][98] = L'y';
+    AbcA::ArraySample longSamp( longWstrs.data(),
+                                AbcA::DataType( kWstringPOD, 1 ),
+                                Dimensions( longWstrs.size() ) );
+
+    std::vector< int32_t > chars;
+    for ( size_t i = 0; i < longWstrs.size(); ++i )
+    {
+        chars.insert( chars.end(), longWstrs[i].begin(), longWstrs[i].end() );
+        chars.push_back( 0 );
+    }
+
+    // only the first (number of characters) bytes have ever been hashed
+    Digest expected;
+    MurmurHash3_x64_128( chars.data(), chars.size(), sizeof( int32_t ),
+                         expected.words );
+    TESTING_ASSERT( longSamp.getKey().digest == expected );
+}
+
+//-*****************************************************************************
+void testChunkedKeys()
+{
+    AbcA::DataType f32( kFloat32POD, 3 );
+
+    std::vector< float32_t > small( 3 * 1000, 0.5f );
+    AbcA::ArraySample smallSamp( small.data(), f32, Dimensions( 1000 ) );
+    TESTING_ASSERT( smallSamp.getKey() ==
+                    smallSamp.getKey( AbcA::kChunkedMurmur3Digest ) );
+
+    size_t numPoints = 3 * MURMUR3_CHUNK_SIZE / 12 + 7;
+    std::vector< float32_t > big( 3 * numPoints );
+    for ( size_t i = 0; i < big.size(); ++i )
+    {
+        big[i] = float32_t( i );
+    }
+    AbcA::ArraySample bigSamp( big.data(), f32, Dimensions( numPoints ) );
+    AbcA::ArraySample::Key k = bigSamp.getKey( AbcA::kChunkedMurmur3Digest );
+    TESTING_ASSERT( k.numBytes == big.size() * sizeof( float32_t ) );
+    TESTING_ASSERT( !( k == bigSamp.getKey() ) );
+
+    std::vector< float32_t > bigCopy( big );
+    AbcA::ArraySample copySamp( bigCopy.data(), f32, Dimensions( numPoints ) );
+    TESTING_ASSERT( k == copySamp.getKey( AbcA::kChunkedMurmur3Digest ) );
+
+    bigCopy[ bigCopy.size() / 2 ] += 1.0f;
+    TESTING_ASSERT( !( k == copySamp.getKey( AbcA::kChunkedMurmur3Digest ) ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testStringKeys();
+    testChunkedKeys();
+    return 0;
+}
@@ -0,0 +1,117 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+
+#include "Assert.h"
+
+#include <string>
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+void testSerialize()
+{
+    AbcA::MetaData md;
+    md.deserialize( "schema=AbcGeom_PolyMesh_v1;a=1;a=2;empty=;noAssign;z=3" );
+
+    // the first of any repeated keys wins, anything after a pair without an
+    // assignment is dropped, and iteration is in key order
+    TESTING_ASSERT( md.size() == 3 );
+    TESTING_ASSERT( md.get( "a" ) == "1" );
+    TESTING_ASSERT( md.get( "empty" ) == "" );
+    TESTING_ASSERT( md.get( "z" ) == "" );
+    TESTING_ASSERT( md.begin()->first == "a" );
+    TESTING_ASSERT( md.rbegin()->first == "schema" );
+    TESTING_ASSERT( md.serialize() == "a=1;schema=AbcGeom_PolyMesh_v1" );
+
+    AbcA::MetaData copy;
+    copy.deserialize( md.serialize() );
+    TESTING_ASSERT( copy.matches( md ) );
+    TESTING_ASSERT( !copy.matchesExactly( md ) );
+    copy.set( "empty", "" );
+    TESTING_ASSERT( copy.matchesExactly( md ) );
+
+    md.set( "bad", "x;y" );
+    TESTING_ASSERT_THROW( md.serialize(), Alembic::Util::Exception );
+
+    AbcA::MetaData empty;
+    empty.deserialize( "" );
+    TESTING_ASSERT( empty.size() == 0 );
+    TESTING_ASSERT( empty.begin() == empty.end() );
+    TESTING_ASSERT( empty.serialize() == "" );
+    TESTING_ASSERT( empty.get( "a" ) == "" );
+}
+
+//-*****************************************************************************
+void testCopies()
+{
+    AbcA::MetaData md;
+    md.set( "schema", "AbcGeom_Xform_v3" );
+    md.set( "schemaObjTitle", "AbcGeom_Xform_v3:.xform" );
+
+    AbcA::MetaData copy( md );
+    const std::string & schema = md.get( "schema" );
+
+    // changing a copy doesn't touch the original, or references into it
+    copy.set( "schema", "AbcGeom_PolyMesh_v1" );
+    copy.setUnique( "interpretation", "point" );
+    TESTING_ASSERT( schema == "AbcGeom_Xform_v3" );
+    TESTING_ASSERT( md.size() == 2 );
+    TESTING_ASSERT( copy.size() == 3 );
+    TESTING_ASSERT( copy.get( "schema" ) == "AbcGeom_PolyMesh_v1" );
+    TESTING_ASSERT( !md.matches( copy ) );
+    TESTING_ASSERT( md.matchesOverlap( AbcA::MetaData() ) );
+
+    TESTING_ASSERT_THROW( copy.setUnique( "interpretation", "vector" ),
+                          Alembic::Util::Exception );
+    TESTING_ASSERT_THROW( copy.getRequired( "missing" ),
+                          Alembic::Util::Exception );
+
+    AbcA::MetaData appended;
+    appended.append( md );
+    appended.appendOnlyUnique( copy );
+    TESTING_ASSERT( appended.get( "schema" ) == "AbcGeom_Xform_v3" );
+    TESTING_ASSERT( appended.get( "interpretation" ) == "point" );
+    TESTING_ASSERT( md.size() == 2 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testSerialize();
+    testCopies();
+    return 0;
+}
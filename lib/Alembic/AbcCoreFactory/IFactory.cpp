@@ -52,6 +52,7 @@ IFactory::IFactory()
     m_cacheHierarchy = true;
     m_numStreams = 1;
     m_readStrategy = kMemoryMappedFiles;
+    m_blockCacheBytes = 0;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
 }
 
@@ -64,9 +65,21 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
 {
 
     // try Ogawa first, use kQuietNoop at first in case we fail
+    Alembic::Ogawa::ReadStrategy strategy = Alembic::Ogawa::kMemoryMappedReads;
+    if ( m_readStrategy == kFileStreams )
+    {
+        strategy = Alembic::Ogawa::kFileReads;
+    }
+    else if ( m_readStrategy == kDirectIO )
+    {
+        strategy = Alembic::Ogawa::kDirectReads;
+    }
+
     Alembic::AbcCoreOgawa::ReadArchive ogawa(
-        m_numStreams,
-        m_readStrategy == kMemoryMappedFiles);
+        m_numStreams, strategy,
+        m_readStrategy == kMemoryMappedViews);
+    ogawa.setBlockCacheSize( m_blockCacheBytes );
+    ogawa.setSampleBufferAllocator( m_sampleBufferAllocator );
     Alembic::Abc::IArchive archive( ogawa, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
 
@@ -167,6 +180,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
 {
     // Ogawa is the only one which can do this
     Alembic::AbcCoreOgawa::ReadArchive ogawa( iStreams );
+    ogawa.setSampleBufferAllocator( m_sampleBufferAllocator );
     Alembic::Abc::IArchive archive( ogawa, "", m_policy, m_cachePtr );
     if ( archive.valid() )
     {
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreFactory_IFactory_h
 
 #include <Alembic/AbcCoreAbstract/ReadArraySampleCache.h>
+#include <Alembic/AbcCoreAbstract/SampleBufferAllocator.h>
 #include <Alembic/Abc/IArchive.h>
 #include <Alembic/Util/Export.h>
 
@@ -99,7 +100,9 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
-    //! Set the array sample cache, the HDF5 implementation optionally uses this
+    //! Set the array sample cache, used by both the Ogawa and HDF5
+    //! implementations when set.  AbcCoreOgawa::CreateCache makes one with
+    //! a byte budget which is safe to share between threads.
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
     {
@@ -112,6 +115,23 @@ public:
         return m_cachePtr;
     }
 
+    //! Set the allocator array samples are read into when reading Ogawa
+    //! files.  AbcCoreOgawa::CreateSampleBufferPool makes one which keeps
+    //! buffers to use again and is safe to share between threads.
+    //! The default is NULL, which allocates every sample with new[].
+    void setSampleBufferAllocator(
+        Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr iAllocator )
+    {
+        m_sampleBufferAllocator = iAllocator;
+    }
+
+    //! Get the sample buffer allocator
+    Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr
+    getSampleBufferAllocator() const
+    {
+        return m_sampleBufferAllocator;
+    }
+
     //! Gets the number of streams that will be opened when opening an Ogawa
     //! file
     size_t getOgawaNumStreams() const { return m_numStreams; }
@@ -123,10 +143,20 @@ public:
         m_numStreams = iNumStreams;
     }
 
+    //! kMemoryMappedViews memory maps the file like kMemoryMappedFiles, but
+    //! array samples which don't need converting or decoding point straight
+    //! into the mapping instead of being copied.  The data of those samples
+    //! is read only.
+    //! kDirectIO reads large blocks of data without going through the
+    //! operating system's file cache (O_DIRECT or F_NOCACHE) so streaming
+    //! through huge files doesn't evict other cached data.  Small reads and
+    //! platforms without direct I/O behave like kFileStreams.
     enum OgawaReadStrategy
     {
         kFileStreams,
-        kMemoryMappedFiles
+        kMemoryMappedFiles,
+        kMemoryMappedViews,
+        kDirectIO
     };
 
     //! Get the I/O strategy used for reading Ogawa files.
@@ -140,6 +170,18 @@ public:
     }
 
 
+    //! Gets the most memory used per Ogawa archive to keep blocks of the
+    //! file around for small reads, when the file isn't memory mapped.
+    size_t getOgawaBlockCacheSize() const { return m_blockCacheBytes; }
+
+    //! Sets the most memory used per Ogawa archive to keep blocks of the
+    //! file around for small reads (headers, sizes and other metadata) when
+    //! the file isn't memory mapped.  The default is 0, which turns it off.
+    void setOgawaBlockCacheSize( size_t iMaxBytes )
+    {
+        m_blockCacheBytes = iMaxBytes;
+    }
+
     //! Gets the error handler policy
     Alembic::Abc::ErrorHandler::Policy getPolicy() { return m_policy; }
 
@@ -153,7 +195,9 @@ private:
     bool m_cacheHierarchy;
     size_t m_numStreams;
     OgawaReadStrategy m_readStrategy;
+    size_t m_blockCacheBytes;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
+    Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr m_sampleBufferAllocator;
     Alembic::Abc::ErrorHandler::Policy m_policy;
 
 };
@@ -35,6 +35,8 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/AprImpl.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+#include <Alembic/AbcCoreOgawa/Compression.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
@@ -104,14 +106,250 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+    StreamIDPtr streamId = archive->getStreamID();
 
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+
+    AbcA::ReadArraySampleCachePtr cachePtr =
+        archive->getReadArraySampleCachePtr();
+
+    // empty samples have no key or data to point at, so just read them
+    if ( !data || data->getSize() <= 16 ||
+         ( !cachePtr && !archive->useMappedViews() ) )
+    {
+        ReadArraySample( dims, data, id, dataType, oSample,
+                         m_header->isEncoded,
+                         archive->getSampleBufferAllocator() );
+        return;
+    }
+
+    Util::Dimensions dimensions;
+    ReadDimensions( dims, data, id, dataType, dimensions,
+                    m_header->isEncoded );
+
+    // views into the memory mapped file cost nothing, so they aren't cached
+    if ( archive->useMappedViews() && MapArraySample( data, dataType,
+            dimensions, oSample, m_header->isEncoded ) )
+    {
+        return;
+    }
+
+    AbcA::ArraySample::Key key;
+    if ( cachePtr )
+    {
+        getKey( iSampleIndex, key );
+
+        // the stored digest only covers the data, mix in the extent and the
+        // dimensions so samples with the same data but a different shape
+        // don't share the same cache entry
+        Util::SpookyHash hash;
+        hash.Init( 0, 0 );
+        hash.Update( key.digest.d, 16 );
+        Util::uint8_t extent = dataType.getExtent();
+        hash.Update( &extent, 1 );
+        if ( dimensions.rank() > 0 )
+        {
+            hash.Update( dimensions.rootPtr(), dimensions.rank() * 8 );
+        }
+        Util::uint64_t hash0, hash1;
+        hash.Final( &hash0, &hash1 );
+        key.digest.words[0] = hash0;
+        key.digest.words[1] = hash1;
+
+        AbcA::ReadArraySampleID found = cachePtr->find( key );
+        if ( found )
+        {
+            oSample = found.getSample();
+            return;
+        }
+    }
+
+    AbcA::ArraySamplePtr sample = AbcA::AllocateArraySample( dataType,
+        dimensions, archive->getSampleBufferAllocator() );
+    size_t numPODs = dimensions.numPoints() * dataType.getExtent();
+    ReadData( const_cast<void*>( sample->getData() ), data, id, dataType,
+              dataType.getPod(), numPODs, m_header->isEncoded );
+
+    if ( cachePtr )
+    {
+        // our own cache remembers which archive the sample came from
+        CacheImpl * cache = dynamic_cast< CacheImpl * >( cachePtr.get() );
+        oSample = ( cache ? cache->store( key, sample, archive.get() ) :
+                    cachePtr->store( key, sample ) ).getSample();
+    }
+    else
+    {
+        oSample = sample;
+    }
+}
+
+//-*****************************************************************************
+namespace {
+
+// filled in by a task on the global thread pool
+class SampleRequest : public AbcA::ArraySampleRequest
+{
+public:
+    SampleRequest( std::size_t iNumSamples )
+      : m_samples( iNumSamples ), m_ready( false ) {}
+
+    virtual std::size_t getNumSamples() const { return m_samples.size(); }
+
+    virtual bool isReady()
+    {
+        std::lock_guard< std::mutex > l( m_lock );
+        return m_ready;
+    }
+
+    virtual void wait()
+    {
+        std::unique_lock< std::mutex > l( m_lock );
+        while ( !m_ready )
+        {
+            m_done.wait( l );
+        }
+
+        if ( m_error )
+        {
+            std::rethrow_exception( m_error );
+        }
+    }
+
+    virtual AbcA::ArraySamplePtr getSample( std::size_t iIndex )
+    {
+        wait();
+        ABCA_ASSERT( iIndex < m_samples.size(),
+                     "Invalid request index: " << iIndex );
+        return m_samples[iIndex];
+    }
+
+    // only touched by the reading task until it calls finish
+    std::vector< AbcA::ArraySamplePtr > & samples() { return m_samples; }
+
+    void finish( std::exception_ptr iError )
+    {
+        {
+            std::lock_guard< std::mutex > l( m_lock );
+            m_error = iError;
+            m_ready = true;
+        }
+        m_done.notify_all();
+    }
+
+private:
+    std::vector< AbcA::ArraySamplePtr > m_samples;
+    std::exception_ptr m_error;
+    bool m_ready;
+    std::mutex m_lock;
+    std::condition_variable m_done;
+};
+
+}
+
+//-*****************************************************************************
+AbcA::ArraySampleRequestPtr
+AprImpl::requestSamples( const std::vector< index_t > & iSampleIndices )
+{
+    // throw for bad indices now instead of when waiting
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        m_header->verifyIndex( iSampleIndices[i] );
+    }
+
+    Alembic::Util::shared_ptr< SampleRequest > request(
+        new SampleRequest( iSampleIndices.size() ) );
+
+    if ( iSampleIndices.empty() )
+    {
+        request->finish( std::exception_ptr() );
+        return request;
+    }
+
+    // hold onto ourselves, and so the archive, until the samples are read
+    Alembic::Util::shared_ptr< AprImpl > self = shared_from_this();
+    Util::ThreadPool::global().push( [self, request, iSampleIndices]()
+    {
+        std::exception_ptr error;
+        try
+        {
+            self->readSamples( iSampleIndices, request->samples() );
+        }
+        catch ( ... )
+        {
+            error = std::current_exception();
+        }
+        request->finish( error );
+    } );
+
+    return request;
+}
+
+//-*****************************************************************************
+void AprImpl::readSamples( const std::vector< index_t > & iSampleIndices,
+                           std::vector< AbcA::ArraySamplePtr > & oSamples )
+{
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+    StreamIDPtr streamId = archive->getStreamID();
+    std::size_t id = streamId->getID();
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    Util::PlainOldDataType pod = dataType.getPod();
+
+    // caching, memory mapped views, decoding and strings are all left to
+    // getSample
+    bool useGetSample = archive->getReadArraySampleCachePtr() ||
+        archive->useMappedViews() || m_header->isEncoded ||
+        pod == Util::kStringPOD || pod == Util::kWstringPOD;
+
+    AbcA::SampleBufferAllocatorPtr allocator =
+        archive->getSampleBufferAllocator();
+
+    std::vector< Ogawa::IDataRead > reads;
+    for ( std::size_t i = 0; i < iSampleIndices.size(); ++i )
+    {
+        size_t index = m_header->verifyIndex( iSampleIndices[i] ) * 2;
+        Ogawa::IDataPtr data = m_group->getData( index, id );
+
+        if ( useGetSample || !data || data->getSize() <= 16 )
+        {
+            getSample( iSampleIndices[i], oSamples[i] );
+            continue;
+        }
+
+        Ogawa::IDataPtr dims = m_group->getData( index + 1, id );
+        Util::Dimensions dimensions;
+        ReadDimensions( dims, data, id, dataType, dimensions );
+
+        // misshaped data
+        Util::uint64_t numBytes = data->getSize() - 16;
+        if ( dimensions.numPoints() * dataType.getNumBytes() != numBytes )
+        {
+            getSample( iSampleIndices[i], oSamples[i] );
+            continue;
+        }
+
+        oSamples[i] = AbcA::AllocateArraySample( dataType, dimensions,
+                                                 allocator );
+
+        // don't read the key
+        Ogawa::IDataRead read;
+        read.data = data;
+        read.size = numBytes;
+        read.buf = const_cast<void*>( oSamples[i]->getData() );
+        read.offset = 16;
+        reads.push_back( read );
+    }
+
+    Ogawa::ReadBatch( reads, id );
 }
 
 //-*****************************************************************************
@@ -153,7 +391,12 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
 
     if ( data )
     {
-        if ( data->getSize() >= 16 )
+        if ( data->getSize() > 16 && m_header->isEncoded )
+        {
+            oKey.numBytes = ReadEncodedSize( data, id );
+            data->read( 16, oKey.digest.d, 0, id );
+        }
+        else if ( data->getSize() >= 16 )
         {
             oKey.numBytes = data->getSize() - 16;
             data->read( 16, oKey.digest.d, 0, id );
@@ -165,6 +408,19 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     return false;
 }
 
+//-*****************************************************************************
+Ogawa::IDataPtr AprImpl::getSampleData( index_t iSampleIndex,
+                                        StreamIDPtr & oStreamID )
+{
+    // * 2 for Array properties (since we also write the dimensions)
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    oStreamID = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    return m_group->getData( index, oStreamID->getID() );
+}
+
 //-*****************************************************************************
 bool AprImpl::isScalarLike()
 {
@@ -184,7 +440,8 @@ void AprImpl::getDimensions( index_t iSampleIndex,
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim,
+                    m_header->isEncoded );
 
 }
 
@@ -200,7 +457,7 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr data = m_group->getData( index, id );
     ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod,
-        SIZE_MAX );
+        SIZE_MAX, m_header->isEncoded );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_AprImpl_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/StreamManager.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -73,9 +74,24 @@ public:
     virtual bool isScalarLike();
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
+    virtual AbcA::ArraySampleRequestPtr
+    requestSamples( const std::vector< index_t > & iSampleIndices );
+
+    // for copying samples to another Ogawa archive without decoding them
+    bool isEncoded() const { return m_header->isEncoded; }
+
+    // the stored key and data of a sample, oStreamID has to be kept while
+    // reading it
+    Ogawa::IDataPtr getSampleData( index_t iSampleIndex,
+                                   StreamIDPtr & oStreamID );
 
 private:
 
+    // reads the samples for requestSamples, merging the reads of those
+    // which can be read straight into a new sample
+    void readSamples( const std::vector< index_t > & iSampleIndices,
+                      std::vector< AbcA::ArraySamplePtr > & oSamples );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
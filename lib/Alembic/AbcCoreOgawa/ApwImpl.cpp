@@ -35,9 +35,12 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
@@ -48,7 +51,8 @@ ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   PropertyHeaderPtr iHeader,
                   size_t iIndex ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ), m_dims( 1 ),
-    m_index( iIndex )
+    m_index( iIndex ), m_compressionHint( -1 ),
+    m_digestAlgorithm( AbcA::kMurmur3Digest )
 {
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_header, "Invalid property header" );
@@ -67,9 +71,6 @@ ApwImpl::~ApwImpl()
 {
     AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
 
-    index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex );
-
     Util::uint32_t numSamples = m_header->nextSampleIndex;
 
     // a constant property, we wrote the same sample over and over
@@ -78,11 +79,7 @@ ApwImpl::~ApwImpl()
         numSamples = 1;
     }
 
-    if ( maxSamples < numSamples )
-    {
-        archive->setMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex, numSamples );
-    }
+    UpdateMaxNumSamples( archive, m_header->timeSamplingIndex, numSamples );
 
     Util::SpookyHash hash;
     hash.Init(0, 0);
@@ -118,7 +115,7 @@ void ApwImpl::setFromPreviousSample()
     ABCA_ASSERT( m_header->nextSampleIndex > 0,
         "Can't set from previous sample before any samples have been written" );
 
-    Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
+    Util::Digest digest = m_previousWrittenSampleID.getKey().digest;
     HashDimensions( m_dims, digest );
     Util::SpookyHash::ShortEnd(m_hash.words[0], m_hash.words[1],
                               digest.words[0], digest.words[1]);
@@ -128,6 +125,87 @@ void ApwImpl::setFromPreviousSample()
 
 //-*****************************************************************************
 void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
+{
+    writeSample( iSamp, NULL );
+}
+
+//-*****************************************************************************
+void ApwImpl::setSampleWithKey( const AbcA::ArraySample & iSamp,
+                                const AbcA::ArraySampleKey & iKey )
+{
+    writeSample( iSamp, &iKey );
+}
+
+//-*****************************************************************************
+bool ApwImpl::copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                          index_t iSampleIndex )
+{
+    checkNumSamples();
+
+    AprImpl * reader = dynamic_cast< AprImpl * >( iReader.get() );
+    if ( !reader ||
+         reader->getHeader().getDataType() != m_header->header.getDataType() )
+    {
+        return false;
+    }
+
+    // once written, all the samples of a property have to be encoded the
+    // same way
+    if ( m_header->nextSampleIndex > 0 &&
+         reader->isEncoded() != m_header->isEncoded )
+    {
+        return false;
+    }
+
+    // and the stored digest has to be the one we would have computed
+    AbcA::DigestAlgorithm digestAlgorithm = m_digestAlgorithm;
+    if ( m_header->nextSampleIndex == 0 )
+    {
+        digestAlgorithm = getObject()->getArchive()->getDigestAlgorithm();
+    }
+
+    bool readChunked = reader->getObject()->getArchive()->getMetaData().get(
+        "_ai_DigestAlgorithm" ) == "Murmur3Chunked";
+    if ( readChunked != ( digestAlgorithm == AbcA::kChunkedMurmur3Digest ) )
+    {
+        return false;
+    }
+
+    StreamIDPtr streamId;
+    Ogawa::IDataPtr data = reader->getSampleData( iSampleIndex, streamId );
+
+    // empty samples are the empty data, anything else has to at least
+    // have its key
+    if ( !data || ( data->getSize() > 0 && data->getSize() < 16 ) )
+    {
+        return false;
+    }
+
+    AbcA::Dimensions dims;
+    reader->getDimensions( iSampleIndex, dims );
+
+    initDigestAlgorithm();
+
+    AbcA::ArraySample::Key key;
+    key.numBytes = m_header->header.getDataType().getNumBytes() *
+        dims.numPoints();
+    key.origPOD = m_header->header.getDataType().getPod();
+    key.readPOD = key.origPOD;
+    if ( data->getSize() > 0 )
+    {
+        data->read( 16, key.digest.d, 0, streamId->getID() );
+    }
+
+    RawSample raw;
+    raw.data = data;
+    raw.threadId = streamId->getID();
+    raw.isEncoded = reader->isEncoded();
+    addSample( key, dims, NULL, &raw );
+    return true;
+}
+
+//-*****************************************************************************
+void ApwImpl::checkNumSamples()
 {
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -137,14 +215,70 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         m_header->nextSampleIndex,
         "Can not write more samples than we have times for when using "
         "Acyclic sampling." );
+}
+
+//-*****************************************************************************
+void ApwImpl::initDigestAlgorithm()
+{
+    // all the samples of a property are hashed the same way, so grab
+    // the digest algorithm when we get our first one
+    if ( m_header->nextSampleIndex == 0 )
+    {
+        AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+        m_digestAlgorithm = awp->getDigestAlgorithm();
+        if ( m_digestAlgorithm == AbcA::kChunkedMurmur3Digest )
+        {
+            SetHasChunkedDigests( awp );
+        }
+    }
+}
+
+//-*****************************************************************************
+void ApwImpl::writeSample( const AbcA::ArraySample & iSamp,
+                           const AbcA::ArraySampleKey * iKey )
+{
+    checkNumSamples();
 
     ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
         "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
         ", does not match the DataType of the Array property: " <<
         m_header->header.getDataType() );
 
+    initDigestAlgorithm();
+
     // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = iSamp.getKey();
+    // A key from the caller only provides the digest, the rest is cheap
+    // to work out and may have come from a differently stored sample.
+    AbcA::ArraySample::Key key;
+    if ( iKey )
+    {
+        key.numBytes = iSamp.getDataType().getNumBytes() *
+            iSamp.getDimensions().numPoints();
+        key.origPOD = iSamp.getDataType().getPod();
+        key.readPOD = key.origPOD;
+        key.digest = iKey->digest;
+
+#ifndef NDEBUG
+        ABCA_ASSERT( key == iSamp.getKey( m_digestAlgorithm ),
+                     "The key given for the sample does not match it." );
+#endif
+    }
+    else
+    {
+        key = iSamp.getKey( m_digestAlgorithm );
+    }
+
+    addSample( key, iSamp.getDimensions(), &iSamp, NULL );
+}
+
+//-*****************************************************************************
+void ApwImpl::addSample( const AbcA::ArraySample::Key & iKey,
+                         const AbcA::Dimensions & iDims,
+                         const AbcA::ArraySample * iSamp,
+                         const RawSample * iRaw )
+{
+    AbcA::ArraySample::Key key = iKey;
+    Util::PlainOldDataType pod = m_header->header.getDataType().getPod();
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -159,8 +293,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 
     // We need to write the sample
     if ( m_header->nextSampleIndex == 0  ||
-         !( m_previousWrittenSampleID &&
-            key == m_previousWrittenSampleID->getKey() ) )
+         key != m_previousWrittenSampleID.getKey() )
     {
 
         // we only need to repeat samples if this is not the first change
@@ -172,8 +305,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
-                WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                WriteDimensions( m_group, m_dims, pod );
             }
         }
 
@@ -181,13 +313,49 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         // cache of what the previously written sample was.
         AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
 
+        // all the samples of a property are written the same way, so grab
+        // the compression hint when we write our first one
+        if ( m_header->nextSampleIndex == 0 )
+        {
+            m_compressionHint = awp->getCompressionHint();
+
+            // copied samples stay the way they were written
+            if ( iRaw && iRaw->isEncoded )
+            {
+                m_compressionHint = std::max( m_compressionHint,
+                                              Util::int8_t( 0 ) );
+            }
+            else if ( iRaw )
+            {
+                m_compressionHint = -1;
+            }
+
+            if ( m_compressionHint >= 0 )
+            {
+                m_header->isEncoded = true;
+                SetHasEncodedSamples( awp );
+            }
+        }
+
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( iRaw )
+        {
+            m_previousWrittenSampleID =
+                CopyRawData( GetWrittenSampleMap( awp ), m_group, iRaw->data,
+                             iRaw->threadId, key, m_header->isEncoded,
+                             m_header->header.getDataType().getExtent() *
+                             iDims.numPoints() );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, *iSamp, key,
+                           m_compressionHint );
+        }
 
-        m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        m_dims = iDims;
+        WriteDimensions( m_group, m_dims, pod );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
@@ -195,9 +363,9 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             m_header->isScalarLike = false;
         }
 
-        if ( m_header->isHomogenous && m_previousWrittenSampleID &&
+        if ( m_header->isHomogenous &&
              m_dims.numPoints() !=
-             m_previousWrittenSampleID->getNumPoints() )
+             m_previousWrittenSampleID.getNumPoints() )
         {
             m_header->isHomogenous = false;
         }
@@ -211,7 +379,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         m_header->lastChangedIndex = m_header->nextSampleIndex;
     }
 
-    Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
+    Util::Digest digest = m_previousWrittenSampleID.getKey().digest;
     HashDimensions( m_dims, digest );
     if ( m_header->nextSampleIndex == 0 )
     {
@@ -65,6 +65,10 @@ public:
 
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
+    virtual void setSampleWithKey( const AbcA::ArraySample & iSamp,
+                                   const AbcA::ArraySampleKey & iKey );
+    virtual bool copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                             index_t iSampleIndex );
     virtual void setFromPreviousSample();
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
@@ -76,9 +80,33 @@ public:
 
 protected:
     // Previous written array sample identifier!
-    WrittenSampleIDPtr m_previousWrittenSampleID;
+    WrittenSampleID m_previousWrittenSampleID;
 
 private:
+    // an already written sample, as read from another archive
+    struct RawSample
+    {
+        Ogawa::IDataPtr data;
+        std::size_t threadId;
+        bool isEncoded;
+    };
+
+    // throws if there are no more times for another sample
+    void checkNumSamples();
+
+    // grabs the archives digest algorithm when writing the first sample
+    void initDigestAlgorithm();
+
+    // iKey may be NULL, in which case it is computed from iSamp
+    void writeSample( const AbcA::ArraySample & iSamp,
+                      const AbcA::ArraySampleKey * iKey );
+
+    // adds the next sample, written from iSamp or copied from iRaw
+    void addSample( const AbcA::ArraySample::Key & iKey,
+                    const AbcA::Dimensions & iDims,
+                    const AbcA::ArraySample * iSamp,
+                    const RawSample * iRaw );
+
     // The parent compound property writer.
     AbcA::CompoundPropertyWriterPtr m_parent;
 
@@ -94,6 +122,12 @@ private:
     AbcA::Dimensions m_dims;
 
     size_t m_index;
+
+    // the archives compression hint when the first sample was written
+    Util::int8_t m_compressionHint;
+
+    // the archives digest algorithm when the first sample was written
+    AbcA::DigestAlgorithm m_digestAlgorithm;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
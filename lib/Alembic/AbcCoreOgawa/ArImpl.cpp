@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
 #include <Alembic/AbcCoreOgawa/OrData.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
@@ -46,27 +47,48 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 ArImpl::ArImpl( const std::string &iFileName,
                 std::size_t iNumStreams,
-                bool iUseMMap)
+                Ogawa::ReadStrategy iStrategy,
+                bool iUseMappedViews,
+                std::size_t iBlockCacheBytes,
+                bool iLazyHeaders)
   : m_fileName( iFileName )
-  , m_archive( iFileName, iNumStreams, iUseMMap )
+  , m_archive( iFileName, iNumStreams, iStrategy )
+  , m_readerPool( new ReaderPool() )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iNumStreams )
+  , m_useMappedViews( iStrategy == Ogawa::kMemoryMappedReads &&
+                      iUseMappedViews )
+  , m_lazyHeaders( iLazyHeaders )
+  , m_hierarchyIndexRead( false )
 {
+    m_headerBytes = 0;
+
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
 
     ABCA_ASSERT( m_archive.isFrozen(),
         "Ogawa file not cleanly closed while being written: " << m_fileName );
 
+    // before init so reading the archive's metadata and the top of the
+    // hierarchy can use it too
+    m_archive.setBlockCache( iBlockCacheBytes );
+
     init();
 }
 
 //-*****************************************************************************
-ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
+ArImpl::ArImpl( const std::vector< std::istream * > & iStreams,
+                bool iLazyHeaders )
   : m_archive( iStreams )
+  , m_readerPool( new ReaderPool() )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_useMappedViews( false )
+  , m_lazyHeaders( iLazyHeaders )
+  , m_hierarchyIndexRead( false )
 {
+    m_headerBytes = 0;
+
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
 
@@ -122,13 +144,18 @@ void ArImpl::init()
 
     ReadIndexedMetaData( group->getData( 5, 0 ), m_indexMetaData );
 
-    m_data = Alembic::Util::shared_ptr < OrData >( new OrData(
-        group->getGroup( 2, false, 0 ), "", 0, *this,
-        m_indexMetaData ) );
+    Ogawa::IGroupPtr topGroup = group->getGroup( 2, false, 0 );
+    m_data = MakeReader< OrData >( m_readerPool, topGroup, "", 0, *this,
+                                   m_indexMetaData );
 
     m_header->setName( "ABC" );
     m_header->setFullName( "/" );
 
+    // lookups without the hierarchy index start from here
+    FoundObject & top = m_found[""];
+    top.header = m_header;
+    top.groupPos = topGroup->getPos();
+
     // read archive metadata
     data = group->getData( 3, 0 );
     if ( data->getSize() > 0 )
@@ -161,8 +188,8 @@ AbcA::ObjectReaderPtr ArImpl::getTop()
     if ( ! ret )
     {
         // time to make a new one
-        ret = Alembic::Util::shared_ptr<OrImpl>(
-            new OrImpl( shared_from_this(), m_data, m_header ) );
+        ret = MakeReader< OrImpl >( m_readerPool, shared_from_this(), m_data,
+                                    m_header );
         m_top = ret;
     }
 
@@ -205,6 +232,13 @@ StreamIDPtr ArImpl::getStreamID()
 //-*****************************************************************************
 ArImpl::~ArImpl()
 {
+    // the samples may still be found by other archives sharing the cache,
+    // but they can't be counted or trimmed as ours any more
+    CacheImpl * cache = getCacheImpl();
+    if ( cache )
+    {
+        cache->disown( this );
+    }
 }
 
 //-*****************************************************************************
@@ -213,6 +247,354 @@ const std::vector< AbcA::MetaData > & ArImpl::getIndexedMetaData()
     return m_indexMetaData;
 }
 
+//-*****************************************************************************
+HierarchyIndexPtr ArImpl::getHierarchyIndex()
+{
+    Alembic::Util::scoped_lock l( m_hierarchyIndexLock );
+
+    if ( !m_hierarchyIndexRead )
+    {
+        // the index is the optional 7th child of the root group, older
+        // archives and archives written without it simply won't have it
+        Ogawa::IGroupPtr group = m_archive.getGroup();
+        if ( group->getNumChildren() > 6 && group->isChildData( 6 ) )
+        {
+            StreamIDPtr streamId = getStreamID();
+            std::size_t id = streamId->getID();
+            Ogawa::IDataPtr data = group->getData( 6, id );
+            if ( data && data->getSize() > 0 )
+            {
+                m_hierarchyIndex.reset( new HierarchyIndex( data, id ) );
+            }
+        }
+        m_hierarchyIndexRead = true;
+    }
+
+    return m_hierarchyIndex;
+}
+
+//-*****************************************************************************
+bool ArImpl::findIndexedObject( const std::string & iFullName,
+                                AbcA::ObjectHeader & oHeader,
+                                Util::uint64_t & oGroupPos )
+{
+    HierarchyIndexPtr index = getHierarchyIndex();
+    if ( !index )
+    {
+        return false;
+    }
+
+    std::size_t i = index->find( iFullName );
+    if ( i == index->getNumObjects() )
+    {
+        return false;
+    }
+
+    index->getObject( i, m_indexMetaData, oHeader, oGroupPos );
+    return true;
+}
+
+//-*****************************************************************************
+bool ArImpl::getIndexedObjectHeader( const std::string & iFullName,
+                                     AbcA::ObjectHeader & oHeader )
+{
+    if ( iFullName == "/" )
+    {
+        if ( !getHierarchyIndex() )
+        {
+            return false;
+        }
+
+        oHeader = *m_header;
+        return true;
+    }
+
+    Util::uint64_t groupPos = 0;
+    return findIndexedObject( iFullName, oHeader, groupPos );
+}
+
+//-*****************************************************************************
+bool ArImpl::getIndexedChildHeaders( const std::string & iFullName,
+                                     std::vector< AbcA::ObjectHeader > &
+                                     oHeaders )
+{
+    HierarchyIndexPtr index = getHierarchyIndex();
+    if ( !index )
+    {
+        return false;
+    }
+
+    index->getChildren( iFullName, m_indexMetaData, oHeaders );
+    return true;
+}
+
+//-*****************************************************************************
+bool ArImpl::resolveObject( const std::string & iFullName,
+                            std::size_t iThreadId, FoundObject & oFound )
+{
+    {
+        Alembic::Util::scoped_lock l( m_foundLock );
+        FoundObjectMap::iterator fiter = m_found.find( iFullName );
+        if ( fiter != m_found.end() )
+        {
+            oFound = fiter->second;
+            return true;
+        }
+    }
+
+    HierarchyIndexPtr index = getHierarchyIndex();
+    if ( index )
+    {
+        std::size_t i = index->find( iFullName );
+        if ( i == index->getNumObjects() )
+        {
+            return false;
+        }
+
+        FoundObject found;
+        found.header.reset( new AbcA::ObjectHeader() );
+        index->getObject( i, m_indexMetaData, *found.header, found.groupPos );
+
+        // another thread may have beaten us to it, if so use theirs
+        Alembic::Util::scoped_lock l( m_foundLock );
+        oFound = m_found.insert(
+            FoundObjectMap::value_type( iFullName, found ) ).first->second;
+        return true;
+    }
+
+    // without an index, read the headers of all the parent's children
+    // and remember where each of them is
+    std::string parentName = iFullName.substr( 0, iFullName.rfind( '/' ) );
+    FoundObject parent;
+    if ( !resolveObject( parentName, iThreadId, parent ) )
+    {
+        return false;
+    }
+
+    if ( !parent.childrenRead )
+    {
+        Ogawa::IGroupPtr group = m_archive.getGroup( parent.groupPos, false,
+                                                     iThreadId );
+        std::size_t numChildren = group ? group->getNumChildren() : 0;
+        if ( numChildren < 2 || !group->isChildData( numChildren - 1 ) )
+        {
+            return false;
+        }
+
+        std::vector< ObjectHeaderPtr > headers;
+        ReadObjectHeaders( group, numChildren - 1, iThreadId, parentName,
+                           m_indexMetaData, headers );
+
+        ABCA_ASSERT( headers.size() + 2 <= numChildren,
+                     "Read invalid: Number of children of: " << parentName );
+
+        std::vector< FoundObject > children( headers.size() );
+        for ( std::size_t i = 0; i < headers.size(); ++i )
+        {
+            // light since all we want is where it is
+            Ogawa::IGroupPtr child = group->getGroup( i + 1, true,
+                                                      iThreadId );
+            if ( child )
+            {
+                children[i].header = headers[i];
+                children[i].groupPos = child->getPos();
+            }
+        }
+
+        // the reading above is done without the lock, so only the
+        // inserting here waits on other lookups
+        Alembic::Util::scoped_lock l( m_foundLock );
+        for ( std::size_t i = 0; i < children.size(); ++i )
+        {
+            if ( children[i].header )
+            {
+                m_found.insert( FoundObjectMap::value_type(
+                    children[i].header->getFullName(), children[i] ) );
+            }
+        }
+
+        // trim may have forgotten the parent in the meantime
+        FoundObjectMap::iterator piter = m_found.find( parentName );
+        if ( piter != m_found.end() )
+        {
+            piter->second.childrenRead = true;
+        }
+    }
+
+    Alembic::Util::scoped_lock l( m_foundLock );
+    FoundObjectMap::iterator fiter = m_found.find( iFullName );
+    if ( fiter != m_found.end() )
+    {
+        oFound = fiter->second;
+        return true;
+    }
+
+    return false;
+}
+
+//-*****************************************************************************
+AbcA::ObjectReaderPtr ArImpl::findObject( const std::string & iFullName )
+{
+    // put it in the same form as ObjectHeader::getFullName
+    std::string fullName;
+    std::size_t start = 0;
+    while ( start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            fullName += '/';
+            fullName.append( iFullName, start, end - start );
+        }
+
+        start = end + 1;
+    }
+
+    if ( fullName.empty() )
+    {
+        return getTop();
+    }
+
+    StreamIDPtr streamId = getStreamID();
+    std::size_t id = streamId->getID();
+
+    FoundObject found;
+    if ( !resolveObject( fullName, id, found ) )
+    {
+        return AbcA::ObjectReaderPtr();
+    }
+
+    AbcA::ObjectReaderPtr ret = found.made.lock();
+    if ( ret )
+    {
+        return ret;
+    }
+
+    Ogawa::IGroupPtr group = m_archive.getGroup( found.groupPos, false, id );
+    ABCA_ASSERT( group, "Invalid object group for: " << fullName );
+
+    ret = MakeReader< OrImpl >( m_readerPool, shared_from_this(), group,
+                                found.header );
+
+    // keep the one made by whoever got here first
+    Alembic::Util::scoped_lock l( m_foundLock );
+    FoundObject & stored =
+        m_found.insert( FoundObjectMap::value_type( fullName, found ) )
+            .first->second;
+    AbcA::ObjectReaderPtr other = stored.made.lock();
+    if ( other )
+    {
+        return other;
+    }
+
+    stored.made = ret;
+    return ret;
+}
+
+//-*****************************************************************************
+void ArImpl::getMemoryUsage( AbcA::MemoryUsage & oUsage )
+{
+    oUsage = AbcA::MemoryUsage();
+
+    oUsage.headers = m_headerBytes;
+
+    {
+        Alembic::Util::scoped_lock l( m_hierarchyIndexLock );
+        if ( m_hierarchyIndex )
+        {
+            oUsage.headers += m_hierarchyIndex->getNumBytes();
+        }
+    }
+
+    {
+        Alembic::Util::scoped_lock l( m_foundLock );
+        FoundObjectMap::iterator it = m_found.begin();
+        for ( ; it != m_found.end(); ++it )
+        {
+            // the top header is counted with the archive metadata
+            if ( !it->first.empty() )
+            {
+                oUsage.headers += sizeof( FoundObjectMap::value_type ) +
+                    4 * sizeof( void * ) + it->first.capacity() +
+                    HeaderBytes( *( it->second.header ) );
+            }
+        }
+    }
+
+    for ( std::size_t i = 0; i < m_indexMetaData.size(); ++i )
+    {
+        oUsage.metaData += sizeof( AbcA::MetaData ) +
+            m_indexMetaData[i].serialize().size();
+    }
+    oUsage.metaData += sizeof( AbcA::ObjectHeader ) +
+        m_header->getMetaData().serialize().size();
+
+    CacheImpl * cache = getCacheImpl();
+    if ( cache )
+    {
+        oUsage.samples = cache->getNumBytes( this );
+    }
+
+    if ( m_sampleBufferAllocator )
+    {
+        oUsage.samples += m_sampleBufferAllocator->getNumFreeBytes();
+    }
+
+    for ( std::size_t i = 0; i < m_timeSamples.size(); ++i )
+    {
+        oUsage.timeSamplings += sizeof( AbcA::TimeSampling ) +
+            sizeof( AbcA::TimeSamplingPtr ) + sizeof( AbcA::index_t ) +
+            m_timeSamples[i]->getStoredTimes().size() * sizeof( chrono_t );
+    }
+
+    oUsage.streams = m_archive.getBlockCacheBytes();
+
+    oUsage.readers = m_readerPool->getNumBytes();
+}
+
+//-*****************************************************************************
+CacheImpl * ArImpl::getCacheImpl() const
+{
+    return dynamic_cast< CacheImpl * >( m_readArraySampleCache.get() );
+}
+
+//-*****************************************************************************
+void ArImpl::trim()
+{
+    m_archive.clearBlockCache();
+
+    CacheImpl * cache = getCacheImpl();
+    if ( cache )
+    {
+        cache->clear( this );
+    }
+
+    if ( m_sampleBufferAllocator )
+    {
+        m_sampleBufferAllocator->trim();
+    }
+
+    // both of these get read again if they are needed
+    {
+        Alembic::Util::scoped_lock l( m_foundLock );
+        FoundObject top = m_found[""];
+        top.childrenRead = false;
+        m_found.clear();
+        m_found[""] = top;
+    }
+
+    {
+        Alembic::Util::scoped_lock l( m_hierarchyIndexLock );
+        m_hierarchyIndex.reset();
+        m_hierarchyIndexRead = false;
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
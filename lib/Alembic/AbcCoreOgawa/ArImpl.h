@@ -39,6 +39,10 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/HierarchyIndex.h>
+#include <Alembic/AbcCoreOgawa/ReaderPool.h>
+
+#include <atomic>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -46,6 +50,7 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 class OrData;
+class CacheImpl;
 
 //-*****************************************************************************
 class ArImpl
@@ -57,9 +62,13 @@ private:
 
     ArImpl( const std::string &iFileName,
             size_t iNumStreams=1,
-            bool iUseMMap=true);
+            Ogawa::ReadStrategy iStrategy=Ogawa::kMemoryMappedReads,
+            bool iUseMappedViews=false,
+            std::size_t iBlockCacheBytes=0,
+            bool iLazyHeaders=false);
 
-    ArImpl( const std::vector< std::istream * > & iStreams );
+    ArImpl( const std::vector< std::istream * > & iStreams,
+            bool iLazyHeaders=false );
 
 public:
 
@@ -80,12 +89,24 @@ public:
 
     virtual AbcA::ReadArraySampleCachePtr getReadArraySampleCachePtr()
     {
-        return AbcA::ReadArraySampleCachePtr();
+        return m_readArraySampleCache;
     }
 
     virtual void
     setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     {
+        m_readArraySampleCache = iPtr;
+    }
+
+    virtual AbcA::SampleBufferAllocatorPtr getSampleBufferAllocator()
+    {
+        return m_sampleBufferAllocator;
+    }
+
+    virtual void
+    setSampleBufferAllocator( AbcA::SampleBufferAllocatorPtr iPtr )
+    {
+        m_sampleBufferAllocator = iPtr;
     }
 
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
@@ -101,19 +122,98 @@ public:
         return m_archiveVersion;
     }
 
+    virtual bool getIndexedObjectHeader( const std::string & iFullName,
+                                         AbcA::ObjectHeader & oHeader );
+
+    virtual bool getIndexedChildHeaders( const std::string & iFullName,
+                                         std::vector< AbcA::ObjectHeader > &
+                                         oHeaders );
+
+    // looks up iFullName in the hierarchy index, oGroupPos is where the
+    // object's group is, which can be handed to Ogawa::IArchive::getGroup
+    // returns false if there is no index or the object isn't in it
+    bool findIndexedObject( const std::string & iFullName,
+                            AbcA::ObjectHeader & oHeader,
+                            Util::uint64_t & oGroupPos );
+
+    // goes straight to the object using the hierarchy index if there is
+    // one, otherwise reads down to it without making any readers along the
+    // way.  Where objects are is remembered so later lookups are cheaper,
+    // without an index that is every child of each object passed through,
+    // and it is only let go of by trim.
+    // The returned object is not the same reader that getTop()->getChild()
+    // would give for that path, but reads the same data.
+    virtual AbcA::ObjectReaderPtr findObject( const std::string & iFullName );
+
+    virtual void getMemoryUsage( AbcA::MemoryUsage & oUsage );
+
+    // drops the block cache, the samples this archive put in the sample
+    // cache, the buffers the sample buffer allocator is keeping, and what
+    // findObject has remembered
+    virtual void trim();
+
+    // OrData and CprData add what their headers take up when they are made
+    // and take it away again when they go away
+    void addHeaderBytes( Util::int64_t iBytes ) { m_headerBytes += iBytes; }
+
     StreamIDPtr getStreamID();
 
+    // whether array samples may point straight into the memory mapped file
+    bool useMappedViews() const { return m_useMappedViews; }
+
+    // whether child headers are only read when they are asked for
+    bool lazyHeaders() const { return m_lazyHeaders; }
+
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // what the readers of this archive are made from
+    const ReaderPoolPtr & getReaderPool() const { return m_readerPool; }
+
 private:
     void init();
 
+    // the read array sample cache, if it is a CacheImpl, which keeps track
+    // of which samples were stored by this archive when it is shared with
+    // others, like the one an IFactory hands to every archive it opens
+    CacheImpl * getCacheImpl() const;
+
+    // reads the hierarchy index the first time it is needed,
+    // NULL if the archive wasn't written with one
+    HierarchyIndexPtr getHierarchyIndex();
+
+    struct FoundObject
+    {
+        FoundObject() : groupPos( 0 ), childrenRead( false ) {}
+
+        ObjectHeaderPtr header;
+        Util::uint64_t groupPos;
+
+        // whether all the children are in m_found, only used when there
+        // is no hierarchy index
+        bool childrenRead;
+
+        Alembic::Util::weak_ptr< AbcA::ObjectReader > made;
+    };
+
+    typedef std::map< std::string, FoundObject > FoundObjectMap;
+
+    // copies what is known about the object into oFound, returns false if
+    // there is no such object.  Takes m_foundLock only to look in and add
+    // to m_found, the headers are read without it.
+    bool resolveObject( const std::string & iFullName,
+                        std::size_t iThreadId, FoundObject & oFound );
+
     std::string m_fileName;
     size_t m_numStreams;
 
     Ogawa::IArchive m_archive;
 
     Alembic::Util::weak_ptr< AbcA::ObjectReader > m_top;
+
+    // before m_data so they are still around when m_data goes away
+    ReaderPoolPtr m_readerPool;
+    std::atomic< Util::int64_t > m_headerBytes;
+
     Alembic::Util::shared_ptr < OrData > m_data;
     Alembic::Util::mutex m_orlock;
 
@@ -127,6 +227,22 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    AbcA::ReadArraySampleCachePtr m_readArraySampleCache;
+
+    AbcA::SampleBufferAllocatorPtr m_sampleBufferAllocator;
+
+    bool m_useMappedViews;
+
+    bool m_lazyHeaders;
+
+    Alembic::Util::mutex m_hierarchyIndexLock;
+    bool m_hierarchyIndexRead;
+    HierarchyIndexPtr m_hierarchyIndex;
+
+    // keyed by full name, the top object is under ""
+    Alembic::Util::mutex m_foundLock;
+    FoundObjectMap m_found;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
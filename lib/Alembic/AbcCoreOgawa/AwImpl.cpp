@@ -45,11 +45,15 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 AwImpl::AwImpl( const std::string &iFileName,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                Ogawa::WriteStrategy iStrategy )
   : m_fileName( iFileName )
   , m_metaData( iMetaData )
-  , m_archive( iFileName )
+  , m_archive( iFileName, iStrategy )
   , m_metaDataMap( new MetaDataMap() )
+  , m_hasEncodedSamples( false )
+  , m_hasChunkedDigests( false )
+  , m_writeHierarchyIndex( false )
 {
 
     // add default time sampling
@@ -67,10 +71,14 @@ AwImpl::AwImpl( const std::string &iFileName,
 
 //-*****************************************************************************
 AwImpl::AwImpl( std::ostream * iStream,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                Ogawa::WriteStrategy iStrategy )
   : m_metaData( iMetaData )
-  , m_archive( iStream )
+  , m_archive( iStream, iStrategy )
   , m_metaDataMap( new MetaDataMap() )
+  , m_hasEncodedSamples( false )
+  , m_hasChunkedDigests( false )
+  , m_writeHierarchyIndex( false )
 {
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -91,8 +99,10 @@ void AwImpl::init()
     // set the version using Ogawa native calls
     // This expresses the AbcCoreOgawa version - how properties,
     // are stored within Ogawa, etc.
-    Util::int32_t version = ALEMBIC_OGAWA_FILE_VERSION;
-    m_archive.getGroup()->addData( 4, &version );
+    // We start with the oldest version we can, and bump it up when the
+    // archive is closed if we end up needing newer features.
+    Util::int32_t version = ALEMBIC_OGAWA_BASE_FILE_VERSION;
+    m_versionData = m_archive.getGroup()->addData( 4, &version );
 
     // This is the Alembic library version XXYYZZ
     // Where XX is the major version, YY is the minor version
@@ -105,24 +115,21 @@ void AwImpl::init()
     m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
 
     // seed with the common empty keys
+    // (position 0 is the empty data)
     AbcA::ArraySampleKey emptyKey;
     emptyKey.numBytes = 0;
-    Ogawa::ODataPtr emptyData( new Ogawa::OData() );
 
     emptyKey.origPOD = Alembic::Util::kInt8POD;
     emptyKey.readPOD = Alembic::Util::kInt8POD;
-    WrittenSampleIDPtr wsid( new WrittenSampleID( emptyKey, emptyData, 0 ) );
-    m_writtenSampleMap.store( wsid );
+    m_writtenSampleMap.store( WrittenSampleID( emptyKey, 0, 0, false, true ) );
 
     emptyKey.origPOD = Alembic::Util::kStringPOD;
     emptyKey.readPOD = Alembic::Util::kStringPOD;
-    wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
-    m_writtenSampleMap.store( wsid );
+    m_writtenSampleMap.store( WrittenSampleID( emptyKey, 0, 0, false, true ) );
 
     emptyKey.origPOD = Alembic::Util::kWstringPOD;
     emptyKey.readPOD = Alembic::Util::kWstringPOD;
-    wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
-    m_writtenSampleMap.store( wsid );
+    m_writtenSampleMap.store( WrittenSampleID( emptyKey, 0, 0, false, true ) );
 }
 
 //-*****************************************************************************
@@ -171,7 +178,10 @@ Util::uint32_t AwImpl::addTimeSampling( const AbcA::TimeSampling & iTs )
     // we've got a new TimeSampling, write it and add it to our vector
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling(iTs) );
     m_timeSamples.push_back(ts);
-    m_maxSamples.push_back(0);
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_maxSamples.push_back(0);
+    }
 
     index_t latestSample = m_timeSamples.size() - 1;
 
@@ -195,6 +205,7 @@ AbcA::TimeSamplingPtr AwImpl::getTimeSampling( Util::uint32_t iIndex )
 AbcA::index_t
 AwImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
 {
+    Alembic::Util::scoped_lock l( m_lock );
     if ( iIndex < m_maxSamples.size() )
     {
         return m_maxSamples[iIndex];
@@ -206,12 +217,24 @@ AwImpl::getMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex )
 void AwImpl::setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
                                                    AbcA::index_t iMaxIndex )
 {
+    Alembic::Util::scoped_lock l( m_lock );
     if ( iIndex < m_maxSamples.size() )
     {
         m_maxSamples[iIndex] = iMaxIndex;
     }
 }
 
+//-*****************************************************************************
+void AwImpl::updateMaxNumSamples( Util::uint32_t iIndex,
+                                  AbcA::index_t iNumSamples )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    if ( iIndex < m_maxSamples.size() && m_maxSamples[iIndex] < iNumSamples )
+    {
+        m_maxSamples[iIndex] = iNumSamples;
+    }
+}
+
 //-*****************************************************************************
 AwImpl::~AwImpl()
 {
@@ -232,6 +255,19 @@ AwImpl::~AwImpl()
     // encode and write the time samplings and max samples into data
     if ( m_archive.isValid() )
     {
+        if ( m_hasEncodedSamples && m_versionData )
+        {
+            Util::int32_t version = ALEMBIC_OGAWA_FILE_VERSION;
+            m_versionData->rewrite( 4, &version );
+        }
+
+        // readers don't need to know how the sample digests were computed,
+        // but tools comparing them across archives do
+        if ( m_hasChunkedDigests )
+        {
+            m_metaData.set( "_ai_DigestAlgorithm", "Murmur3Chunked" );
+        }
+
         // encode and write the Metadata for the archive, since the top level
         // meta data can be kinda big and is very specialized don't worry
         // about putting it into the meta data map
@@ -248,7 +284,23 @@ AwImpl::~AwImpl()
         }
 
         m_archive.getGroup()->addData( data.size(), &( data.front() ) );
+
+        // the index refers to the meta data map, so it has to be encoded
+        // before the map is written, but it goes after it in the file so
+        // readers which don't know about it still find everything else
+        std::vector< Util::uint8_t > indexData;
+        if ( m_writeHierarchyIndex )
+        {
+            WriteHierarchyIndex( indexData, m_hierarchyIndex, m_metaDataMap );
+        }
+
         m_metaDataMap->write( m_archive.getGroup() );
+
+        if ( m_writeHierarchyIndex )
+        {
+            m_archive.getGroup()->addData( indexData.size(),
+                                           &( indexData.front() ) );
+        }
     }
 
 }
@@ -57,10 +57,12 @@ private:
     friend class WriteArchive;
 
     AwImpl( const std::string &iFileName,
-            const AbcA::MetaData &iMetaData );
+            const AbcA::MetaData &iMetaData,
+            Ogawa::WriteStrategy iStrategy = Ogawa::kSynchronousWrites );
 
     AwImpl( std::ostream * iStream,
-            const AbcA::MetaData & iMetaData );
+            const AbcA::MetaData & iMetaData,
+            Ogawa::WriteStrategy iStrategy = Ogawa::kSynchronousWrites );
 
 public:
     virtual ~AwImpl();
@@ -89,6 +91,44 @@ public:
         return m_metaDataMap;
     }
 
+    // called when an encoded sample is written, so the archive will be
+    // marked with a version new enough to read it
+    void setHasEncodedSamples()
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_hasEncodedSamples = true;
+    }
+
+    // called when a property computes its sample digests with
+    // AbcA::kChunkedMurmur3Digest, so it can be noted in the archive metadata
+    void setHasChunkedDigests()
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_hasChunkedDigests = true;
+    }
+
+    // whether the positions of the objects are written into an index of
+    // the whole hierarchy when the archive is closed
+    void setWriteHierarchyIndex( bool iWrite )
+    {
+        m_writeHierarchyIndex = iWrite;
+    }
+
+    bool writesHierarchyIndex() const { return m_writeHierarchyIndex; }
+
+    // called as objects are closed, which may happen on different threads
+    void addToHierarchyIndex( ObjectHeaderPtr iHeader,
+                              Util::uint64_t iGroupPos )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_hierarchyIndex.push_back( std::make_pair( iHeader, iGroupPos ) );
+    }
+
+    // called as properties are closed, which may happen on different
+    // threads, only ever raises the max number of samples
+    void updateMaxNumSamples( Util::uint32_t iIndex,
+                              AbcA::index_t iNumSamples );
+
     virtual Util::uint32_t addTimeSampling( const AbcA::TimeSampling & iTs );
 
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
@@ -117,6 +157,18 @@ private:
 
     WrittenSampleMap m_writtenSampleMap;
     MetaDataMapPtr m_metaDataMap;
+
+    Ogawa::ODataPtr m_versionData;
+    bool m_hasEncodedSamples;
+    bool m_hasChunkedDigests;
+
+    bool m_writeHierarchyIndex;
+    std::vector< std::pair< ObjectHeaderPtr, Util::uint64_t > >
+        m_hierarchyIndex;
+
+    // guards the max samples, m_hasEncodedSamples, m_hasChunkedDigests
+    // and m_hierarchyIndex
+    Alembic::Util::mutex m_lock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -0,0 +1,238 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+CacheImpl::CacheImpl( std::size_t iMaxBytes )
+  : m_numBytes( 0 )
+  , m_maxBytes( iMaxBytes )
+{
+}
+
+//-*****************************************************************************
+CacheImpl::~CacheImpl()
+{
+}
+
+//-*****************************************************************************
+AbcA::ReadArraySampleID
+CacheImpl::find( const AbcA::ArraySample::Key &iKey )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+
+    Map::iterator foundIter = m_map.find( iKey );
+    if ( foundIter == m_map.end() )
+    {
+        return AbcA::ReadArraySampleID();
+    }
+
+    // move it to the front since it was just used
+    RecordList::iterator recIter = foundIter->second;
+    m_records.splice( m_records.begin(), m_records, recIter );
+
+    return AbcA::ReadArraySampleID( iKey, recIter->sample );
+}
+
+//-*****************************************************************************
+AbcA::ReadArraySampleID
+CacheImpl::store( const AbcA::ArraySample::Key &iKey,
+                  AbcA::ArraySamplePtr iSamp )
+{
+    return store( iKey, iSamp, NULL );
+}
+
+//-*****************************************************************************
+AbcA::ReadArraySampleID
+CacheImpl::store( const AbcA::ArraySample::Key &iKey,
+                  AbcA::ArraySamplePtr iSamp,
+                  const AbcA::ArchiveReader * iOwner )
+{
+    ABCA_ASSERT( iSamp, "Cannot store a null sample" );
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    // another thread may have beaten us to it, share theirs
+    Map::iterator foundIter = m_map.find( iKey );
+    if ( foundIter != m_map.end() )
+    {
+        RecordList::iterator recIter = foundIter->second;
+        m_records.splice( m_records.begin(), m_records, recIter );
+        return AbcA::ReadArraySampleID( iKey, recIter->sample );
+    }
+
+    // too big to ever fit, so don't throw out everything else for it
+    if ( iKey.numBytes > m_maxBytes )
+    {
+        return AbcA::ReadArraySampleID( iKey, iSamp );
+    }
+
+    Record record;
+    record.key = iKey;
+    record.sample = iSamp;
+    record.owner = iOwner;
+    m_records.push_front( record );
+    m_map[iKey] = m_records.begin();
+    m_numBytes += iKey.numBytes;
+    if ( iOwner )
+    {
+        m_ownerBytes[iOwner] += iKey.numBytes;
+    }
+
+    // drop the least recently used until we fit in our budget again
+    while ( m_numBytes > m_maxBytes && !m_records.empty() )
+    {
+        const Record & oldest = m_records.back();
+        m_numBytes -= oldest.key.numBytes;
+        removeOwnerBytes( oldest.owner, oldest.key.numBytes );
+        m_map.erase( oldest.key );
+        m_records.pop_back();
+    }
+
+    return AbcA::ReadArraySampleID( iKey, iSamp );
+}
+
+//-*****************************************************************************
+std::size_t CacheImpl::getNumBytes() const
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_numBytes;
+}
+
+//-*****************************************************************************
+std::size_t
+CacheImpl::getNumBytes( const AbcA::ArchiveReader * iOwner ) const
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    std::map< const AbcA::ArchiveReader *, std::size_t >::const_iterator it =
+        m_ownerBytes.find( iOwner );
+    return it == m_ownerBytes.end() ? 0 : it->second;
+}
+
+//-*****************************************************************************
+std::size_t CacheImpl::getNumSamples() const
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_records.size();
+}
+
+//-*****************************************************************************
+void CacheImpl::clear()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_records.clear();
+    m_map.clear();
+    m_numBytes = 0;
+    m_ownerBytes.clear();
+}
+
+//-*****************************************************************************
+void CacheImpl::clear( const AbcA::ArchiveReader * iOwner )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    if ( m_ownerBytes.find( iOwner ) == m_ownerBytes.end() )
+    {
+        return;
+    }
+
+    RecordList::iterator it = m_records.begin();
+    while ( it != m_records.end() )
+    {
+        if ( it->owner == iOwner )
+        {
+            m_numBytes -= it->key.numBytes;
+            m_map.erase( it->key );
+            it = m_records.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    m_ownerBytes.erase( iOwner );
+}
+
+//-*****************************************************************************
+void CacheImpl::disown( const AbcA::ArchiveReader * iOwner )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    if ( m_ownerBytes.find( iOwner ) == m_ownerBytes.end() )
+    {
+        return;
+    }
+
+    for ( RecordList::iterator it = m_records.begin();
+          it != m_records.end(); ++it )
+    {
+        if ( it->owner == iOwner )
+        {
+            it->owner = NULL;
+        }
+    }
+
+    m_ownerBytes.erase( iOwner );
+}
+
+//-*****************************************************************************
+void CacheImpl::removeOwnerBytes( const AbcA::ArchiveReader * iOwner,
+                                  std::size_t iNumBytes )
+{
+    if ( !iOwner )
+    {
+        return;
+    }
+
+    std::map< const AbcA::ArchiveReader *, std::size_t >::iterator it =
+        m_ownerBytes.find( iOwner );
+    if ( it == m_ownerBytes.end() )
+    {
+        return;
+    }
+
+    it->second -= iNumBytes;
+    if ( it->second == 0 )
+    {
+        m_ownerBytes.erase( it );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,131 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_CacheImpl_h
+#define Alembic_AbcCoreOgawa_CacheImpl_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+#include <list>
+#include <map>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A least recently used cache of array samples, which is safe to share
+//! between threads and archives.
+//! Once the samples in the cache take up more than the byte budget, the
+//! least recently used ones are dropped.  Samples which have already been
+//! handed out stay valid for as long as they are held onto.
+//! Each sample belongs to the archive which stored it, even when other
+//! archives find it, so one archive sharing the cache can count and drop
+//! its own samples without touching the others.
+class ALEMBIC_EXPORT CacheImpl : public AbcA::ReadArraySampleCache
+{
+public:
+    explicit CacheImpl( std::size_t iMaxBytes );
+
+    virtual ~CacheImpl();
+
+    virtual AbcA::ReadArraySampleID
+    find( const AbcA::ArraySample::Key &iKey );
+
+    virtual AbcA::ReadArraySampleID
+    store( const AbcA::ArraySample::Key &iKey,
+           AbcA::ArraySamplePtr iSamp );
+
+    //! Like store, but the sample belongs to iOwner.
+    AbcA::ReadArraySampleID
+    store( const AbcA::ArraySample::Key &iKey,
+           AbcA::ArraySamplePtr iSamp,
+           const AbcA::ArchiveReader * iOwner );
+
+    //! The number of bytes taken up by the samples in the cache.
+    std::size_t getNumBytes() const;
+
+    //! The number of bytes taken up by the samples belonging to iOwner.
+    std::size_t getNumBytes( const AbcA::ArchiveReader * iOwner ) const;
+
+    //! The number of samples in the cache.
+    std::size_t getNumSamples() const;
+
+    std::size_t getMaxBytes() const { return m_maxBytes; }
+
+    //! Drops every sample, samples already handed out stay valid.
+    void clear();
+
+    //! Drops the samples belonging to iOwner.
+    void clear( const AbcA::ArchiveReader * iOwner );
+
+    //! The samples belonging to iOwner stay in the cache, but no longer
+    //! belong to anything, for when iOwner goes away.
+    void disown( const AbcA::ArchiveReader * iOwner );
+
+private:
+    struct Record
+    {
+        AbcA::ArraySample::Key key;
+        AbcA::ArraySamplePtr sample;
+        const AbcA::ArchiveReader * owner;
+    };
+
+    // most recently used are at the front
+    typedef std::list< Record > RecordList;
+    typedef AbcA::UnorderedMapUtil< RecordList::iterator >::umap_type Map;
+
+    // iOwner may be NULL, for samples which don't belong to anything
+    void removeOwnerBytes( const AbcA::ArchiveReader * iOwner,
+                           std::size_t iNumBytes );
+
+    RecordList m_records;
+    Map m_map;
+
+    std::size_t m_numBytes;
+    std::map< const AbcA::ArchiveReader *, std::size_t > m_ownerBytes;
+    std::size_t m_maxBytes;
+
+    mutable Alembic::Util::mutex m_lock;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
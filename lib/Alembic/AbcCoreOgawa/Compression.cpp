@@ -0,0 +1,647 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/Compression.h>
+
+#ifdef ALEMBIC_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || \
+    ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ALEMBIC_OGAWA_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// don't bother compressing anything smaller than this
+const std::size_t MIN_COMPRESS_SIZE = 64;
+
+// the most an LZ4 or zlib stream can expand by when decompressed, used to
+// reject malformed sizes before we allocate anything for them
+const Util::uint64_t MAX_LZ4_RATIO = 256;
+const Util::uint64_t MAX_ZLIB_RATIO = 1032;
+
+//-*****************************************************************************
+// FILTERS
+//-*****************************************************************************
+
+//-*****************************************************************************
+// Picks the filters for a POD, returns the element size they work on or 0
+// if the data shouldn't be filtered.
+std::size_t ChooseFilters( Util::PlainOldDataType iPod,
+                           Util::uint8_t & oFilters )
+{
+    switch ( iPod )
+    {
+        case Util::kFloat16POD:
+        case Util::kFloat32POD:
+        case Util::kFloat64POD:
+        case Util::kInt16POD:
+        case Util::kUint16POD:
+            oFilters = kShuffleFilter;
+            return Util::PODNumBytes( iPod );
+
+        case Util::kInt32POD:
+        case Util::kUint32POD:
+        case Util::kInt64POD:
+        case Util::kUint64POD:
+            oFilters = kShuffleFilter | kDeltaFilter;
+            return Util::PODNumBytes( iPod );
+
+        default:
+            oFilters = kNoFilter;
+            return 0;
+    }
+}
+
+#ifdef ALEMBIC_OGAWA_SSE2
+//-*****************************************************************************
+// Interleaves the first half of the registers with the second half, which
+// rotates the bits of each byte's index left by one.
+template < std::size_t R >
+inline void PerfectShuffle( __m128i * ioRegs )
+{
+    __m128i tmp[R];
+    for ( std::size_t i = 0; i < R / 2; ++i )
+    {
+        tmp[2 * i] = _mm_unpacklo_epi8( ioRegs[i], ioRegs[i + R / 2] );
+        tmp[2 * i + 1] = _mm_unpackhi_epi8( ioRegs[i], ioRegs[i + R / 2] );
+    }
+
+    for ( std::size_t i = 0; i < R; ++i )
+    {
+        ioRegs[i] = tmp[i];
+    }
+}
+
+//-*****************************************************************************
+// Shuffles blocks of 16 elements of R bytes each, returns how many elements
+// were shuffled.  Each block is R registers, and 4 perfect shuffles turn
+// element major bytes into byte major ones.
+template < std::size_t R >
+std::size_t ShuffleBlocks( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                           std::size_t iNumElems )
+{
+    std::size_t numBlocks = iNumElems / 16;
+    for ( std::size_t b = 0; b < numBlocks; ++b )
+    {
+        __m128i regs[R];
+        for ( std::size_t r = 0; r < R; ++r )
+        {
+            regs[r] = _mm_loadu_si128(
+                ( const __m128i * )( iSrc + ( b * R + r ) * 16 ) );
+        }
+
+        for ( std::size_t i = 0; i < 4; ++i )
+        {
+            PerfectShuffle< R >( regs );
+        }
+
+        for ( std::size_t r = 0; r < R; ++r )
+        {
+            _mm_storeu_si128(
+                ( __m128i * )( oDst + r * iNumElems + b * 16 ), regs[r] );
+        }
+    }
+    return numBlocks * 16;
+}
+
+//-*****************************************************************************
+// The inverse of ShuffleBlocks, log2( R ) perfect shuffles put the bytes
+// back in element order.
+template < std::size_t R >
+std::size_t UnshuffleBlocks( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                             std::size_t iNumElems )
+{
+    std::size_t numRounds = ( R == 2 ) ? 1 : ( ( R == 4 ) ? 2 : 3 );
+    std::size_t numBlocks = iNumElems / 16;
+    for ( std::size_t b = 0; b < numBlocks; ++b )
+    {
+        __m128i regs[R];
+        for ( std::size_t r = 0; r < R; ++r )
+        {
+            regs[r] = _mm_loadu_si128(
+                ( const __m128i * )( iSrc + r * iNumElems + b * 16 ) );
+        }
+
+        for ( std::size_t i = 0; i < numRounds; ++i )
+        {
+            PerfectShuffle< R >( regs );
+        }
+
+        for ( std::size_t r = 0; r < R; ++r )
+        {
+            _mm_storeu_si128(
+                ( __m128i * )( oDst + ( b * R + r ) * 16 ), regs[r] );
+        }
+    }
+    return numBlocks * 16;
+}
+#endif
+
+//-*****************************************************************************
+void ShuffleBytes( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                   std::size_t iNumElems, std::size_t iElemSize )
+{
+    std::size_t e = 0;
+
+#ifdef ALEMBIC_OGAWA_SSE2
+    switch ( iElemSize )
+    {
+        case 2: e = ShuffleBlocks< 2 >( iSrc, oDst, iNumElems ); break;
+        case 4: e = ShuffleBlocks< 4 >( iSrc, oDst, iNumElems ); break;
+        case 8: e = ShuffleBlocks< 8 >( iSrc, oDst, iNumElems ); break;
+        default: break;
+    }
+#endif
+
+    for ( ; e < iNumElems; ++e )
+    {
+        for ( std::size_t k = 0; k < iElemSize; ++k )
+        {
+            oDst[k * iNumElems + e] = iSrc[e * iElemSize + k];
+        }
+    }
+}
+
+//-*****************************************************************************
+void UnshuffleBytes( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                     std::size_t iNumElems, std::size_t iElemSize )
+{
+    std::size_t e = 0;
+
+#ifdef ALEMBIC_OGAWA_SSE2
+    switch ( iElemSize )
+    {
+        case 2: e = UnshuffleBlocks< 2 >( iSrc, oDst, iNumElems ); break;
+        case 4: e = UnshuffleBlocks< 4 >( iSrc, oDst, iNumElems ); break;
+        case 8: e = UnshuffleBlocks< 8 >( iSrc, oDst, iNumElems ); break;
+        default: break;
+    }
+#endif
+
+    for ( ; e < iNumElems; ++e )
+    {
+        for ( std::size_t k = 0; k < iElemSize; ++k )
+        {
+            oDst[e * iElemSize + k] = iSrc[k * iNumElems + e];
+        }
+    }
+}
+
+//-*****************************************************************************
+// Scalar delta encoding, T is an unsigned type so differences wrap around.
+template < typename T >
+void DeltaEncodeFrom( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                      std::size_t iStart, std::size_t iNumElems )
+{
+    T prev = 0;
+    if ( iStart > 0 )
+    {
+        memcpy( &prev, iSrc + ( iStart - 1 ) * sizeof( T ), sizeof( T ) );
+    }
+
+    for ( std::size_t i = iStart; i < iNumElems; ++i )
+    {
+        T val;
+        memcpy( &val, iSrc + i * sizeof( T ), sizeof( T ) );
+        T delta = val - prev;
+        memcpy( oDst + i * sizeof( T ), &delta, sizeof( T ) );
+        prev = val;
+    }
+}
+
+//-*****************************************************************************
+// Scalar prefix sum, done in place.
+template < typename T >
+void DeltaDecodeFrom( Util::uint8_t * ioData, std::size_t iStart,
+                      std::size_t iNumElems )
+{
+    T prev = 0;
+    if ( iStart > 0 )
+    {
+        memcpy( &prev, ioData + ( iStart - 1 ) * sizeof( T ), sizeof( T ) );
+    }
+
+    for ( std::size_t i = iStart; i < iNumElems; ++i )
+    {
+        T val;
+        memcpy( &val, ioData + i * sizeof( T ), sizeof( T ) );
+        prev += val;
+        memcpy( ioData + i * sizeof( T ), &prev, sizeof( T ) );
+    }
+}
+
+//-*****************************************************************************
+void DeltaEncode( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                  std::size_t iNumElems, std::size_t iElemSize )
+{
+    std::size_t i = 0;
+    if ( iElemSize == 4 )
+    {
+#ifdef ALEMBIC_OGAWA_SSE2
+        __m128i prev = _mm_setzero_si128();
+        for ( ; i + 4 <= iNumElems; i += 4 )
+        {
+            __m128i x = _mm_loadu_si128( ( const __m128i * )( iSrc + i * 4 ) );
+            __m128i shifted = _mm_or_si128( _mm_slli_si128( x, 4 ),
+                                            _mm_srli_si128( prev, 12 ) );
+            _mm_storeu_si128( ( __m128i * )( oDst + i * 4 ),
+                              _mm_sub_epi32( x, shifted ) );
+            prev = x;
+        }
+#endif
+        DeltaEncodeFrom< Util::uint32_t >( iSrc, oDst, i, iNumElems );
+    }
+    else if ( iElemSize == 8 )
+    {
+#ifdef ALEMBIC_OGAWA_SSE2
+        __m128i prev = _mm_setzero_si128();
+        for ( ; i + 2 <= iNumElems; i += 2 )
+        {
+            __m128i x = _mm_loadu_si128( ( const __m128i * )( iSrc + i * 8 ) );
+            __m128i shifted = _mm_or_si128( _mm_slli_si128( x, 8 ),
+                                            _mm_srli_si128( prev, 8 ) );
+            _mm_storeu_si128( ( __m128i * )( oDst + i * 8 ),
+                              _mm_sub_epi64( x, shifted ) );
+            prev = x;
+        }
+#endif
+        DeltaEncodeFrom< Util::uint64_t >( iSrc, oDst, i, iNumElems );
+    }
+}
+
+//-*****************************************************************************
+void DeltaDecode( Util::uint8_t * ioData, std::size_t iNumElems,
+                  std::size_t iElemSize )
+{
+    std::size_t i = 0;
+    if ( iElemSize == 4 )
+    {
+#ifdef ALEMBIC_OGAWA_SSE2
+        // running total broadcast to every lane
+        __m128i carry = _mm_setzero_si128();
+        for ( ; i + 4 <= iNumElems; i += 4 )
+        {
+            __m128i x = _mm_loadu_si128( ( const __m128i * )( ioData + i * 4 ) );
+            x = _mm_add_epi32( x, _mm_slli_si128( x, 4 ) );
+            x = _mm_add_epi32( x, _mm_slli_si128( x, 8 ) );
+            x = _mm_add_epi32( x, carry );
+            _mm_storeu_si128( ( __m128i * )( ioData + i * 4 ), x );
+            carry = _mm_shuffle_epi32( x, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        }
+#endif
+        DeltaDecodeFrom< Util::uint32_t >( ioData, i, iNumElems );
+    }
+    else if ( iElemSize == 8 )
+    {
+#ifdef ALEMBIC_OGAWA_SSE2
+        __m128i carry = _mm_setzero_si128();
+        for ( ; i + 2 <= iNumElems; i += 2 )
+        {
+            __m128i x = _mm_loadu_si128( ( const __m128i * )( ioData + i * 8 ) );
+            x = _mm_add_epi64( x, _mm_slli_si128( x, 8 ) );
+            x = _mm_add_epi64( x, carry );
+            _mm_storeu_si128( ( __m128i * )( ioData + i * 8 ), x );
+            carry = _mm_unpackhi_epi64( x, x );
+        }
+#endif
+        DeltaDecodeFrom< Util::uint64_t >( ioData, i, iNumElems );
+    }
+}
+
+//-*****************************************************************************
+// Applies iFilters to iSize bytes of iSrc, any bytes past the last whole
+// element are copied as is.
+void FilterData( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                 std::size_t iSize, Util::uint8_t iFilters,
+                 std::size_t iElemSize )
+{
+    std::size_t numElems = iSize / iElemSize;
+    std::size_t numFiltered = numElems * iElemSize;
+
+    std::vector< Util::uint8_t > delta;
+    const Util::uint8_t * src = iSrc;
+    if ( iFilters & kDeltaFilter )
+    {
+        delta.resize( numFiltered );
+        DeltaEncode( iSrc, &delta.front(), numElems, iElemSize );
+        src = &delta.front();
+    }
+
+    if ( iFilters & kShuffleFilter )
+    {
+        ShuffleBytes( src, oDst, numElems, iElemSize );
+    }
+    else
+    {
+        memcpy( oDst, src, numFiltered );
+    }
+
+    memcpy( oDst + numFiltered, iSrc + numFiltered, iSize - numFiltered );
+}
+
+//-*****************************************************************************
+// The inverse of FilterData.
+void UnfilterData( const Util::uint8_t * iSrc, Util::uint8_t * oDst,
+                   std::size_t iSize, Util::uint8_t iFilters,
+                   std::size_t iElemSize )
+{
+    std::size_t numElems = iSize / iElemSize;
+    std::size_t numFiltered = numElems * iElemSize;
+
+    if ( iFilters & kShuffleFilter )
+    {
+        UnshuffleBytes( iSrc, oDst, numElems, iElemSize );
+    }
+    else
+    {
+        memcpy( oDst, iSrc, numFiltered );
+    }
+
+    if ( iFilters & kDeltaFilter )
+    {
+        DeltaDecode( oDst, numElems, iElemSize );
+    }
+
+    memcpy( oDst + numFiltered, iSrc + numFiltered, iSize - numFiltered );
+}
+
+//-*****************************************************************************
+void ReadEncodedHeader( Ogawa::IDataPtr iData,
+                        size_t iThreadId,
+                        Util::uint8_t & oCodec,
+                        Util::uint8_t & oFilters,
+                        std::size_t & oElemSize,
+                        Util::uint64_t & oSize )
+{
+    if ( iData->getSize() < 16 + ENCODED_HEADER_SIZE )
+    {
+        ABCA_THROW( "Read invalid: Encoded sample header is too small." );
+    }
+
+    Util::uint8_t header[ENCODED_HEADER_SIZE];
+    iData->read( ENCODED_HEADER_SIZE, header, 16, iThreadId );
+
+    if ( header[0] != ENCODING_VERSION )
+    {
+        ABCA_THROW( "Read invalid: Unsupported sample encoding version: " <<
+                    ( Util::uint32_t ) header[0] );
+    }
+
+    oCodec = header[1];
+    oFilters = header[2];
+    oElemSize = header[3];
+    memcpy( &oSize, &header[8], 8 );
+
+    if ( oFilters != kNoFilter && ( oCodec == kNoCodec ||
+         ( oFilters & ~( kShuffleFilter | kDeltaFilter ) ) != 0 ||
+         ( oElemSize != 2 && oElemSize != 4 && oElemSize != 8 ) ||
+         ( ( oFilters & kDeltaFilter ) && oElemSize == 2 ) ) )
+    {
+        ABCA_THROW( "Read invalid: Unsupported sample filter: " <<
+                    ( Util::uint32_t ) oFilters << " element size: " <<
+                    oElemSize );
+    }
+
+    Util::uint64_t payloadSize =
+        iData->getSize() - 16 - ENCODED_HEADER_SIZE;
+
+    bool validSize = false;
+    if ( oCodec == kNoCodec )
+    {
+        validSize = ( oSize == payloadSize );
+    }
+    else if ( oCodec == kLz4Codec )
+    {
+        validSize = ( oSize <= payloadSize * MAX_LZ4_RATIO );
+    }
+    else if ( oCodec == kZlibCodec )
+    {
+        validSize = ( oSize <= payloadSize * MAX_ZLIB_RATIO );
+    }
+    else
+    {
+        ABCA_THROW( "Read invalid: Unsupported sample codec: " <<
+                    ( Util::uint32_t ) oCodec );
+    }
+
+    if ( !validSize )
+    {
+        ABCA_THROW( "Read invalid: Encoded sample size." );
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void EncodeData( const void * iData,
+                 std::size_t iSize,
+                 Util::PlainOldDataType iPod,
+                 Util::int8_t iCompressionHint,
+                 Util::uint8_t oHeader[ENCODED_HEADER_SIZE],
+                 std::vector< Util::uint8_t > & oCompressed )
+{
+    memset( oHeader, 0, ENCODED_HEADER_SIZE );
+    oHeader[0] = ENCODING_VERSION;
+    oHeader[1] = kNoCodec;
+
+    Util::uint64_t size = iSize;
+    memcpy( &oHeader[8], &size, 8 );
+
+    oCompressed.clear();
+
+    if ( iSize < MIN_COMPRESS_SIZE || iCompressionHint < 0 )
+    {
+        return;
+    }
+
+    // rearrange the data so it compresses better
+    Util::uint8_t filters = kNoFilter;
+    std::size_t elemSize = ChooseFilters( iPod, filters );
+    std::vector< Util::uint8_t > filtered;
+    const void * src = iData;
+    if ( filters != kNoFilter )
+    {
+        filtered.resize( iSize );
+        FilterData( ( const Util::uint8_t * ) iData, &filtered.front(), iSize,
+                    filters, elemSize );
+        src = &filtered.front();
+    }
+
+    Util::uint8_t codec = kNoCodec;
+
+#ifdef ALEMBIC_WITH_ZLIB
+    // uLong is only 32 bits on some platforms
+    if ( iCompressionHint > 0 && iSize == ( uLong ) iSize )
+    {
+        uLongf compressedSize = compressBound( ( uLong ) iSize );
+        oCompressed.resize( compressedSize );
+        int err = compress2( &oCompressed.front(), &compressedSize,
+                             ( const Bytef * ) src, ( uLong ) iSize,
+                             iCompressionHint );
+
+        if ( err == Z_OK && compressedSize < iSize )
+        {
+            oCompressed.resize( compressedSize );
+            codec = kZlibCodec;
+        }
+    }
+    else
+#endif
+    {
+        // only keep the compressed data if it is actually smaller
+        oCompressed.resize( Util::Lz4CompressBound( iSize ) );
+        std::size_t compressedSize = Util::Lz4Compress( src, iSize,
+            &oCompressed.front(), iSize - 1 );
+
+        if ( compressedSize > 0 )
+        {
+            oCompressed.resize( compressedSize );
+            codec = kLz4Codec;
+        }
+    }
+
+    if ( codec == kNoCodec )
+    {
+        // the unfiltered data gets written as is
+        oCompressed.clear();
+        return;
+    }
+
+    oHeader[1] = codec;
+    oHeader[2] = filters;
+    oHeader[3] = ( Util::uint8_t ) elemSize;
+}
+
+//-*****************************************************************************
+Util::uint64_t ReadEncodedSize( Ogawa::IDataPtr iData, size_t iThreadId )
+{
+    // empty samples are never encoded
+    if ( iData->getSize() <= 16 )
+    {
+        return 0;
+    }
+
+    Util::uint8_t codec = kNoCodec;
+    Util::uint8_t filters = kNoFilter;
+    std::size_t elemSize = 0;
+    Util::uint64_t size = 0;
+    ReadEncodedHeader( iData, iThreadId, codec, filters, elemSize, size );
+    return size;
+}
+
+//-*****************************************************************************
+void ReadEncodedData( Ogawa::IDataPtr iData,
+                      size_t iThreadId,
+                      void * oBuffer,
+                      Util::uint64_t iSize )
+{
+    if ( iData->getSize() <= 16 || iSize == 0 )
+    {
+        return;
+    }
+
+    Util::uint8_t codec = kNoCodec;
+    Util::uint8_t filters = kNoFilter;
+    std::size_t elemSize = 0;
+    Util::uint64_t size = 0;
+    ReadEncodedHeader( iData, iThreadId, codec, filters, elemSize, size );
+
+    ABCA_ASSERT( size == iSize,
+        "Read invalid: Encoded sample size does not match, expected: " <<
+        iSize << " got: " << size );
+
+    const Util::uint64_t offset = 16 + ENCODED_HEADER_SIZE;
+    Util::uint64_t payloadSize = iData->getSize() - offset;
+
+    if ( codec == kNoCodec )
+    {
+        iData->read( payloadSize, oBuffer, offset, iThreadId );
+        return;
+    }
+
+    std::vector< Util::uint8_t > buf( payloadSize );
+    iData->read( payloadSize, &buf.front(), offset, iThreadId );
+
+    // filtered data is decompressed into a scratch buffer first
+    std::vector< Util::uint8_t > filtered;
+    void * decoded = oBuffer;
+    if ( filters != kNoFilter )
+    {
+        filtered.resize( iSize );
+        decoded = &filtered.front();
+    }
+
+    if ( codec == kLz4Codec )
+    {
+        if ( !Util::Lz4Decompress( &buf.front(), buf.size(), decoded, iSize ) )
+        {
+            ABCA_THROW( "Read invalid: Could not decompress LZ4 sample." );
+        }
+    }
+    else if ( codec == kZlibCodec )
+    {
+#ifdef ALEMBIC_WITH_ZLIB
+        uLongf decompressedSize = ( uLongf ) iSize;
+        if ( decompressedSize != iSize ||
+             uncompress( ( Bytef * ) decoded, &decompressedSize,
+                         &buf.front(), ( uLong ) buf.size() ) != Z_OK ||
+             decompressedSize != iSize )
+        {
+            ABCA_THROW( "Read invalid: Could not decompress zlib sample." );
+        }
+#else
+        ABCA_THROW( "Can not read zlib compressed sample, this library was "
+                    "built without zlib support." );
+#endif
+    }
+
+    if ( filters != kNoFilter )
+    {
+        UnfilterData( &filtered.front(), ( Util::uint8_t * ) oBuffer, iSize,
+                      filters, elemSize );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
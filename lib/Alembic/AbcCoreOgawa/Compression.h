@@ -0,0 +1,121 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_Compression_h
+#define Alembic_AbcCoreOgawa_Compression_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Properties which were written with a compression hint store each sample
+// as the 16 byte key, followed by this header, followed by the (possibly
+// compressed) data.  The key is left alone so the samples can still be
+// shared via the WrittenSampleMap.
+//
+// byte 0      encoding version
+// byte 1      codec used to compress the data
+// byte 2      filters applied to the data before it was compressed
+// byte 3      element size the filters worked on
+// bytes 4-7   reserved, always 0
+// bytes 8-15  size of the data once it has been decompressed
+const std::size_t ENCODED_HEADER_SIZE = 16;
+
+const Util::uint8_t ENCODING_VERSION = 1;
+
+enum CompressionCodec
+{
+    // the data is stored as is, because compressing it didn't help
+    kNoCodec = 0,
+
+    // fast compression used for a compression hint of 0
+    kLz4Codec = 1,
+
+    // used for compression hints 1 through 9 when zlib is available
+    kZlibCodec = 2
+};
+
+// Filters are bit flags, when both are used delta is applied first.
+enum CompressionFilter
+{
+    kNoFilter = 0,
+
+    // byte k of every element is grouped together, used for floating point
+    // and integer data where the high bytes tend to be similar
+    kShuffleFilter = 1,
+
+    // each element is replaced by the difference from the previous one,
+    // used for 4 and 8 byte integers such as indices
+    kDeltaFilter = 2
+};
+
+//-*****************************************************************************
+// Fills in oHeader, and compresses iData according to iCompressionHint.
+// iPod selects which filters are applied before compressing.
+// If the data could be compressed it is placed in oCompressed, otherwise
+// oCompressed is left empty and iData should be written after the header as is.
+void
+EncodeData( const void * iData,
+            std::size_t iSize,
+            Util::PlainOldDataType iPod,
+            Util::int8_t iCompressionHint,
+            Util::uint8_t oHeader[ENCODED_HEADER_SIZE],
+            std::vector< Util::uint8_t > & oCompressed );
+
+//-*****************************************************************************
+// Returns the size of the decoded data, not counting the key.
+Util::uint64_t
+ReadEncodedSize( Ogawa::IDataPtr iData, size_t iThreadId );
+
+//-*****************************************************************************
+// Reads and decodes the data into oBuffer.  iSize must be the value returned
+// by ReadEncodedSize.
+void
+ReadEncodedData( Ogawa::IDataPtr iData,
+                 size_t iThreadId,
+                 void * oBuffer,
+                 Util::uint64_t iSize );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
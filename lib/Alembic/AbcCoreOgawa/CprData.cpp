@@ -52,6 +52,9 @@ CprData::CprData( Ogawa::IGroupPtr iGroup,
                   AbcA::ArchiveReader & iArchive,
                   const std::vector< AbcA::MetaData > & iIndexedMetaData )
     : m_propertyHeaders( NULL )
+    , m_archive( dynamic_cast< ArImpl & >( iArchive ) )
+    // this is made in the archive's ReaderPool, and counted with it
+    , m_numBytes( 0 )
 {
     ABCA_ASSERT( iGroup, "invalid compound data group" );
 
@@ -59,7 +62,33 @@ CprData::CprData( Ogawa::IGroupPtr iGroup,
 
     std::size_t numChildren = m_group->getNumChildren();
 
-    if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
+    if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) &&
+         m_archive.lazyHeaders() )
+    {
+        ReadPropertyHeadersBuffer( m_group, numChildren - 1, iThreadId,
+                                   m_headerBuf );
+
+        std::size_t pos = 0;
+        std::string name;
+        while ( pos < m_headerBuf.size() )
+        {
+            std::size_t start = pos;
+            ReadPropertyHeader( m_headerBuf, pos, iArchive, iIndexedMetaData,
+                                name, NULL );
+            m_subProperties[name] = m_headerOffsets.size();
+            m_headerOffsets.push_back( start );
+        }
+
+        m_lazyProperties.resize( m_headerOffsets.size() );
+
+        m_numBytes += m_headerBuf.capacity() +
+            m_headerOffsets.capacity() * sizeof( std::size_t ) +
+            m_lazyProperties.capacity() * sizeof( void * ) +
+            m_subProperties.size() * ( sizeof( std::string ) +
+                                       sizeof( std::size_t ) +
+                                       4 * sizeof( void * ) );
+    }
+    else if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
     {
         PropertyHeaderPtrs headers;
         ReadPropertyHeaders( m_group, numChildren - 1, iThreadId,
@@ -70,14 +99,55 @@ CprData::CprData( Ogawa::IGroupPtr iGroup,
         {
             m_subProperties[headers[i]->header.getName()] = i;
             m_propertyHeaders[i].header = headers[i];
+            m_numBytes += sizeof( SubProperty ) + HeaderBytes( *headers[i] );
         }
     }
+
+    // the positions of the children
+    m_numBytes += numChildren * sizeof( Util::uint64_t );
+    m_archive.addHeaderBytes( m_numBytes );
 }
 
 //-*****************************************************************************
 CprData::~CprData()
 {
     delete [] m_propertyHeaders;
+    m_archive.addHeaderBytes( -m_numBytes );
+}
+
+//-*****************************************************************************
+CprData::SubProperty &
+CprData::getSubProperty( AbcA::CompoundPropertyReaderPtr iParent, size_t i )
+{
+    if ( m_propertyHeaders )
+    {
+        return m_propertyHeaders[i];
+    }
+
+    Alembic::Util::scoped_lock l( m_lazyLock );
+    Alembic::Util::unique_ptr< SubProperty > & sub = m_lazyProperties[i];
+    if ( !sub )
+    {
+        Alembic::Util::shared_ptr< ArImpl > implPtr =
+            Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+                iParent->getObject()->getArchive() );
+
+        PropertyHeaderPtr header( new PropertyHeaderAndFriends() );
+        std::size_t pos = m_headerOffsets[i];
+        std::string name;
+        ReadPropertyHeader( m_headerBuf, pos, *implPtr,
+                            implPtr->getIndexedMetaData(), name,
+                            header.get() );
+
+        sub.reset( new SubProperty() );
+        sub->header = header;
+
+        Util::int64_t numBytes = sizeof( SubProperty ) + HeaderBytes( *header );
+        m_numBytes += numBytes;
+        m_archive.addHeaderBytes( numBytes );
+    }
+
+    return *sub;
 }
 
 //-*****************************************************************************
@@ -92,13 +162,13 @@ const AbcA::PropertyHeader &
 CprData::getPropertyHeader( AbcA::CompoundPropertyReaderPtr iParent, size_t i )
 {
     // fixed length and resize called in ctor, so multithread safe.
-    if ( i > m_subProperties.size() )
+    if ( i >= m_subProperties.size() )
     {
         ABCA_THROW( "Out of range index in "
                     << "CprData::getPropertyHeader: " << i );
     }
 
-    return m_propertyHeaders[i].header->header;
+    return getSubProperty( iParent, i ).header->header;
 }
 
 //-*****************************************************************************
@@ -128,7 +198,7 @@ CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
         return AbcA::ScalarPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = getSubProperty( iParent, fiter->second );
 
     if ( !(sub.header->header.isScalar()) )
     {
@@ -151,8 +221,8 @@ CprData::getScalarProperty( AbcA::CompoundPropertyReaderPtr iParent,
         ABCA_ASSERT( group, "Scalar Property not backed by a valid group.");
 
         // Make a new one.
-        bptr = Alembic::Util::shared_ptr<SprImpl>(
-            new SprImpl( iParent, group, sub.header ) );
+        bptr = MakeReader< SprImpl >( m_archive.getReaderPool(), iParent,
+                                      group, sub.header );
         sub.made = bptr;
     }
 
@@ -175,7 +245,7 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
         return AbcA::ArrayPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = getSubProperty( iParent, fiter->second );
 
     if ( !(sub.header->header.isArray()) )
     {
@@ -198,8 +268,8 @@ CprData::getArrayProperty( AbcA::CompoundPropertyReaderPtr iParent,
         ABCA_ASSERT( group, "Array Property not backed by a valid group.");
 
         // Make a new one.
-        bptr = Alembic::Util::shared_ptr<AprImpl>(
-            new AprImpl( iParent, group, sub.header ) );
+        bptr = MakeReader< AprImpl >( m_archive.getReaderPool(), iParent,
+                                      group, sub.header );
 
         sub.made = bptr;
     }
@@ -223,7 +293,7 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
         return AbcA::CompoundPropertyReaderPtr();
     }
 
-    SubProperty & sub = m_propertyHeaders[fiter->second];
+    SubProperty & sub = getSubProperty( iParent, fiter->second );
 
     if ( !(sub.header->header.isCompound()) )
     {
@@ -248,9 +318,9 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
         ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
 
         // Make a new one.
-        bptr = Alembic::Util::shared_ptr<CprImpl>(
-            new CprImpl( iParent, group, sub.header, streamId->getID(),
-                         implPtr->getIndexedMetaData() ) );
+        bptr = MakeReader< CprImpl >( m_archive.getReaderPool(), iParent,
+                                      group, sub.header, streamId->getID(),
+                                      implPtr->getIndexedMetaData() );
 
         sub.made = bptr;
     }
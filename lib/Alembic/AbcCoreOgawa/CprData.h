@@ -43,6 +43,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 // data class owned by CprImpl, or OrImpl if it is a "top" object
 // it owns and makes child properties
 class CprData : public Alembic::Util::enable_shared_from_this<CprData>
@@ -90,8 +92,22 @@ private:
 
     typedef std::map<std::string, size_t> SubPropertiesMap;
 
+    SubProperty & getSubProperty( AbcA::CompoundPropertyReaderPtr iParent,
+                                  size_t i );
+
     SubProperty * m_propertyHeaders;
     SubPropertiesMap m_subProperties;
+
+    // With lazy headers m_propertyHeaders is NULL, the encoded headers are
+    // kept in m_headerBuf and each SubProperty is made on first use.
+    std::vector< char > m_headerBuf;
+    std::vector< std::size_t > m_headerOffsets;
+    std::vector< Alembic::Util::unique_ptr< SubProperty > > m_lazyProperties;
+    Alembic::Util::mutex m_lazyLock;
+
+    // what the headers take up, which the archive keeps a tally of
+    ArImpl & m_archive;
+    Util::int64_t m_numBytes;
 };
 
 typedef Alembic::Util::shared_ptr<CprData> CprDataPtr;
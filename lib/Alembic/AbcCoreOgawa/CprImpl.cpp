@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/CprImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -70,8 +71,9 @@ CprImpl::CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
     ABCA_ASSERT( optr, "Invalid object in CprImpl::CprImpl(Compound)" );
     m_object = optr;
 
-    m_data.reset( new CprData( iGroup, iThreadId, *( m_object->getArchive() ),
-                               iIndexedMetaData ) );
+    ArImpl & archive = dynamic_cast< ArImpl & >( *m_object->getArchive() );
+    m_data = MakeReader< CprData >( archive.getReaderPool(), iGroup,
+                                    iThreadId, archive, iIndexedMetaData );
 }
 
 //-*****************************************************************************
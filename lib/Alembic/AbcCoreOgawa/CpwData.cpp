@@ -231,6 +231,7 @@ void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
+                           prop->isEncoded,
                            prop->timeSamplingIndex,
                            prop->nextSampleIndex,
                            prop->firstChangedIndex,
@@ -54,7 +54,11 @@
 #include <assert.h>
 #include <string.h>
 
-#define ALEMBIC_OGAWA_FILE_VERSION 0
+// Version 1 added encoded (possibly compressed) array samples, archives
+// without any of them are still written as version 0 so that older
+// libraries can read them.
+#define ALEMBIC_OGAWA_BASE_FILE_VERSION 0
+#define ALEMBIC_OGAWA_FILE_VERSION 1
 
 //-*****************************************************************************
 
@@ -82,6 +86,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -95,6 +100,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -113,6 +119,7 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isEncoded = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -154,6 +161,10 @@ struct PropertyHeaderAndFriends
 
     bool isHomogenous;
 
+    // whether the samples are written with the encoded sample header
+    // (see Compression.h)
+    bool isEncoded;
+
     // Index of the next sample to write
     Util::uint32_t nextSampleIndex;
 
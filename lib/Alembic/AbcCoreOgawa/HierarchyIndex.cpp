@@ -0,0 +1,209 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/HierarchyIndex.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <cstring>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+template <class POD>
+static inline POD DerefUnaligned( const void * iData )
+{
+    POD ret;
+    memcpy( &ret, iData, sizeof( POD ) );
+    return ret;
+}
+
+//-*****************************************************************************
+HierarchyIndex::HierarchyIndex( Ogawa::IDataPtr iData, std::size_t iThreadId )
+{
+    ABCA_ASSERT( iData && iData->getSize() >= 8,
+                 "Read invalid: Hierarchy index size." );
+
+    m_buf.resize( iData->getSize() );
+    iData->read( m_buf.size(), &( m_buf.front() ), 0, iThreadId );
+
+    std::size_t bufSize = m_buf.size();
+    Util::uint64_t numObjects = DerefUnaligned<Util::uint64_t>( &m_buf[0] );
+
+    ABCA_ASSERT( numObjects <= ( bufSize - 8 ) / 8,
+                 "Read invalid: Hierarchy index number of objects." );
+
+    // every entry is the group position, the size of the full name and
+    // the full name, make sure they are all in bounds so we don't need to
+    // worry about it later
+    m_offsets.resize( numObjects );
+    for ( std::size_t i = 0; i < m_offsets.size(); ++i )
+    {
+        Util::uint64_t offset =
+            DerefUnaligned<Util::uint64_t>( &m_buf[( i + 1 ) * 8] );
+
+        ABCA_ASSERT( offset >= ( numObjects + 1 ) * 8 &&
+                     offset <= bufSize - 12,
+                     "Read invalid: Hierarchy index entry offset." );
+
+        Util::uint32_t nameSize =
+            DerefUnaligned<Util::uint32_t>( &m_buf[offset + 8] );
+
+        ABCA_ASSERT( nameSize > 0 && nameSize <= bufSize - offset - 12,
+                     "Read invalid: Hierarchy index entry name." );
+
+        m_offsets[i] = offset;
+    }
+}
+
+//-*****************************************************************************
+const char * HierarchyIndex::getFullName( std::size_t i,
+                                          std::size_t & oSize ) const
+{
+    oSize = DerefUnaligned<Util::uint32_t>( &m_buf[m_offsets[i] + 8] );
+    return &m_buf[m_offsets[i] + 12];
+}
+
+//-*****************************************************************************
+std::size_t HierarchyIndex::lowerBound( const std::string & iFullName ) const
+{
+    // the entries were written sorted by full name
+    std::size_t first = 0;
+    std::size_t count = m_offsets.size();
+    while ( count > 0 )
+    {
+        std::size_t step = count / 2;
+        std::size_t nameSize = 0;
+        const char * name = getFullName( first + step, nameSize );
+        if ( iFullName.compare( 0, std::string::npos, name, nameSize ) > 0 )
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+//-*****************************************************************************
+std::size_t HierarchyIndex::find( const std::string & iFullName ) const
+{
+    std::size_t i = lowerBound( iFullName );
+    if ( i < m_offsets.size() )
+    {
+        std::size_t nameSize = 0;
+        const char * name = getFullName( i, nameSize );
+        if ( iFullName.compare( 0, std::string::npos, name, nameSize ) == 0 )
+        {
+            return i;
+        }
+    }
+
+    return m_offsets.size();
+}
+
+//-*****************************************************************************
+void HierarchyIndex::getObject( std::size_t i,
+                                const std::vector< AbcA::MetaData > &
+                                iMetaDataVec,
+                                AbcA::ObjectHeader & oHeader,
+                                Util::uint64_t & oGroupPos ) const
+{
+    std::size_t pos = m_offsets[i];
+    oGroupPos = DerefUnaligned<Util::uint64_t>( &m_buf[pos] );
+    pos += 8;
+
+    // the header was written with the full name as its name
+    std::string fullName;
+    ReadObjectHeader( m_buf, pos, "", iMetaDataVec, fullName, &oHeader );
+    oHeader.setName( fullName.substr( fullName.rfind( '/' ) + 1 ) );
+    oHeader.setFullName( fullName );
+}
+
+//-*****************************************************************************
+void HierarchyIndex::getChildren( const std::string & iFullName,
+                                  const std::vector< AbcA::MetaData > &
+                                  iMetaDataVec,
+                                  std::vector< AbcA::ObjectHeader > &
+                                  oHeaders ) const
+{
+    oHeaders.clear();
+
+    std::string prefix = iFullName;
+    if ( prefix.empty() || prefix[prefix.size() - 1] != '/' )
+    {
+        prefix += '/';
+    }
+
+    // everything under iFullName is in one run starting with the prefix
+    std::size_t i = lowerBound( prefix );
+    while ( i < m_offsets.size() )
+    {
+        std::size_t nameSize = 0;
+        const char * name = getFullName( i, nameSize );
+        if ( nameSize < prefix.size() ||
+             prefix.compare( 0, std::string::npos, name, prefix.size() ) != 0 )
+        {
+            break;
+        }
+
+        const char * slash = ( const char * ) memchr( name + prefix.size(),
+            '/', nameSize - prefix.size() );
+        if ( !slash )
+        {
+            AbcA::ObjectHeader header;
+            Util::uint64_t groupPos = 0;
+            getObject( i, iMetaDataVec, header, groupPos );
+            oHeaders.push_back( header );
+            ++i;
+        }
+        else
+        {
+            // skip everything below this child, '0' comes right after '/'
+            std::string skipTo( name, slash - name );
+            skipTo += '0';
+            i = lowerBound( skipTo );
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,99 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_HierarchyIndex_h
+#define Alembic_AbcCoreOgawa_HierarchyIndex_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// reads the index of the object hierarchy written by WriteHierarchyIndex
+// The whole index is read and checked up front, after that it is only ever
+// read from, so it can be used from many threads at once.
+class HierarchyIndex
+{
+public:
+    // throws if iData doesn't hold a well formed index
+    HierarchyIndex( Ogawa::IDataPtr iData, std::size_t iThreadId );
+
+    std::size_t getNumObjects() const { return m_offsets.size(); }
+
+    // what the index takes up in memory
+    std::size_t getNumBytes() const
+    {
+        return sizeof( HierarchyIndex ) + m_buf.capacity() +
+            m_offsets.capacity() * sizeof( std::size_t );
+    }
+
+    // the entry for iFullName, or getNumObjects() if there isn't one
+    std::size_t find( const std::string & iFullName ) const;
+
+    // the first entry whose full name isn't less than iFullName
+    std::size_t lowerBound( const std::string & iFullName ) const;
+
+    // the full name of entry i, without copying it
+    const char * getFullName( std::size_t i, std::size_t & oSize ) const;
+
+    // the header of entry i and where its group is
+    void getObject( std::size_t i,
+                    const std::vector< AbcA::MetaData > & iMetaDataVec,
+                    AbcA::ObjectHeader & oHeader,
+                    Util::uint64_t & oGroupPos ) const;
+
+    // fills oHeaders with the children of iFullName in name order
+    void getChildren( const std::string & iFullName,
+                      const std::vector< AbcA::MetaData > & iMetaDataVec,
+                      std::vector< AbcA::ObjectHeader > & oHeaders ) const;
+
+private:
+    std::vector< char > m_buf;
+    std::vector< std::size_t > m_offsets;
+};
+
+typedef Alembic::Util::shared_ptr<HierarchyIndex> HierarchyIndexPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
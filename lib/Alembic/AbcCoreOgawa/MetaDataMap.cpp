@@ -51,6 +51,7 @@ Util::uint32_t MetaDataMap::getIndex( const std::string & iStr )
     // most likely to be repeated over and over
     else if ( iStr.size() < 256 )
     {
+        Alembic::Util::scoped_lock l( m_lock );
         std::map< std::string, Util::uint32_t >::iterator it =
             m_map.find( iStr );
 
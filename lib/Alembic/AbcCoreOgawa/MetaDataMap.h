@@ -57,6 +57,8 @@ public:
     Util::uint32_t getIndex( const std::string & iStr );
     void write( Ogawa::OGroupPtr iParent );
 private:
+    // objects and properties may be closed on different threads
+    Alembic::Util::mutex m_lock;
     std::map< std::string, Util::uint32_t > m_map;
 };
 
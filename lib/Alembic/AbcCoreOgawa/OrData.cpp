@@ -39,6 +39,7 @@
 #include <Alembic/AbcCoreOgawa/CprData.h>
 #include <Alembic/AbcCoreOgawa/CprImpl.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -50,6 +51,9 @@ OrData::OrData( Ogawa::IGroupPtr iGroup,
                 std::size_t iThreadId,
                 AbcA::ArchiveReader & iArchive,
                 const std::vector< AbcA::MetaData > & iIndexedMetaData )
+    : m_archive( dynamic_cast< ArImpl & >( iArchive ) )
+    // this is made in the archive's ReaderPool, and counted with it
+    , m_numBytes( 0 )
 {
     ABCA_ASSERT( iGroup, "Invalid object data group" );
 
@@ -57,7 +61,34 @@ OrData::OrData( Ogawa::IGroupPtr iGroup,
 
     std::size_t numChildren = m_group->getNumChildren();
 
-    if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
+    if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) &&
+         m_archive.lazyHeaders() )
+    {
+        m_parentName = iParentName;
+        ReadObjectHeadersBuffer( m_group, numChildren - 1, iThreadId,
+                                 m_headerBuf );
+
+        std::size_t pos = 0;
+        std::string name;
+        while ( pos < m_headerBuf.size() )
+        {
+            std::size_t start = pos;
+            ReadObjectHeader( m_headerBuf, pos, iParentName, iIndexedMetaData,
+                              name, NULL );
+            m_childrenMap[name] = m_headerOffsets.size();
+            m_headerOffsets.push_back( start );
+        }
+
+        m_lazyChildren.resize( m_headerOffsets.size() );
+
+        m_numBytes += m_parentName.capacity() + m_headerBuf.capacity() +
+            m_headerOffsets.capacity() * sizeof( std::size_t ) +
+            m_lazyChildren.capacity() * sizeof( void * ) +
+            m_childrenMap.size() * ( sizeof( std::string ) +
+                                     sizeof( std::size_t ) +
+                                     4 * sizeof( void * ) );
+    }
+    else if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
     {
         std::vector< ObjectHeaderPtr > headers;
         ReadObjectHeaders( m_group, numChildren - 1, iThreadId,
@@ -73,20 +104,28 @@ OrData::OrData( Ogawa::IGroupPtr iGroup,
         {
             m_childrenMap[headers[i]->getName()] = i;
             m_children[i].header = headers[i];
+            m_numBytes += sizeof( Child ) + HeaderBytes( *headers[i] );
         }
     }
 
+    // the positions of the children
+    m_numBytes += numChildren * sizeof( Util::uint64_t );
+
     if ( numChildren > 0 && m_group->isChildGroup( 0 ) )
     {
         Ogawa::IGroupPtr group = m_group->getGroup( 0, false, iThreadId );
-        m_data = Alembic::Util::shared_ptr<CprData>(
-            new CprData( group, iThreadId, iArchive, iIndexedMetaData ) );
+        m_data = MakeReader< CprData >( m_archive.getReaderPool(), group,
+                                        iThreadId, iArchive,
+                                        iIndexedMetaData );
     }
+
+    m_archive.addHeaderBytes( m_numBytes );
 }
 
 //-*****************************************************************************
 OrData::~OrData()
 {
+    m_archive.addHeaderBytes( -m_numBytes );
 }
 
 //-*****************************************************************************
@@ -99,14 +138,47 @@ OrData::getProperties( AbcA::ObjectReaderPtr iParent )
     if ( ! ret )
     {
         // time to make a new one
-        ret = Alembic::Util::shared_ptr<CprImpl>(
-            new CprImpl( iParent, m_data ) );
+        ret = MakeReader< CprImpl >( m_archive.getReaderPool(), iParent,
+                                     m_data );
         m_top = ret;
     }
 
     return ret;
 }
 
+//-*****************************************************************************
+OrData::Child & OrData::getChildSlot( AbcA::ObjectReaderPtr iParent, size_t i )
+{
+    if ( m_children )
+    {
+        return m_children[i];
+    }
+
+    Alembic::Util::scoped_lock l( m_lazyLock );
+    Alembic::Util::unique_ptr< Child > & child = m_lazyChildren[i];
+    if ( !child )
+    {
+        Alembic::Util::shared_ptr< ArImpl > implPtr =
+            Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+                iParent->getArchive() );
+
+        ObjectHeaderPtr header( new AbcA::ObjectHeader() );
+        std::size_t pos = m_headerOffsets[i];
+        std::string name;
+        ReadObjectHeader( m_headerBuf, pos, m_parentName,
+                          implPtr->getIndexedMetaData(), name, header.get() );
+
+        child.reset( new Child() );
+        child->header = header;
+
+        Util::int64_t numBytes = sizeof( Child ) + HeaderBytes( *header );
+        m_numBytes += numBytes;
+        m_archive.addHeaderBytes( numBytes );
+    }
+
+    return *child;
+}
+
 //-*****************************************************************************
 size_t OrData::getNumChildren()
 {
@@ -120,7 +192,7 @@ OrData::getChildHeader( AbcA::ObjectReaderPtr iParent, size_t i )
     ABCA_ASSERT( i < m_childrenMap.size(),
         "Out of range index in OrData::getChildHeader: " << i );
 
-    return *( m_children[i].header );
+    return *( getChildSlot( iParent, i ).header );
 }
 
 //-*****************************************************************************
@@ -157,15 +229,16 @@ OrData::getChild( AbcA::ObjectReaderPtr iParent, size_t i )
     ABCA_ASSERT( i < m_childrenMap.size(),
         "Out of range index in OrData::getChild: " << i );
 
-    Alembic::Util::scoped_lock l( m_children[i].lock );
-    AbcA::ObjectReaderPtr optr = m_children[i].made.lock();
+    Child & child = getChildSlot( iParent, i );
+    Alembic::Util::scoped_lock l( child.lock );
+    AbcA::ObjectReaderPtr optr = child.made.lock();
 
     if ( ! optr )
     {
         // Make a new one.
-        optr = Alembic::Util::shared_ptr<OrImpl>(
-            new OrImpl( iParent, m_group, i + 1, m_children[i].header ) );
-        m_children[i].made = optr;
+        optr = MakeReader< OrImpl >( m_archive.getReaderPool(), iParent,
+                                     m_group, i + 1, child.header );
+        child.made = optr;
     }
 
     return optr;
@@ -44,6 +44,7 @@ namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
 class CprData;
+class ArImpl;
 
 // data class owned by OrImpl, or ArImpl if it is a "top" object.
 // it owns and makes child objects
@@ -93,14 +94,28 @@ private:
 
     typedef std::map<std::string, size_t> ChildrenMap;
 
+    Child & getChildSlot( AbcA::ObjectReaderPtr iParent, size_t i );
+
     // The children
     Alembic::Util::unique_ptr< Child[] > m_children;
     ChildrenMap m_childrenMap;
 
+    // With lazy headers m_children is NULL, the encoded headers are kept in
+    // m_headerBuf and each Child is made on first use.
+    std::string m_parentName;
+    std::vector< char > m_headerBuf;
+    std::vector< std::size_t > m_headerOffsets;
+    std::vector< Alembic::Util::unique_ptr< Child > > m_lazyChildren;
+    Alembic::Util::mutex m_lazyLock;
+
     // Our "top" property.
     Alembic::Util::weak_ptr< AbcA::CompoundPropertyReader > m_top;
     Alembic::Util::shared_ptr < CprData > m_data;
     Alembic::Util::mutex m_cprlock;
+
+    // what the headers take up, which the archive keeps a tally of
+    ArImpl & m_archive;
+    Util::int64_t m_numBytes;
 };
 
 typedef Alembic::Util::shared_ptr<OrData> OrDataPtr;
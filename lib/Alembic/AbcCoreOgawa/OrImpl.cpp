@@ -68,8 +68,9 @@ OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
     StreamIDPtr streamId = m_archive->getStreamID();
     std::size_t id = streamId->getID();
     Ogawa::IGroupPtr group = iParentGroup->getGroup( iGroupIndex, false, id );
-    m_data.reset( new OrData( group, iHeader->getFullName(), id,
-        *m_archive, m_archive->getIndexedMetaData() ) );
+    m_data = MakeReader< OrData >( m_archive->getReaderPool(), group,
+        iHeader->getFullName(), id, *m_archive,
+        m_archive->getIndexedMetaData() );
 }
 
 //-*****************************************************************************
@@ -86,6 +87,23 @@ OrImpl::OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
     ABCA_ASSERT( m_header, "Invalid header in OrImpl(Archive)" );
 }
 
+//-*****************************************************************************
+OrImpl::OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
+                Ogawa::IGroupPtr iGroup,
+                ObjectHeaderPtr iHeader )
+    : m_archive( iArchive )
+    , m_header( iHeader )
+{
+    ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Found)" );
+    ABCA_ASSERT( m_header, "Invalid header in OrImpl(Found)" );
+
+    StreamIDPtr streamId = m_archive->getStreamID();
+    std::size_t id = streamId->getID();
+    m_data = MakeReader< OrData >( m_archive->getReaderPool(), iGroup,
+        iHeader->getFullName(), id, *m_archive,
+        m_archive->getIndexedMetaData() );
+}
+
 //-*****************************************************************************
 OrImpl::~OrImpl()
 {
@@ -107,6 +125,14 @@ AbcA::ArchiveReaderPtr OrImpl::getArchive()
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getParent()
 {
+    // objects found straight from the archive don't hold on to their parent
+    const std::string & fullName = m_header->getFullName();
+    if ( !m_parent && fullName != "/" )
+    {
+        return m_archive->findObject(
+            fullName.substr( 0, fullName.rfind( '/' ) ) );
+    }
+
     return m_parent;
 }
 
@@ -62,6 +62,12 @@ public:
             std::size_t iIndex,
             ObjectHeaderPtr iHeader );
 
+    // an object found straight from the archive (see ArImpl::findObject),
+    // its parent is only looked up if it is asked for
+    OrImpl( Alembic::Util::shared_ptr< ArImpl > iArchive,
+            Ogawa::IGroupPtr iGroup,
+            ObjectHeaderPtr iHeader );
+
     virtual ~OrImpl();
 
     //-*************************************************************************
@@ -223,6 +223,14 @@ void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
     m_data->writePropertyHeaders( iMetaDataMap );
 }
 
+//-*****************************************************************************
+Util::uint64_t OwData::freezeGroup()
+{
+    m_group->freeze();
+    return m_group->getPos();
+}
+
+//-*****************************************************************************
 void OwData::fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                        Util::uint64_t iHash1 )
 {
@@ -77,6 +77,10 @@ public:
 
     void writeHeaders( MetaDataMapPtr iMetaDataMap, Util::SpookyHash & ioHash );
 
+    // freezes our group, which nothing is added to after writeHeaders, and
+    // returns where it was written
+    Util::uint64_t freezeGroup();
+
     void fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
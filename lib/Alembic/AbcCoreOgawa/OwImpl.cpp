@@ -79,13 +79,20 @@ OwImpl::~OwImpl()
     // The archive is responsible for writing the MetaData
     if ( m_parent )
     {
-        MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
-            AwImpl, AbcA::ArchiveWriter >( m_archive )->getMetaDataMap();
+        Util::shared_ptr< AwImpl > archive =
+            Alembic::Util::dynamic_pointer_cast< AwImpl,
+                AbcA::ArchiveWriter >( m_archive );
+        MetaDataMapPtr mdMap = archive->getMetaDataMap();
 
         Util::SpookyHash hash;
         hash.Init(0, 0);
         m_data->writeHeaders( mdMap, hash );
 
+        if ( archive->writesHierarchyIndex() )
+        {
+            archive->addToHierarchyIndex( m_header, m_data->freezeGroup() );
+        }
+
         // writeHeaders bakes in the child hashes and the data hash
         // but we still need to bake in the name and MetaData
         std::string metaDataStr = m_header->getMetaData().serialize();
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/Compression.h>
 
 #if defined(_MSC_VER)
 #  if defined(max)
@@ -51,27 +52,64 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+// the size of the sample data, not counting the key or the encoded header
+static Util::uint64_t
+GetSampleSize( Ogawa::IDataPtr iData, size_t iThreadId, bool iIsEncoded )
+{
+    if ( iData->getSize() <= 16 )
+    {
+        return 0;
+    }
+    else if ( iIsEncoded )
+    {
+        return ReadEncodedSize( iData, iThreadId );
+    }
+
+    return iData->getSize() - 16;
+}
+
+//-*****************************************************************************
+// reads iSize bytes of the sample data, skipping over the key
+static void
+ReadSampleBytes( Ogawa::IDataPtr iData, size_t iThreadId, bool iIsEncoded,
+                 Util::uint64_t iSize, void * oBuffer )
+{
+    if ( iIsEncoded )
+    {
+        ReadEncodedData( iData, iThreadId, oBuffer, iSize );
+    }
+    else
+    {
+        iData->read( iSize, oBuffer, 16, iThreadId );
+    }
+}
+
 //-*****************************************************************************
 void
 ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
-                Util::Dimensions & oDim )
+                Util::Dimensions & oDim,
+                bool iIsEncoded )
 {
     if ( iData->getSize() < 16 )
     {
         oDim = Util::Dimensions( 0 );
+        return;
     }
+
+    Util::uint64_t sampleSize = GetSampleSize( iData, iThreadId, iIsEncoded );
+
     // find it based on of the size of the data
-    else if ( iDims->getSize() == 0 )
+    if ( iDims->getSize() == 0 )
     {
-        std::size_t numItems =
-            ( iData->getSize() - 16 ) / iDataType.getNumBytes();
+        std::size_t numItems = sampleSize / iDataType.getNumBytes();
 
         // for misshaped data bump up our dimensions by 1 so we have
         // more allocated for the partial read
-        if (( iData->getSize() - 16 ) % iDataType.getNumBytes() != 0)
+        if ( sampleSize % iDataType.getNumBytes() != 0 )
         {
             numItems += 1;
         }
@@ -103,15 +141,13 @@ ReadDimensions( Ogawa::IDataPtr iDims,
         // suggest we should, so calculate them based on what we have
         if ( iDataType.getPod() != Alembic::Util::kStringPOD &&
              iDataType.getPod() != Alembic::Util::kWstringPOD &&
-             (iDataType.getNumBytes() * oDim.numPoints() !=
-                iData->getSize() - 16) )
+             (iDataType.getNumBytes() * oDim.numPoints() != sampleSize) )
         {
-            std::size_t numItems =
-                ( iData->getSize() - 16 ) / iDataType.getNumBytes();
+            std::size_t numItems = sampleSize / iDataType.getNumBytes();
 
             // for misshaped data bump up our dimensions by 1 so we have
             // more allocated for the partial read
-            if (( iData->getSize() - 16 ) % iDataType.getNumBytes() != 0)
+            if ( sampleSize % iDataType.getNumBytes() != 0 )
             {
                 numItems += 1;
             }
@@ -1340,7 +1376,8 @@ ReadData( void * iIntoLocation,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
           Util::PlainOldDataType iAsPod,
-          size_t iNumData )
+          size_t iNumData,
+          bool iIsEncoded )
 {
     Alembic::Util::PlainOldDataType curPod = iDataType.getPod();
     ABCA_ASSERT( ( iAsPod == curPod ) || (
@@ -1364,9 +1401,12 @@ ReadData( void * iIntoLocation,
         return;
     }
 
+    // the size of the data without the key
+    std::size_t numBytes = GetSampleSize( iData, iThreadId, iIsEncoded );
+
     if ( curPod == Alembic::Util::kStringPOD )
     {
-        if ( dataSize <= 16 )
+        if ( numBytes == 0 )
         {
             return;
         }
@@ -1374,9 +1414,9 @@ ReadData( void * iIntoLocation,
         std::string * strPtr =
             reinterpret_cast< std::string * > ( iIntoLocation );
 
-        std::size_t numChars = dataSize - 16;
+        std::size_t numChars = numBytes;
         char * buf = new char[ numChars ];
-        iData->read( numChars, buf, 16, iThreadId );
+        ReadSampleBytes( iData, iThreadId, iIsEncoded, numChars, buf );
 
         std::size_t startStr = 0;
         std::size_t strPos = 0;
@@ -1395,7 +1435,7 @@ ReadData( void * iIntoLocation,
     }
     else if ( curPod == Alembic::Util::kWstringPOD )
     {
-        if ( dataSize <= 16 )
+        if ( numBytes == 0 )
         {
             return;
         }
@@ -1403,9 +1443,10 @@ ReadData( void * iIntoLocation,
         std::wstring * wstrPtr =
             reinterpret_cast< std::wstring * > ( iIntoLocation );
 
-        std::size_t numChars = ( dataSize - 16 ) / 4;
-        Util::uint32_t * buf = new Util::uint32_t[ numChars ];
-        iData->read( numChars * 4, buf, 16, iThreadId );
+        // round up so there is room for all of the bytes of misshaped data
+        std::size_t numChars = numBytes / 4;
+        Util::uint32_t * buf = new Util::uint32_t[ ( numBytes + 3 ) / 4 ];
+        ReadSampleBytes( iData, iThreadId, iIsEncoded, numBytes, buf );
 
         std::size_t strPos = 0;
 
@@ -1429,14 +1470,13 @@ ReadData( void * iIntoLocation,
     else if ( iAsPod == curPod )
     {
         // don't read the key
-        iData->read( dataSize - 16, iIntoLocation, 16, iThreadId );
+        ReadSampleBytes( iData, iThreadId, iIsEncoded, numBytes,
+                         iIntoLocation );
     }
     else if ( PODNumBytes( curPod ) <= PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
-        std::size_t numBytes = dataSize - 16;
-
-        iData->read( numBytes, iIntoLocation, 16, iThreadId );
+        ReadSampleBytes( iData, iThreadId, iIsEncoded, numBytes,
+                         iIntoLocation );
 
         char * buf = static_cast< char * >( iIntoLocation );
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
@@ -1444,12 +1484,9 @@ ReadData( void * iIntoLocation,
     }
     else if ( PODNumBytes( curPod ) > PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
-        std::size_t numBytes = dataSize - 16;
-
         // read into a temporary buffer and cast them one at a time
         char * buf = new char[ numBytes ];
-        iData->read( numBytes, buf, 16, iThreadId );
+        ReadSampleBytes( iData, iThreadId, iIsEncoded, numBytes, buf );
 
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
 
@@ -1464,16 +1501,71 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample )
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iIsEncoded,
+                 AbcA::SampleBufferAllocatorPtr iAllocator )
 {
     // get our dimensions
     Util::Dimensions dims;
-    ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
+    ReadDimensions( iDims, iData, iThreadId, iDataType, dims, iIsEncoded );
 
-    oSample = AbcA::AllocateArraySample( iDataType, dims );
+    oSample = AbcA::AllocateArraySample( iDataType, dims, iAllocator );
     size_t numPODs = dims.numPoints() * iDataType.getExtent();
     ReadData( const_cast<void*>( oSample->getData() ), iData,
-        iThreadId, iDataType, iDataType.getPod(), numPODs );
+        iThreadId, iDataType, iDataType.getPod(), numPODs, iIsEncoded );
+}
+
+//-*****************************************************************************
+// keeps the IData, and so the memory mapped file, alive for as long as the
+// sample pointing into it is
+namespace
+{
+struct MappedSampleDeleter
+{
+    explicit MappedSampleDeleter( Ogawa::IDataPtr iData ) : data( iData ) {}
+
+    void operator()( AbcA::ArraySample * iSample ) const
+    {
+        delete iSample;
+    }
+
+    Ogawa::IDataPtr data;
+};
+}
+
+//-*****************************************************************************
+bool
+MapArraySample( Ogawa::IDataPtr iData,
+                const AbcA::DataType &iDataType,
+                const Util::Dimensions &iDims,
+                AbcA::ArraySamplePtr &oSample,
+                bool iIsEncoded )
+{
+    Util::PlainOldDataType pod = iDataType.getPod();
+    if ( iIsEncoded || !iData || iData->getSize() <= 16 ||
+         pod == Util::kStringPOD || pod == Util::kWstringPOD )
+    {
+        return false;
+    }
+
+    Util::uint64_t numBytes = iData->getSize() - 16;
+    if ( iDims.numPoints() * iDataType.getNumBytes() != numBytes )
+    {
+        return false;
+    }
+
+    // don't read the key
+    const void * mapped = iData->getMappedData( numBytes, 16 );
+    if ( !mapped ||
+         reinterpret_cast< std::size_t >( mapped ) % PODNumBytes( pod ) != 0 )
+    {
+        return false;
+    }
+
+    oSample = AbcA::ArraySamplePtr(
+        new AbcA::ArraySample( mapped, iDataType, iDims ),
+        MappedSampleDeleter( iData ) );
+    return true;
 }
 
 //-*****************************************************************************
@@ -1551,85 +1643,118 @@ ReadTimeSamplesAndMax( Ogawa::IDataPtr iData,
 
 //-*****************************************************************************
 void
-ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
-                   size_t iIndex,
-                   size_t iThreadId,
-                   const std::string & iParentName,
-                   const std::vector< AbcA::MetaData > & iMetaDataVec,
-                   std::vector< ObjectHeaderPtr > & oHeaders )
+ReadObjectHeadersBuffer( Ogawa::IGroupPtr iGroup,
+                         size_t iIndex,
+                         size_t iThreadId,
+                         std::vector< char > & oBuf )
 {
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
 
+    oBuf.clear();
     if ( data->getSize() <= 32 )
     {
         return;
     }
 
     // skip the last 32 bytes which contains the hashes
-    std::vector< char > buf( data->getSize() - 32 );
-    if ( buf.empty() )
+    oBuf.resize( data->getSize() - 32 );
+    data->read( oBuf.size(), &( oBuf.front() ), 0, iThreadId );
+}
+
+//-*****************************************************************************
+void
+ReadObjectHeader( const std::vector< char > & iBuf,
+                  std::size_t & ioPos,
+                  const std::string & iParentName,
+                  const std::vector< AbcA::MetaData > & iMetaDataVec,
+                  std::string & oName,
+                  AbcA::ObjectHeader * oHeader )
+{
+    const std::vector< char > & buf = iBuf;
+    std::size_t bufSize = buf.size();
+    std::size_t pos = ioPos;
+
+    if (pos + 4 > bufSize)
     {
-        return;
+        ABCA_THROW("Read invalid: Object Headers name size.");
     }
 
-    std::size_t bufSize = buf.size();
-    data->read( bufSize, &( buf.front() ), 0, iThreadId );
-    std::size_t pos = 0;
-    while ( pos < bufSize )
+    Util::uint32_t nameSize = DerefUnaligned<Util::uint32_t>(&buf[pos]);
+    pos += 4;
+
+    if (nameSize == 0 || pos + nameSize + 1 > bufSize)
+    {
+        ABCA_THROW("Read invalid: Object Headers name and MetaData index.");
+    }
+
+    oName.assign( &buf[pos], nameSize );
+    pos += nameSize;
+
+    Util::uint8_t metaDataIndex = buf[pos++];
+
+    if ( oHeader )
+    {
+        oHeader->setName( oName );
+        oHeader->setFullName( iParentName + "/" + oName );
+    }
+
+    if ( metaDataIndex == 0xff )
     {
         if (pos + 4 > bufSize)
         {
-            ABCA_THROW("Read invalid: Object Headers name size.");
+            ABCA_THROW("Read invalid: Object Headers MetaData size.");
         }
 
-        Util::uint32_t nameSize = DerefUnaligned<Util::uint32_t>(&buf[pos]);
+        Util::uint32_t metaDataSize = DerefUnaligned<Util::uint32_t>(&buf[pos]);
         pos += 4;
 
-        if (nameSize == 0 || pos + nameSize + 1 > bufSize)
+        if (pos + metaDataSize > bufSize)
         {
-            ABCA_THROW("Read invalid: Object Headers name and MetaData index.");
+            ABCA_THROW("Read invalid: Object Headers MetaData string.");
         }
 
-        std::string name( &buf[pos], nameSize );
-        pos += nameSize;
-
-        Util::uint8_t metaDataIndex = buf[pos++];
-
-        ObjectHeaderPtr objPtr( new AbcA::ObjectHeader() );
-        objPtr->setName( name );
-        objPtr->setFullName( iParentName + "/" + name );
-
-        if ( metaDataIndex == 0xff )
+        if ( oHeader )
         {
-            if (pos + 4 > bufSize)
-            {
-                ABCA_THROW("Read invalid: Object Headers MetaData size.");
-            }
-
-            Util::uint32_t metaDataSize = DerefUnaligned<Util::uint32_t>(&buf[pos]);
-            pos += 4;
-
-            if (pos + metaDataSize > bufSize)
-            {
-                ABCA_THROW("Read invalid: Object Headers MetaData string.");
-            }
-
             std::string metaData( &buf[pos], metaDataSize );
-            pos += metaDataSize;
-
-            objPtr->getMetaData().deserialize( metaData );
+            oHeader->getMetaData().deserialize( metaData );
         }
-        else if ( metaDataIndex < iMetaDataVec.size() )
-        {
-            objPtr->getMetaData() = iMetaDataVec[metaDataIndex];
-        }
-        else
+        pos += metaDataSize;
+    }
+    else if ( metaDataIndex < iMetaDataVec.size() )
+    {
+        if ( oHeader )
         {
-            ABCA_THROW("Read invalid: Object Headers MetaData index.");
+            oHeader->getMetaData() = iMetaDataVec[metaDataIndex];
         }
+    }
+    else
+    {
+        ABCA_THROW("Read invalid: Object Headers MetaData index.");
+    }
+
+    ioPos = pos;
+}
 
+//-*****************************************************************************
+void
+ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
+                   size_t iIndex,
+                   size_t iThreadId,
+                   const std::string & iParentName,
+                   const std::vector< AbcA::MetaData > & iMetaDataVec,
+                   std::vector< ObjectHeaderPtr > & oHeaders )
+{
+    std::vector< char > buf;
+    ReadObjectHeadersBuffer( iGroup, iIndex, iThreadId, buf );
 
+    std::size_t pos = 0;
+    std::string name;
+    while ( pos < buf.size() )
+    {
+        ObjectHeaderPtr objPtr( new AbcA::ObjectHeader() );
+        ReadObjectHeader( buf, pos, iParentName, iMetaDataVec, name,
+                          objPtr.get() );
         oHeaders.push_back( objPtr );
     }
 }
@@ -1667,12 +1792,32 @@ Util::uint32_t GetUint32WithHint(const std::vector< char > & iBuf,
 
 //-*****************************************************************************
 void
-ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
-                     size_t iIndex,
-                     size_t iThreadId,
-                     AbcA::ArchiveReader & iArchive,
-                     const std::vector< AbcA::MetaData > & iMetaDataVec,
-                     PropertyHeaderPtrs & oHeaders )
+ReadPropertyHeadersBuffer( Ogawa::IGroupPtr iGroup,
+                           size_t iIndex,
+                           size_t iThreadId,
+                           std::vector< char > & oBuf )
+{
+    Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
+    ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
+
+    oBuf.clear();
+    if ( data->getSize() == 0 )
+    {
+        return;
+    }
+
+    oBuf.resize( data->getSize() );
+    data->read( data->getSize(), &( oBuf.front() ), 0, iThreadId );
+}
+
+//-*****************************************************************************
+void
+ReadPropertyHeader( const std::vector< char > & iBuf,
+                    std::size_t & ioPos,
+                    AbcA::ArchiveReader & iArchive,
+                    const std::vector< AbcA::MetaData > & iMetaDataVec,
+                    std::string & oName,
+                    PropertyHeaderAndFriends * oHeader )
 {
 
     // Our bitmasks look like this:
@@ -1720,163 +1865,190 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the samples have the encoded sample header mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
 
-    Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
-    ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
+    const std::vector< char > & buf = iBuf;
+    std::size_t bufSize = buf.size();
+    std::size_t pos = ioPos;
 
-    if ( data->getSize() == 0 )
+    // when we are only after the name, everything else is read into here
+    // and thrown away
+    PropertyHeaderAndFriends skipped;
+    PropertyHeaderAndFriends * header = oHeader ? oHeader : &skipped;
+
+    if (pos + 4 > bufSize)
     {
-        return;
+        ABCA_THROW("Read invalid: Property header start.");
     }
 
-    std::vector< char > buf( data->getSize() );
-    data->read( data->getSize(), &( buf.front() ), 0, iThreadId );
-    std::size_t pos = 0;
-    std::size_t bufSize = buf.size();
-    while ( pos < bufSize )
+    // first 4 bytes is always info
+    Util::uint32_t info = DerefUnaligned<Util::uint32_t>(&buf[pos]);
+    pos += 4;
+
+    Util::uint32_t ptype = info & 0x0003;
+    header->isScalarLike = ptype & 1;
+    if ( ptype == 0 )
     {
-        PropertyHeaderPtr header( new PropertyHeaderAndFriends() );
+        header->header.setPropertyType( AbcA::kCompoundProperty );
+    }
+    else if ( ptype == 1 )
+    {
+        header->header.setPropertyType( AbcA::kScalarProperty );
+    }
+    else
+    {
+        header->header.setPropertyType( AbcA::kArrayProperty );
+    }
 
-        if (pos + 4 > bufSize)
+    Util::uint32_t sizeHint = ( info & 0x000c ) >> 2;
+
+    // if we aren't a compound we may need to do a bunch of other work
+    if ( !header->header.isCompound() )
+    {
+        // Read the pod type out of bits 4-7
+        char podt = ( char )( ( info &  0x00f0 ) >> 4 );
+        if ( podt != ( char )Alembic::Util::kBooleanPOD &&
+             podt != ( char )Alembic::Util::kUint8POD &&
+             podt != ( char )Alembic::Util::kInt8POD &&
+             podt != ( char )Alembic::Util::kUint16POD &&
+             podt != ( char )Alembic::Util::kInt16POD &&
+             podt != ( char )Alembic::Util::kUint32POD &&
+             podt != ( char )Alembic::Util::kInt32POD &&
+             podt != ( char )Alembic::Util::kUint64POD &&
+             podt != ( char )Alembic::Util::kInt64POD &&
+             podt != ( char )Alembic::Util::kFloat16POD &&
+             podt != ( char )Alembic::Util::kFloat32POD &&
+             podt != ( char )Alembic::Util::kFloat64POD &&
+             podt != ( char )Alembic::Util::kStringPOD &&
+             podt != ( char )Alembic::Util::kWstringPOD )
         {
-            ABCA_THROW("Read invalid: Property header start.");
+            ABCA_THROW(
+                "Read invalid POD type: " << ( Util::int32_t )podt );
         }
 
-        // first 4 bytes is always info
-        Util::uint32_t info = DerefUnaligned<Util::uint32_t>(&buf[pos]);
-        pos += 4;
+        Util::uint8_t extent = ( info & 0xff000 ) >> 12;
+        header->header.setDataType( AbcA::DataType(
+            ( Util::PlainOldDataType ) podt, extent ) );
 
-        Util::uint32_t ptype = info & 0x0003;
-        header->isScalarLike = ptype & 1;
-        if ( ptype == 0 )
+        header->isHomogenous = ( info & 0x400 ) != 0;
+        header->isEncoded = ( info & 0x10000000 ) != 0;
+
+        header->nextSampleIndex = GetUint32WithHint( buf, bufSize, sizeHint, pos );
+
+        if ( ( info & 0x0200 ) != 0 )
         {
-            header->header.setPropertyType( AbcA::kCompoundProperty );
+            header->firstChangedIndex =
+                GetUint32WithHint( buf, bufSize, sizeHint, pos );
+
+            header->lastChangedIndex =
+                GetUint32WithHint( buf, bufSize, sizeHint, pos );
         }
-        else if ( ptype == 1 )
+        else if ( ( info & 0x800 ) != 0 )
         {
-            header->header.setPropertyType( AbcA::kScalarProperty );
+            header->firstChangedIndex = 0;
+            header->lastChangedIndex = 0;
         }
         else
         {
-            header->header.setPropertyType( AbcA::kArrayProperty );
+            header->firstChangedIndex = 1;
+            header->lastChangedIndex = header->nextSampleIndex - 1;
         }
 
-        Util::uint32_t sizeHint = ( info & 0x000c ) >> 2;
-
-        // if we aren't a compound we may need to do a bunch of other work
-        if ( !header->header.isCompound() )
+        if ( ( info & 0x0100 ) != 0 )
         {
-            // Read the pod type out of bits 4-7
-            char podt = ( char )( ( info &  0x00f0 ) >> 4 );
-            if ( podt != ( char )Alembic::Util::kBooleanPOD &&
-                 podt != ( char )Alembic::Util::kUint8POD &&
-                 podt != ( char )Alembic::Util::kInt8POD &&
-                 podt != ( char )Alembic::Util::kUint16POD &&
-                 podt != ( char )Alembic::Util::kInt16POD &&
-                 podt != ( char )Alembic::Util::kUint32POD &&
-                 podt != ( char )Alembic::Util::kInt32POD &&
-                 podt != ( char )Alembic::Util::kUint64POD &&
-                 podt != ( char )Alembic::Util::kInt64POD &&
-                 podt != ( char )Alembic::Util::kFloat16POD &&
-                 podt != ( char )Alembic::Util::kFloat32POD &&
-                 podt != ( char )Alembic::Util::kFloat64POD &&
-                 podt != ( char )Alembic::Util::kStringPOD &&
-                 podt != ( char )Alembic::Util::kWstringPOD )
-            {
-                ABCA_THROW(
-                    "Read invalid POD type: " << ( Util::int32_t )podt );
-            }
-
-            Util::uint8_t extent = ( info & 0xff000 ) >> 12;
-            header->header.setDataType( AbcA::DataType(
-                ( Util::PlainOldDataType ) podt, extent ) );
-
-            header->isHomogenous = ( info & 0x400 ) != 0;
-
-            header->nextSampleIndex = GetUint32WithHint( buf, bufSize, sizeHint, pos );
-
-            if ( ( info & 0x0200 ) != 0 )
-            {
-                header->firstChangedIndex =
-                    GetUint32WithHint( buf, bufSize, sizeHint, pos );
-
-                header->lastChangedIndex =
-                    GetUint32WithHint( buf, bufSize, sizeHint, pos );
-            }
-            else if ( ( info & 0x800 ) != 0 )
-            {
-                header->firstChangedIndex = 0;
-                header->lastChangedIndex = 0;
-            }
-            else
-            {
-                header->firstChangedIndex = 1;
-                header->lastChangedIndex = header->nextSampleIndex - 1;
-            }
+            header->timeSamplingIndex =
+                GetUint32WithHint( buf, bufSize, sizeHint, pos );
 
-            if ( ( info & 0x0100 ) != 0 )
+            if ( oHeader )
             {
-                header->timeSamplingIndex =
-                    GetUint32WithHint( buf, bufSize, sizeHint, pos );
-
                 header->header.setTimeSampling(
                     iArchive.getTimeSampling( header->timeSamplingIndex ) );
             }
-            else
-            {
-                header->header.setTimeSampling( iArchive.getTimeSampling( 0 ) );
-            }
         }
-
-        Util::uint32_t nameSize = GetUint32WithHint( buf, bufSize, sizeHint, pos );
-        if ( nameSize == 0 || pos + nameSize > bufSize )
+        else if ( oHeader )
         {
-            ABCA_THROW("Read invalid: Property Headers name.");
+            header->header.setTimeSampling( iArchive.getTimeSampling( 0 ) );
         }
+    }
 
-        std::string name( &buf[pos], nameSize );
-        header->header.setName( name );
-        pos += nameSize;
+    Util::uint32_t nameSize = GetUint32WithHint( buf, bufSize, sizeHint, pos );
+    if ( nameSize == 0 || pos + nameSize > bufSize )
+    {
+        ABCA_THROW("Read invalid: Property Headers name.");
+    }
 
-        Util::uint32_t metaDataIndex = ( info & 0xff00000 ) >> 20;
+    oName.assign( &buf[pos], nameSize );
+    if ( oHeader )
+    {
+        header->header.setName( oName );
+    }
+    pos += nameSize;
 
-        if ( metaDataIndex == 0xff )
-        {
-            Util::uint32_t metaDataSize =
-                GetUint32WithHint( buf, bufSize, sizeHint, pos );
+    Util::uint32_t metaDataIndex = ( info & 0xff00000 ) >> 20;
 
-            if (pos + metaDataSize > bufSize)
-            {
-                ABCA_THROW("Read invalid: Property Header MetaData string.");
-            }
-            // found empty metadata
-            else if (pos == bufSize)
-            {
-                pos += metaDataSize;
-                AbcA::MetaData md;
-                header->header.setMetaData( md );
-            }
-            else
+    if ( metaDataIndex == 0xff )
+    {
+        Util::uint32_t metaDataSize =
+            GetUint32WithHint( buf, bufSize, sizeHint, pos );
+
+        if (pos + metaDataSize > bufSize)
+        {
+            ABCA_THROW("Read invalid: Property Header MetaData string.");
+        }
+        // found empty metadata
+        else if (pos == bufSize)
+        {
+            pos += metaDataSize;
+        }
+        else
+        {
+            if ( oHeader )
             {
                 std::string metaData( &buf[pos], metaDataSize );
-                pos += metaDataSize;
-
                 AbcA::MetaData md;
                 md.deserialize( metaData );
                 header->header.setMetaData( md );
             }
+            pos += metaDataSize;
         }
-        else if (metaDataIndex < iMetaDataVec.size())
+    }
+    else if (metaDataIndex < iMetaDataVec.size())
+    {
+        if ( oHeader )
         {
             header->header.setMetaData( iMetaDataVec[metaDataIndex] );
         }
-        else
-        {
-            ABCA_THROW("Read invalid: Property Header MetaData index.");
-        }
+    }
+    else
+    {
+        ABCA_THROW("Read invalid: Property Header MetaData index.");
+    }
 
-        oHeaders.push_back( header );
+    ioPos = pos;
+}
 
+//-*****************************************************************************
+void
+ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
+                     size_t iIndex,
+                     size_t iThreadId,
+                     AbcA::ArchiveReader & iArchive,
+                     const std::vector< AbcA::MetaData > & iMetaDataVec,
+                     PropertyHeaderPtrs & oHeaders )
+{
+    std::vector< char > buf;
+    ReadPropertyHeadersBuffer( iGroup, iIndex, iThreadId, buf );
+
+    std::size_t pos = 0;
+    std::string name;
+    while ( pos < buf.size() )
+    {
+        PropertyHeaderPtr header( new PropertyHeaderAndFriends() );
+        ReadPropertyHeader( buf, pos, iArchive, iMetaDataVec, name,
+                            header.get() );
+        oHeaders.push_back( header );
     }
 }
 
@@ -1936,6 +2108,30 @@ ReadIndexedMetaData( Ogawa::IDataPtr iData,
     }
 }
 
+//-*****************************************************************************
+// a std::map< std::string, size_t > node, the key, value and 3 pointers and
+// the color, plus whatever the key has on the heap
+static std::size_t NameEntryBytes( const std::string & iName )
+{
+    return sizeof( std::string ) + sizeof( std::size_t ) +
+        4 * sizeof( void * ) + iName.capacity();
+}
+
+//-*****************************************************************************
+std::size_t HeaderBytes( const AbcA::ObjectHeader & iHeader )
+{
+    return sizeof( AbcA::ObjectHeader ) + iHeader.getName().capacity() +
+        iHeader.getFullName().capacity() + NameEntryBytes( iHeader.getName() );
+}
+
+//-*****************************************************************************
+std::size_t HeaderBytes( const PropertyHeaderAndFriends & iHeader )
+{
+    return sizeof( PropertyHeaderAndFriends ) +
+        iHeader.header.getName().capacity() +
+        NameEntryBytes( iHeader.header.getName() );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
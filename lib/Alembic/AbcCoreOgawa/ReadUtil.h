@@ -54,7 +54,8 @@ ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
-                Util::Dimensions & oDim );
+                Util::Dimensions & oDim,
+                bool iIsEncoded = false );
 
 //-*****************************************************************************
 void
@@ -63,7 +64,8 @@ ReadData( void * iIntoLocation,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
           Util::PlainOldDataType iAsPod,
-          size_t iNumData );
+          size_t iNumData,
+          bool iIsEncoded = false );
 
 //-*****************************************************************************
 void
@@ -71,7 +73,22 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample );
+                 AbcA::ArraySamplePtr &oSample,
+                 bool iIsEncoded = false,
+                 AbcA::SampleBufferAllocatorPtr iAllocator =
+                     AbcA::SampleBufferAllocatorPtr() );
+
+//-*****************************************************************************
+// Points oSample straight at the sample data in the memory mapped file,
+// without allocating or copying.  This is only possible when the data isn't
+// encoded, isn't a string, exactly fills iDims and is aligned for its POD.
+// Returns false and leaves oSample alone when the data needs to be read.
+bool
+MapArraySample( Ogawa::IDataPtr iData,
+                const AbcA::DataType &iDataType,
+                const Util::Dimensions &iDims,
+                AbcA::ArraySamplePtr &oSample,
+                bool iIsEncoded = false );
 
 //-*****************************************************************************
 void
@@ -79,6 +96,25 @@ ReadTimeSamplesAndMax( Ogawa::IDataPtr iData,
                        std::vector <  AbcA::TimeSamplingPtr > & oTimeSamples,
                        std::vector <  AbcA::index_t > & oMaxSamples );
 
+//-*****************************************************************************
+// Reads the encoded object headers, without the hashes which follow them.
+void
+ReadObjectHeadersBuffer( Ogawa::IGroupPtr iGroup,
+                         size_t iIndex,
+                         size_t iThreadId,
+                         std::vector< char > & oBuf );
+
+//-*****************************************************************************
+// Reads the object header starting at ioPos and moves ioPos past it.
+// If oHeader is NULL just the name is read and the rest is skipped over.
+void
+ReadObjectHeader( const std::vector< char > & iBuf,
+                  std::size_t & ioPos,
+                  const std::string & iParentName,
+                  const std::vector< AbcA::MetaData > & iMetaDataVec,
+                  std::string & oName,
+                  AbcA::ObjectHeader * oHeader );
+
 //-*****************************************************************************
 void
 ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
@@ -88,6 +124,24 @@ ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
                    const std::vector< AbcA::MetaData > & iMetaDataVec,
                    std::vector< ObjectHeaderPtr > & oHeaders );
 
+//-*****************************************************************************
+void
+ReadPropertyHeadersBuffer( Ogawa::IGroupPtr iGroup,
+                           size_t iIndex,
+                           size_t iThreadId,
+                           std::vector< char > & oBuf );
+
+//-*****************************************************************************
+// Reads the property header starting at ioPos and moves ioPos past it.
+// If oHeader is NULL just the name is read and the rest is skipped over.
+void
+ReadPropertyHeader( const std::vector< char > & iBuf,
+                    std::size_t & ioPos,
+                    AbcA::ArchiveReader & iArchive,
+                    const std::vector< AbcA::MetaData > & iMetaDataVec,
+                    std::string & oName,
+                    PropertyHeaderAndFriends * oHeader );
+
 //-*****************************************************************************
 void
 ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
@@ -102,6 +156,13 @@ void
 ReadIndexedMetaData( Ogawa::IDataPtr iData,
                      std::vector< AbcA::MetaData > & oMetaDataVec );
 
+//-*****************************************************************************
+// Roughly how many bytes a header read by the functions above takes up,
+// including the entry for its name in its parent's map of children.
+// MetaData from the indexed table is shared and isn't counted.
+std::size_t HeaderBytes( const AbcA::ObjectHeader & iHeader );
+std::size_t HeaderBytes( const PropertyHeaderAndFriends & iHeader );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -38,6 +38,8 @@
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -46,6 +48,17 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 WriteArchive::WriteArchive()
 {
+    m_strategy = Ogawa::kSynchronousWrites;
+    m_writtenSampleMapBytes = 0;
+    m_hierarchyIndex = false;
+}
+
+//-*****************************************************************************
+WriteArchive::WriteArchive( Ogawa::WriteStrategy iStrategy )
+{
+    m_strategy = iStrategy;
+    m_writtenSampleMapBytes = 0;
+    m_hierarchyIndex = false;
 }
 
 //-*****************************************************************************
@@ -54,7 +67,9 @@ WriteArchive::operator()( const std::string &iFileName,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iFileName, iMetaData ) );
+        new AwImpl( iFileName, iMetaData, m_strategy ) );
+    archivePtr->getWrittenSampleMap().setMaxBytes( m_writtenSampleMapBytes );
+    archivePtr->setWriteHierarchyIndex( m_hierarchyIndex );
     return archivePtr;
 }
 
@@ -64,27 +79,65 @@ WriteArchive::operator()( std::ostream * iStream,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iStream, iMetaData ) );
+        new AwImpl( iStream, iMetaData, m_strategy ) );
+    archivePtr->getWrittenSampleMap().setMaxBytes( m_writtenSampleMapBytes );
+    archivePtr->setWriteHierarchyIndex( m_hierarchyIndex );
     return archivePtr;
 }
 
+//-*****************************************************************************
+AbcA::ReadArraySampleCachePtr CreateCache( std::size_t iMaxBytes )
+{
+    AbcA::ReadArraySampleCachePtr cachePtr( new CacheImpl( iMaxBytes ) );
+    return cachePtr;
+}
+
+//-*****************************************************************************
+AbcA::SampleBufferAllocatorPtr
+CreateSampleBufferPool( std::size_t iMaxFreeBytes, bool iHugePages )
+{
+    AbcA::SampleBufferAllocatorPtr poolPtr(
+        new SampleBufferPool( iMaxFreeBytes, iHugePages ) );
+    return poolPtr;
+}
+
 //-*****************************************************************************
 ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
-    m_useMMap = true;
+    m_strategy = Ogawa::kMemoryMappedReads;
+    m_useMappedViews = false;
+    m_blockCacheBytes = 0;
+    m_lazyHeaders = false;
 }
 
 //-*****************************************************************************
-ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap )
+ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap,
+                          bool iUseMappedViews )
 {
     m_numStreams = iNumStreams;
-    m_useMMap = iUseMMap;
+    m_strategy = iUseMMap ? Ogawa::kMemoryMappedReads : Ogawa::kFileReads;
+    m_useMappedViews = iUseMappedViews;
+    m_blockCacheBytes = 0;
+    m_lazyHeaders = false;
+}
+
+//-*****************************************************************************
+ReadArchive::ReadArchive( size_t iNumStreams, Ogawa::ReadStrategy iStrategy,
+                          bool iUseMappedViews )
+{
+    m_numStreams = iNumStreams;
+    m_strategy = iStrategy;
+    m_useMappedViews = iUseMappedViews;
+    m_blockCacheBytes = 0;
+    m_lazyHeaders = false;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
-    : m_numStreams( 1 ), m_useMMap(true), m_streams( iStreams )
+    : m_numStreams( 1 ), m_strategy(Ogawa::kMemoryMappedReads),
+      m_useMappedViews(false), m_blockCacheBytes(0), m_lazyHeaders(false),
+      m_streams( iStreams )
 {
 }
 
@@ -97,34 +150,26 @@ ReadArchive::operator()( const std::string &iFileName ) const
     if ( m_streams.empty() )
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
+            new ArImpl( iFileName, m_numStreams, m_strategy,
+                        m_useMappedViews, m_blockCacheBytes,
+                        m_lazyHeaders ) );
     }
     else
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( m_streams ) );
+            new ArImpl( m_streams, m_lazyHeaders ) );
     }
+    archivePtr->setSampleBufferAllocator( m_sampleBufferAllocator );
     return archivePtr;
 }
 
 //-*****************************************************************************
-// The given cache is ignored.
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
-
-    if ( m_streams.empty() )
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
-    }
-    else
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( m_streams ) );
-    }
+    AbcA::ArchiveReaderPtr archivePtr = ( *this )( iFileName );
+    archivePtr->setReadArraySampleCachePtr( iCache );
     return archivePtr;
 }
 
@@ -38,6 +38,8 @@
 #define Alembic_AbcCoreOgawa_ReadWrite_h
 
 #include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Ogawa/IStreams.h>
+#include <Alembic/Ogawa/OStream.h>
 #include <Alembic/Util/Export.h>
 
 namespace Alembic {
@@ -46,11 +48,40 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 //! Will return a shared pointer to the archive writer
+//! Samples may be set on different properties from different threads at the
+//! same time, and those properties may be closed on different threads too.
+//! Objects, properties and time samplings should still be created from one
+//! thread at a time.
 class ALEMBIC_EXPORT WriteArchive
 {
 public:
     WriteArchive();
 
+    // With Ogawa::kBackgroundWrites the samples are still hashed and
+    // compressed by the thread setting them, but writing them to the file
+    // is left to a background thread, so the caller can get on with
+    // computing the next samples.
+    explicit WriteArchive( ::Alembic::Ogawa::WriteStrategy iStrategy );
+
+    // Identical samples are only written once, so every sample written so
+    // far is remembered.  Once that takes more than iMaxBytes, the oldest
+    // samples are forgotten, and are written again if they show up again.
+    // The default is 0, which means no limit.
+    void setWrittenSampleMapSize( size_t iMaxBytes )
+    {
+        m_writtenSampleMapBytes = iMaxBytes;
+    }
+
+    // Writes an index of every object's full name, header and position in
+    // the file when the archive is closed, so readers can find an object
+    // without reading everything above it (see
+    // AbcA::ArchiveReader::getIndexedObjectHeader).  Readers which don't
+    // know about the index ignore it.  The default is false.
+    void setHierarchyIndex( bool iWrite )
+    {
+        m_hierarchyIndex = iWrite;
+    }
+
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( const std::string &iFileName,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
@@ -58,11 +89,33 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+private:
+    ::Alembic::Ogawa::WriteStrategy m_strategy;
+    size_t m_writtenSampleMapBytes;
+    bool m_hierarchyIndex;
 };
 
+//-*****************************************************************************
+//! AbcCoreOgawa provides a thread safe, least recently used cache of array
+//! samples which can be shared between archives.  Once the cached samples
+//! take up more than iMaxBytes, the least recently used ones are dropped.
+ALEMBIC_EXPORT ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr
+CreateCache( std::size_t iMaxBytes = 256 * 1024 * 1024 );
+
+//-*****************************************************************************
+//! AbcCoreOgawa also provides a thread safe pool of sample buffers which can
+//! be shared between archives.  Buffers given back are kept to be handed out
+//! again for samples of about the same size, up to iMaxFreeBytes of them.
+//! With iHugePages, buffers of 2MB or more are backed by huge pages where
+//! the system supports it (currently Linux only).
+ALEMBIC_EXPORT ::Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr
+CreateSampleBufferPool( std::size_t iMaxFreeBytes = 256 * 1024 * 1024,
+                        bool iHugePages = false );
+
 //-*****************************************************************************
 //! Will return a shared pointer to the archive reader
-//! This version creates a cache associated with the archive.
+//! No cache is used unless one is given.
 class ALEMBIC_EXPORT ReadArchive
 {
 public:
@@ -70,18 +123,55 @@ public:
 
     // Open the file iNumStreams times and manage them internally. If iUseMMap
     // is true, then use memory mapped file I/O, otherwise use file streams.
-    ReadArchive( size_t iNumStreams, bool iUseMMap );
+    // If iUseMappedViews is also true, array samples which don't need to be
+    // converted or decoded point straight into the memory mapped file
+    // instead of being copied.  The memory of those samples is read only.
+    ReadArchive( size_t iNumStreams, bool iUseMMap,
+                 bool iUseMappedViews = false );
+
+    // Open the file iNumStreams times and read it with the given strategy.
+    // iUseMappedViews only applies to Ogawa::kMemoryMappedReads.
+    ReadArchive( size_t iNumStreams, ::Alembic::Ogawa::ReadStrategy iStrategy,
+                 bool iUseMappedViews = false );
 
     // Read from the provided streams, we do not own these, expect them
     // to remain open and all have the same data in them, and do not try to
     // delete them
     ReadArchive( const std::vector< std::istream * > & iStreams );
 
+    // Small reads of files which aren't memory mapped are served from
+    // whole blocks of the file, kept in memory up to iMaxBytes per archive.
+    // The default is 0, which turns it off.
+    void setBlockCacheSize( size_t iMaxBytes )
+    {
+        m_blockCacheBytes = iMaxBytes;
+    }
+
+    // Normally every child header of an object or compound property is read
+    // as soon as the parent is.  With lazy headers only the names are read
+    // up front, and the rest of each header is read the first time it is
+    // asked for, which saves time and memory when only a few of many
+    // properties are looked at.  The default is false.
+    void setLazyHeaders( bool iLazy )
+    {
+        m_lazyHeaders = iLazy;
+    }
+
+    // Array samples are read into buffers from iAllocator, like one made by
+    // CreateSampleBufferPool, instead of being allocated with new[].  The
+    // default is NULL, which uses new[].
+    void setSampleBufferAllocator(
+        ::Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr iAllocator )
+    {
+        m_sampleBufferAllocator = iAllocator;
+    }
+
     // open the file
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
 
-    // The given cache is ignored.
+    // open the file, and use the given cache (if any) when reading array
+    // samples
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName,
                 ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCache
@@ -89,7 +179,12 @@ public:
 
 private:
     size_t m_numStreams;
-    bool m_useMMap;
+    ::Alembic::Ogawa::ReadStrategy m_strategy;
+    bool m_useMappedViews;
+    size_t m_blockCacheBytes;
+    bool m_lazyHeaders;
+    ::Alembic::AbcCoreAbstract::SampleBufferAllocatorPtr
+        m_sampleBufferAllocator;
     std::vector< std::istream * > m_streams;
 };
 
@@ -0,0 +1,134 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/ReaderPool.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// operator new hands back memory aligned for anything, keeping every block
+// a multiple of this keeps them that way too
+const std::size_t BLOCK_ALIGN = 16;
+const std::size_t NUM_SIZE_CLASSES = 64;
+const std::size_t CHUNK_SIZE = 64 * 1024;
+
+inline std::size_t SizeClass( std::size_t iSize )
+{
+    return ( iSize + BLOCK_ALIGN - 1 ) / BLOCK_ALIGN - 1;
+}
+
+}
+
+//-*****************************************************************************
+ReaderPool::ReaderPool()
+    : m_free( NUM_SIZE_CLASSES, NULL )
+    , m_next( NULL )
+    , m_left( 0 )
+{
+}
+
+//-*****************************************************************************
+ReaderPool::~ReaderPool()
+{
+    for ( std::size_t i = 0; i < m_chunks.size(); ++i )
+    {
+        ::operator delete( m_chunks[i] );
+    }
+}
+
+//-*****************************************************************************
+void * ReaderPool::allocate( std::size_t iSize )
+{
+    std::size_t sizeClass = SizeClass( iSize );
+    if ( iSize == 0 || sizeClass >= NUM_SIZE_CLASSES )
+    {
+        return ::operator new( iSize );
+    }
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    FreeBlock * block = m_free[sizeClass];
+    if ( block )
+    {
+        m_free[sizeClass] = block->next;
+        return block;
+    }
+
+    std::size_t blockSize = ( sizeClass + 1 ) * BLOCK_ALIGN;
+    if ( m_left < blockSize )
+    {
+        // whatever is left at the end of the last chunk is only a few
+        // blocks at most, so don't bother keeping track of it
+        m_next = static_cast< char * >( ::operator new( CHUNK_SIZE ) );
+        m_chunks.push_back( m_next );
+        m_left = CHUNK_SIZE;
+    }
+
+    void * ret = m_next;
+    m_next += blockSize;
+    m_left -= blockSize;
+    return ret;
+}
+
+//-*****************************************************************************
+void ReaderPool::deallocate( void * iPtr, std::size_t iSize )
+{
+    std::size_t sizeClass = SizeClass( iSize );
+    if ( iSize == 0 || sizeClass >= NUM_SIZE_CLASSES )
+    {
+        ::operator delete( iPtr );
+        return;
+    }
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    FreeBlock * block = static_cast< FreeBlock * >( iPtr );
+    block->next = m_free[sizeClass];
+    m_free[sizeClass] = block;
+}
+
+//-*****************************************************************************
+std::size_t ReaderPool::getNumBytes()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_chunks.size() * CHUNK_SIZE;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
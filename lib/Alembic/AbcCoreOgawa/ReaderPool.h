@@ -0,0 +1,150 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_ReaderPool_h
+#define Alembic_AbcCoreOgawa_ReaderPool_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+#include <utility>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// The readers of an archive (OrImpl, CprImpl, SprImpl, AprImpl and the
+// OrData and CprData they share) are small and are made and thrown away a
+// great many times while walking a hierarchy.  They are carved out of
+// chunks owned by the archive they belong to, and what is given back is
+// kept on a free list per size to be handed out again.  Nothing is given
+// back to the system until the pool goes away.
+//-*****************************************************************************
+class ReaderPool : Alembic::Util::noncopyable
+{
+public:
+    ReaderPool();
+    ~ReaderPool();
+
+    // anything bigger than the largest size class comes from operator new
+    void * allocate( std::size_t iSize );
+    void deallocate( void * iPtr, std::size_t iSize );
+
+    // how much has been taken from the system, for getMemoryUsage
+    std::size_t getNumBytes();
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock * next;
+    };
+
+    Alembic::Util::mutex m_lock;
+
+    // one list per size class, size classes are multiples of 16 bytes
+    std::vector< FreeBlock * > m_free;
+
+    std::vector< char * > m_chunks;
+    char * m_next;
+    std::size_t m_left;
+};
+
+typedef Alembic::Util::shared_ptr< ReaderPool > ReaderPoolPtr;
+
+//-*****************************************************************************
+// An allocator for std::allocate_shared, the control block holds onto a
+// copy of it so the pool is kept around for as long as anything made from
+// it, including weak_ptrs to it.
+template < class T >
+class ReaderPoolAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit ReaderPoolAllocator( const ReaderPoolPtr & iPool )
+        : m_pool( iPool ) {}
+
+    template < class U >
+    ReaderPoolAllocator( const ReaderPoolAllocator< U > & iOther )
+        : m_pool( iOther.getPool() ) {}
+
+    T * allocate( std::size_t iNum )
+    {
+        return static_cast< T * >( m_pool->allocate( iNum * sizeof( T ) ) );
+    }
+
+    void deallocate( T * iPtr, std::size_t iNum )
+    {
+        m_pool->deallocate( iPtr, iNum * sizeof( T ) );
+    }
+
+    const ReaderPoolPtr & getPool() const { return m_pool; }
+
+private:
+    ReaderPoolPtr m_pool;
+};
+
+template < class T, class U >
+bool operator==( const ReaderPoolAllocator< T > & iA,
+                 const ReaderPoolAllocator< U > & iB )
+{
+    return iA.getPool() == iB.getPool();
+}
+
+template < class T, class U >
+bool operator!=( const ReaderPoolAllocator< T > & iA,
+                 const ReaderPoolAllocator< U > & iB )
+{
+    return iA.getPool() != iB.getPool();
+}
+
+//-*****************************************************************************
+// makes a T and its control block with one allocation from iPool
+template < class T, class... Args >
+Alembic::Util::shared_ptr< T > MakeReader( const ReaderPoolPtr & iPool,
+                                           Args &&... iArgs )
+{
+    return std::allocate_shared< T >( ReaderPoolAllocator< T >( iPool ),
+                                      std::forward< Args >( iArgs )... );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,242 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
+
+#if defined (__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <new>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+const std::size_t MIN_SHIFT = 6;
+const std::size_t MIN_BYTES = std::size_t( 1 ) << MIN_SHIFT;
+const std::size_t STEPS_PER_SHIFT = 4;
+const std::size_t NUM_SIZE_CLASSES =
+    ( sizeof( std::size_t ) * 8 - MIN_SHIFT ) * STEPS_PER_SHIFT + 1;
+const std::size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+// returns which free list buffers for iNumBytes go on, and how big they are
+std::size_t SizeClass( std::size_t iNumBytes, std::size_t & oClassBytes )
+{
+    if ( iNumBytes <= MIN_BYTES )
+    {
+        oClassBytes = MIN_BYTES;
+        return 0;
+    }
+
+    // 2^shift < iNumBytes <= 2^(shift+1)
+    std::size_t shift = MIN_SHIFT;
+    while ( shift + 1 < sizeof( std::size_t ) * 8 &&
+            ( std::size_t( 1 ) << ( shift + 1 ) ) < iNumBytes )
+    {
+        ++shift;
+    }
+
+    std::size_t base = std::size_t( 1 ) << shift;
+    std::size_t step = base / STEPS_PER_SHIFT;
+    std::size_t numSteps = ( iNumBytes - base + step - 1 ) / step;
+
+    oClassBytes = base + numSteps * step;
+    return ( shift - MIN_SHIFT ) * STEPS_PER_SHIFT + numSteps;
+}
+
+// the other way around
+std::size_t ClassBytes( std::size_t iSizeClass )
+{
+    if ( iSizeClass == 0 )
+    {
+        return MIN_BYTES;
+    }
+
+    std::size_t shift = MIN_SHIFT + ( iSizeClass - 1 ) / STEPS_PER_SHIFT;
+    std::size_t numSteps = ( iSizeClass - 1 ) % STEPS_PER_SHIFT + 1;
+    std::size_t base = std::size_t( 1 ) << shift;
+    return base + numSteps * ( base / STEPS_PER_SHIFT );
+}
+
+std::size_t MappedBytes( std::size_t iClassBytes )
+{
+    return ( ( iClassBytes + HUGE_PAGE_BYTES - 1 ) / HUGE_PAGE_BYTES ) *
+        HUGE_PAGE_BYTES;
+}
+
+}
+
+//-*****************************************************************************
+SampleBufferPool::SampleBufferPool( std::size_t iMaxFreeBytes,
+                                    bool iHugePages )
+    : m_maxFreeBytes( iMaxFreeBytes )
+    , m_hugePages( iHugePages )
+    , m_free( NUM_SIZE_CLASSES )
+    , m_freeBytes( 0 )
+{
+}
+
+//-*****************************************************************************
+SampleBufferPool::~SampleBufferPool()
+{
+    trim();
+}
+
+//-*****************************************************************************
+void * SampleBufferPool::allocate( std::size_t iNumBytes )
+{
+    std::size_t classBytes = 0;
+    std::size_t sizeClass = SizeClass( iNumBytes, classBytes );
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        std::vector< void * > & buffers = m_free[sizeClass];
+        if ( !buffers.empty() )
+        {
+            void * ret = buffers.back();
+            buffers.pop_back();
+            m_freeBytes -= classBytes;
+            return ret;
+        }
+    }
+
+    return allocateFromSystem( classBytes );
+}
+
+//-*****************************************************************************
+void SampleBufferPool::deallocate( void * iBuffer, std::size_t iNumBytes )
+{
+    if ( !iBuffer )
+    {
+        return;
+    }
+
+    std::size_t classBytes = 0;
+    std::size_t sizeClass = SizeClass( iNumBytes, classBytes );
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        if ( m_freeBytes + classBytes <= m_maxFreeBytes )
+        {
+            m_free[sizeClass].push_back( iBuffer );
+            m_freeBytes += classBytes;
+            return;
+        }
+    }
+
+    freeToSystem( iBuffer, classBytes );
+}
+
+//-*****************************************************************************
+std::size_t SampleBufferPool::getNumFreeBytes()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_freeBytes;
+}
+
+//-*****************************************************************************
+void SampleBufferPool::trim()
+{
+    std::vector< std::vector< void * > > freed( NUM_SIZE_CLASSES );
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        freed.swap( m_free );
+        m_freeBytes = 0;
+    }
+
+    for ( std::size_t i = 0; i < freed.size(); ++i )
+    {
+        std::size_t classBytes = ClassBytes( i );
+        for ( std::size_t j = 0; j < freed[i].size(); ++j )
+        {
+            freeToSystem( freed[i][j], classBytes );
+        }
+    }
+}
+
+//-*****************************************************************************
+void * SampleBufferPool::allocateFromSystem( std::size_t iClassBytes )
+{
+#if defined (__linux__)
+    if ( m_hugePages && iClassBytes >= HUGE_PAGE_BYTES )
+    {
+        std::size_t numBytes = MappedBytes( iClassBytes );
+
+        // MAP_HUGETLB needs huge pages set aside by the administrator, if
+        // there aren't any ask for transparent huge pages instead
+        void * ret = MAP_FAILED;
+#if defined (MAP_HUGETLB)
+        ret = mmap( NULL, numBytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+#endif
+        if ( ret == MAP_FAILED )
+        {
+            ret = mmap( NULL, numBytes, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+            if ( ret == MAP_FAILED )
+            {
+                throw std::bad_alloc();
+            }
+#if defined (MADV_HUGEPAGE)
+            madvise( ret, numBytes, MADV_HUGEPAGE );
+#endif
+        }
+        return ret;
+    }
+#endif
+
+    return ::operator new( iClassBytes );
+}
+
+//-*****************************************************************************
+void SampleBufferPool::freeToSystem( void * iBuffer, std::size_t iClassBytes )
+{
+#if defined (__linux__)
+    if ( m_hugePages && iClassBytes >= HUGE_PAGE_BYTES )
+    {
+        munmap( iBuffer, MappedBytes( iClassBytes ) );
+        return;
+    }
+#endif
+
+    ::operator delete( iBuffer );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,95 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_SampleBufferPool_h
+#define Alembic_AbcCoreOgawa_SampleBufferPool_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A sample buffer allocator which keeps buffers that are given back, to
+//! hand out again for samples of about the same size.  Sizes are rounded up
+//! to one of four steps between each power of two, so at most a fifth of a
+//! buffer is wasted.  Once the buffers being kept take up more than the
+//! byte budget, the rest are given back to the system.
+//! With huge pages, buffers of 2MB or more are mapped straight from the
+//! system with huge pages where it is supported (MAP_HUGETLB, or else
+//! transparent huge pages on Linux), which saves TLB misses on big samples.
+//! It is safe to share between threads and archives.
+class ALEMBIC_EXPORT SampleBufferPool : public AbcA::SampleBufferAllocator
+{
+public:
+    SampleBufferPool( std::size_t iMaxFreeBytes, bool iHugePages );
+
+    virtual ~SampleBufferPool();
+
+    virtual void * allocate( std::size_t iNumBytes );
+
+    virtual void deallocate( void * iBuffer, std::size_t iNumBytes );
+
+    virtual std::size_t getNumFreeBytes();
+
+    virtual void trim();
+
+    std::size_t getMaxFreeBytes() const { return m_maxFreeBytes; }
+
+    bool useHugePages() const { return m_hugePages; }
+
+private:
+    void * allocateFromSystem( std::size_t iClassBytes );
+    void freeToSystem( void * iBuffer, std::size_t iClassBytes );
+
+    std::size_t m_maxFreeBytes;
+    bool m_hugePages;
+
+    // the buffers not in use, by size class
+    std::vector< std::vector< void * > > m_free;
+    std::size_t m_freeBytes;
+
+    Alembic::Util::mutex m_lock;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -67,9 +67,6 @@ SpwImpl::~SpwImpl()
 {
     AbcA::ArchiveWriterPtr archive = m_parent->getObject()->getArchive();
 
-    index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex );
-
     Util::uint32_t numSamples = m_header->nextSampleIndex;
 
     // a constant property, we wrote the same sample over and over
@@ -78,11 +75,7 @@ SpwImpl::~SpwImpl()
         numSamples = 1;
     }
 
-    if ( maxSamples < numSamples )
-    {
-        archive->setMaxNumSamplesForTimeSamplingIndex(
-            m_header->timeSamplingIndex, numSamples );
-    }
+    UpdateMaxNumSamples( archive, m_header->timeSamplingIndex, numSamples );
 
     Util::SpookyHash hash;
     hash.Init(0, 0);
@@ -118,7 +111,7 @@ void SpwImpl::setFromPreviousSample()
     ABCA_ASSERT( m_header->nextSampleIndex > 0,
         "Can't set from previous sample before any samples have been written" );
 
-    Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
+    Util::Digest digest = m_previousWrittenSampleID.getKey().digest;
     Util::SpookyHash::ShortEnd(m_hash.words[0], m_hash.words[1],
                                digest.words[0], digest.words[1]);
     m_header->nextSampleIndex ++;
@@ -155,8 +148,7 @@ void SpwImpl::setSample( const void *iSamp )
 
     // We need to write the sample
     if ( m_header->nextSampleIndex == 0  ||
-        !( m_previousWrittenSampleID &&
-            key == m_previousWrittenSampleID->getKey() ) )
+        key != m_previousWrittenSampleID.getKey() )
     {
 
         // we only need to repeat samples if this is not the first change
@@ -190,11 +182,11 @@ void SpwImpl::setSample( const void *iSamp )
 
     if ( m_header->nextSampleIndex == 0 )
     {
-        m_hash = m_previousWrittenSampleID->getKey().digest;
+        m_hash = m_previousWrittenSampleID.getKey().digest;
     }
     else
     {
-        Util::Digest digest = m_previousWrittenSampleID->getKey().digest;
+        Util::Digest digest = m_previousWrittenSampleID.getKey().digest;
         Util::SpookyHash::ShortEnd( m_hash.words[0], m_hash.words[1],
                                     digest.words[0], digest.words[1] );
     }
@@ -77,7 +77,7 @@ public:
 
 protected:
     // Previous written array sample identifier!
-    WrittenSampleIDPtr m_previousWrittenSampleID;
+    WrittenSampleID m_previousWrittenSampleID;
 
 private:
     // The parent compound property writer.
@@ -268,11 +268,12 @@ void testReadWriteMaxNumSamplesArchive(bool iUseMMap)
     }
 }
 
-void writeArchive( const std::string & iName, std::ostream * iStream )
+void writeArchive( const std::string & iName, std::ostream * iStream,
+    Alembic::Ogawa::WriteStrategy iStrategy = Alembic::Ogawa::kSynchronousWrites )
 {
     ABCA::MetaData m;
     ABCA::ObjectHeader header("a", m);
-    AO::WriteArchive w;
+    AO::WriteArchive w(iStrategy);
     ABCA::ArchiveWriterPtr a;
     if (iStream)
     {
@@ -438,6 +439,15 @@ int main ( int argc, char *argv[] )
     strStream.seekg(0, strStream.beg);
     readArchive(&strStream);
 
+    writeArchive("testBackground.abc", NULL, Alembic::Ogawa::kBackgroundWrites);
+    readArchive("testBackground.abc", true);
+    readArchive("testBackground.abc", false);
+
+    std::stringstream bgStream;
+    writeArchive("", &bgStream, Alembic::Ogawa::kBackgroundWrites);
+    bgStream.seekg(0, bgStream.beg);
+    readArchive(&bgStream);
+
     writeVeryEmptyArchive("testEmpty.abc");
     readVeryEmptyArchive("testEmpty.abc", true);
     readVeryEmptyArchive("testEmpty.abc", false);
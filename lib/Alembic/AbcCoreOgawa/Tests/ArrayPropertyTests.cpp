@@ -36,11 +36,15 @@
 
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Ogawa/All.h>
 #include <Alembic/Util/All.h>
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 
@@ -2017,6 +2021,914 @@ void testBigData(bool iUseMMap)
     }
 }
 
+//-*****************************************************************************
+Alembic::Util::int32_t getOgawaFileVersion(const std::string & iName)
+{
+    Alembic::Ogawa::IArchive oa(iName);
+    TESTING_ASSERT(oa.isValid());
+    Alembic::Util::int32_t version = -1;
+    oa.getGroup()->getData(0, 0)->read(4, &version, 0, 0);
+    return version;
+}
+
+//-*****************************************************************************
+std::size_t getFileSize(const std::string & iName)
+{
+    std::ifstream strm(iName.c_str(), std::ios::binary | std::ios::ate);
+    return (std::size_t) strm.tellg();
+}
+
+//-*****************************************************************************
+void testCompressedArrays(bool iUseMMap)
+{
+    std::vector< std::size_t > fileSizes;
+    std::size_t numVals = 10000;
+
+    const Alembic::Util::int8_t hints[3] = {-1, 0, 9};
+    for (std::size_t h = 0; h < 3; ++h)
+    {
+        Alembic::Util::int8_t hint = hints[h];
+        std::stringstream strm;
+        strm << "compressedArray" << (int) hint << ".abc";
+        std::string archiveName = strm.str();
+
+        {
+            AO::WriteArchive w;
+            ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+            a->setCompressionHint(hint);
+            ABCA::CompoundPropertyWriterPtr parent =
+                a->getTop()->getProperties();
+
+            ABCA::DataType fd(Alembic::Util::kFloat32POD, 1);
+            ABCA::ArrayPropertyWriterPtr fwp =
+                parent->createArrayProperty("f", ABCA::MetaData(), fd, 0);
+            ABCA::ArrayPropertyWriterPtr gwp =
+                parent->createArrayProperty("g", ABCA::MetaData(), fd, 0);
+
+            std::vector< Alembic::Util::float32_t > vals(numVals);
+            for (std::size_t i = 0; i < numVals; ++i)
+            {
+                vals[i] = (Alembic::Util::float32_t)(i % 100);
+            }
+            Alembic::Util::Dimensions dims(numVals);
+            fwp->setSample(ABCA::ArraySample(&(vals.front()), fd, dims));
+
+            // a tiny sample which won't be compressed
+            fwp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(3)));
+
+            // an empty sample
+            fwp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(0)));
+
+            // g shares the first sample of f
+            gwp->setSample(ABCA::ArraySample(&(vals.front()), fd, dims));
+
+            ABCA::DataType sd(Alembic::Util::kStringPOD, 1);
+            ABCA::ArrayPropertyWriterPtr swp =
+                parent->createArrayProperty("s", ABCA::MetaData(), sd, 0);
+            std::vector< std::string > strs(500, "repeated string value");
+            strs[7] = "";
+            strs[42] = "a different one";
+            swp->setSample(ABCA::ArraySample(&(strs.front()), sd,
+                Alembic::Util::Dimensions(strs.size())));
+
+            ABCA::DataType wd(Alembic::Util::kWstringPOD, 1);
+            ABCA::ArrayPropertyWriterPtr wwp =
+                parent->createArrayProperty("w", ABCA::MetaData(), wd, 0);
+            std::vector< std::wstring > wstrs(200, L"wide string value");
+            wstrs[3] = L"";
+            wwp->setSample(ABCA::ArraySample(&(wstrs.front()), wd,
+                Alembic::Util::Dimensions(wstrs.size())));
+
+            // change the hint part way through, h gets written with whatever
+            // the hint was when its first sample was written
+            a->setCompressionHint(hint < 0 ? 0 : -1);
+            ABCA::ArrayPropertyWriterPtr hwp =
+                parent->createArrayProperty("h", ABCA::MetaData(), fd, 0);
+            hwp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(numVals / 10)));
+            a->setCompressionHint(hint);
+            hwp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(50)));
+        }
+
+        // anything was encoded bumps up the file version
+        TESTING_ASSERT(getOgawaFileVersion(archiveName) == 1);
+
+        fileSizes.push_back(getFileSize(archiveName));
+
+        {
+            AO::ReadArchive r(1, iUseMMap);
+            ABCA::ArchiveReaderPtr a = r(archiveName);
+            ABCA::CompoundPropertyReaderPtr parent =
+                a->getTop()->getProperties();
+
+            ABCA::ArrayPropertyReaderPtr fap = parent->getArrayProperty("f");
+            ABCA::ArrayPropertyReaderPtr gap = parent->getArrayProperty("g");
+            ABCA::ArrayPropertyReaderPtr hap = parent->getArrayProperty("h");
+            TESTING_ASSERT(fap->getNumSamples() == 3);
+
+            const char * names[2] = {"f", "g"};
+            for (std::size_t p = 0; p < 2; ++p)
+            {
+                ABCA::ArrayPropertyReaderPtr ap =
+                    parent->getArrayProperty(names[p]);
+                ABCA::ArraySamplePtr samp;
+                ap->getSample(0, samp);
+                TESTING_ASSERT(samp->size() == numVals);
+                const Alembic::Util::float32_t * data =
+                    (const Alembic::Util::float32_t *)(samp->getData());
+                for (std::size_t i = 0; i < numVals; ++i)
+                {
+                    TESTING_ASSERT(data[i] == (Alembic::Util::float32_t)(i % 100));
+                }
+
+                ABCA::ArraySampleKey key;
+                TESTING_ASSERT(ap->getKey(0, key));
+                TESTING_ASSERT(key.numBytes == numVals * 4);
+
+                Alembic::Util::Dimensions dims;
+                ap->getDimensions(0, dims);
+                TESTING_ASSERT(dims.numPoints() == numVals);
+
+                // read it as a different type
+                std::vector< Alembic::Util::float64_t > dvals(numVals);
+                ap->getAs(0, &(dvals.front()), Alembic::Util::kFloat64POD);
+                TESTING_ASSERT(dvals[99] == 99.0 && dvals[9999] == 99.0);
+            }
+
+            ABCA::ArraySampleKey fkey, gkey;
+            fap->getKey(0, fkey);
+            gap->getKey(0, gkey);
+            TESTING_ASSERT(fkey == gkey);
+
+            ABCA::ArraySamplePtr samp;
+            fap->getSample(1, samp);
+            TESTING_ASSERT(samp->size() == 3);
+            TESTING_ASSERT(((const Alembic::Util::float32_t *)
+                            samp->getData())[2] == 2.0f);
+
+            fap->getSample(2, samp);
+            TESTING_ASSERT(samp->size() == 0);
+
+            hap->getSample(0, samp);
+            TESTING_ASSERT(samp->size() == numVals / 10);
+            TESTING_ASSERT(((const Alembic::Util::float32_t *)
+                            samp->getData())[999] == 99.0f);
+
+            hap->getSample(1, samp);
+            TESTING_ASSERT(samp->size() == 50);
+            TESTING_ASSERT(((const Alembic::Util::float32_t *)
+                            samp->getData())[49] == 49.0f);
+
+            ABCA::ArrayPropertyReaderPtr sap = parent->getArrayProperty("s");
+            sap->getSample(0, samp);
+            TESTING_ASSERT(samp->size() == 500);
+            const std::string * strData =
+                (const std::string *)(samp->getData());
+            TESTING_ASSERT(strData[0] == "repeated string value");
+            TESTING_ASSERT(strData[7] == "");
+            TESTING_ASSERT(strData[42] == "a different one");
+            TESTING_ASSERT(strData[499] == "repeated string value");
+
+            ABCA::ArrayPropertyReaderPtr wap = parent->getArrayProperty("w");
+            wap->getSample(0, samp);
+            TESTING_ASSERT(samp->size() == 200);
+            const std::wstring * wstrData =
+                (const std::wstring *)(samp->getData());
+            TESTING_ASSERT(wstrData[0] == L"wide string value");
+            TESTING_ASSERT(wstrData[3] == L"");
+            TESTING_ASSERT(wstrData[199] == L"wide string value");
+        }
+    }
+
+    // compressed files should be quite a bit smaller
+    TESTING_ASSERT(fileSizes[1] < fileSizes[0] / 2);
+    TESTING_ASSERT(fileSizes[2] < fileSizes[0] / 2);
+
+    // without a compression hint we shouldn't bump the version
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("uncompressedArray.abc",
+                                     ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ABCA::DataType fd(Alembic::Util::kFloat32POD, 1);
+        ABCA::ArrayPropertyWriterPtr fwp =
+            parent->createArrayProperty("f", ABCA::MetaData(), fd, 0);
+        std::vector< Alembic::Util::float32_t > vals(numVals, 1.0f);
+        fwp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+            Alembic::Util::Dimensions(numVals)));
+    }
+    TESTING_ASSERT(getOgawaFileVersion("uncompressedArray.abc") == 0);
+}
+
+//-*****************************************************************************
+template < typename T >
+void writeFilterSample(ABCA::CompoundPropertyWriterPtr iParent,
+                       const std::string & iName,
+                       Alembic::Util::PlainOldDataType iPod,
+                       const std::vector< T > & iVals)
+{
+    ABCA::DataType dtype(iPod, 1);
+    ABCA::ArrayPropertyWriterPtr awp =
+        iParent->createArrayProperty(iName, ABCA::MetaData(), dtype, 0);
+    awp->setSample(ABCA::ArraySample(&(iVals.front()), dtype,
+        Alembic::Util::Dimensions(iVals.size())));
+}
+
+//-*****************************************************************************
+template < typename T >
+void checkFilterSample(ABCA::CompoundPropertyReaderPtr iParent,
+                       const std::string & iName,
+                       const std::vector< T > & iVals)
+{
+    ABCA::ArrayPropertyReaderPtr ap = iParent->getArrayProperty(iName);
+    ABCA::ArraySamplePtr samp;
+    ap->getSample(0, samp);
+    TESTING_ASSERT(samp->size() == iVals.size());
+    const T * data = (const T *)(samp->getData());
+    for (std::size_t i = 0; i < iVals.size(); ++i)
+    {
+        TESTING_ASSERT(data[i] == iVals[i]);
+    }
+}
+
+//-*****************************************************************************
+void testFilteredArrays(bool iUseMMap)
+{
+    // odd sizes so the filters have partial blocks left over
+    std::size_t numVals = 100003;
+
+    std::vector< Alembic::Util::float32_t > positions(numVals);
+    std::vector< Alembic::Util::float64_t > doubles(numVals);
+    std::vector< Alembic::Util::int32_t > indices(numVals);
+    std::vector< Alembic::Util::uint64_t > ids(numVals);
+    std::vector< Alembic::Util::int16_t > shorts(numVals);
+    std::vector< Alembic::Util::int32_t > negatives(numVals);
+    for (std::size_t i = 0; i < numVals; ++i)
+    {
+        positions[i] = 0.25f * (Alembic::Util::float32_t)(i % 1000);
+        doubles[i] = -1.5 * (Alembic::Util::float64_t)(i % 333);
+        indices[i] = (Alembic::Util::int32_t)(i + i / 3);
+        ids[i] = 0xffffffff00000000ULL + i * 2;
+        shorts[i] = (Alembic::Util::int16_t)(i % 20 - 10);
+        negatives[i] = (i % 2) ? -2147483647 - 1 : 2147483647;
+    }
+
+    const Alembic::Util::int8_t hints[2] = {0, 9};
+    for (std::size_t h = 0; h < 2; ++h)
+    {
+        std::stringstream strm;
+        strm << "filteredArray" << (int) hints[h] << ".abc";
+        std::string archiveName = strm.str();
+
+        {
+            AO::WriteArchive w;
+            ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+            a->setCompressionHint(hints[h]);
+            ABCA::CompoundPropertyWriterPtr parent =
+                a->getTop()->getProperties();
+
+            writeFilterSample(parent, "P", Alembic::Util::kFloat32POD,
+                              positions);
+            writeFilterSample(parent, "d", Alembic::Util::kFloat64POD,
+                              doubles);
+            writeFilterSample(parent, "indices", Alembic::Util::kInt32POD,
+                              indices);
+            writeFilterSample(parent, "ids", Alembic::Util::kUint64POD, ids);
+            writeFilterSample(parent, "s", Alembic::Util::kInt16POD, shorts);
+            writeFilterSample(parent, "n", Alembic::Util::kInt32POD,
+                              negatives);
+        }
+
+        {
+            AO::ReadArchive r(1, iUseMMap);
+            ABCA::ArchiveReaderPtr a = r(archiveName);
+            ABCA::CompoundPropertyReaderPtr parent =
+                a->getTop()->getProperties();
+
+            checkFilterSample(parent, "P", positions);
+            checkFilterSample(parent, "d", doubles);
+            checkFilterSample(parent, "indices", indices);
+            checkFilterSample(parent, "ids", ids);
+            checkFilterSample(parent, "s", shorts);
+            checkFilterSample(parent, "n", negatives);
+
+            // make sure converting still works on filtered data
+            ABCA::ArrayPropertyReaderPtr ap =
+                parent->getArrayProperty("indices");
+            std::vector< Alembic::Util::int64_t > wide(numVals);
+            ap->getAs(0, &(wide.front()), Alembic::Util::kInt64POD);
+            TESTING_ASSERT(wide[numVals - 1] == indices[numVals - 1]);
+        }
+    }
+
+    // the delta filter should make increasing indices nearly free
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("filteredIndices.abc", ABCA::MetaData());
+        a->setCompressionHint(0);
+        writeFilterSample(a->getTop()->getProperties(), "indices",
+                          Alembic::Util::kInt32POD, indices);
+    }
+    TESTING_ASSERT(getFileSize("filteredIndices.abc") <
+                   numVals * sizeof(Alembic::Util::int32_t) / 20);
+}
+
+void testMappedViews(bool iUseMMap)
+{
+    std::string archiveName = "mappedViews.abc";
+
+    std::vector< Alembic::Util::uint8_t > bytes(1001);
+    std::vector< Alembic::Util::float32_t > floats(3003);
+    for (std::size_t i = 0; i < floats.size(); ++i)
+    {
+        floats[i] = (Alembic::Util::float32_t) i;
+        if (i < bytes.size())
+        {
+            bytes[i] = (Alembic::Util::uint8_t) i;
+        }
+    }
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::DataType bd(Alembic::Util::kUint8POD, 1);
+        ABCA::ArrayPropertyWriterPtr bp =
+            parent->createArrayProperty("bytes", ABCA::MetaData(), bd, 0);
+        bp->setSample(ABCA::ArraySample(&(bytes.front()), bd,
+            Alembic::Util::Dimensions(bytes.size())));
+
+        ABCA::DataType fd(Alembic::Util::kFloat32POD, 3);
+        ABCA::ArrayPropertyWriterPtr fp =
+            parent->createArrayProperty("floats", ABCA::MetaData(), fd, 0);
+        fp->setSample(ABCA::ArraySample(&(floats.front()), fd,
+            Alembic::Util::Dimensions(floats.size() / 3)));
+
+        // compressed samples have to be decoded, so they get copied
+        ABCA::CompoundPropertyWriterPtr child =
+            parent->createCompoundProperty("compressed", ABCA::MetaData());
+        a->setCompressionHint(1);
+        ABCA::ArrayPropertyWriterPtr cp =
+            child->createArrayProperty("bytes", ABCA::MetaData(), bd, 0);
+        cp->setSample(ABCA::ArraySample(&(bytes.front()), bd,
+            Alembic::Util::Dimensions(bytes.size())));
+    }
+
+    ABCA::ArraySamplePtr keptSample;
+    {
+        AO::ReadArchive r(1, iUseMMap, true);
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        // single bytes are always aligned, so these point into the file
+        // when it is memory mapped
+        ABCA::ArrayPropertyReaderPtr bp = parent->getArrayProperty("bytes");
+        ABCA::ArraySamplePtr samp0, samp1;
+        bp->getSample(0, samp0);
+        bp->getSample(0, samp1);
+        TESTING_ASSERT(samp0->size() == bytes.size());
+        TESTING_ASSERT(memcmp(samp0->getData(), &(bytes.front()),
+                              bytes.size()) == 0);
+        TESTING_ASSERT((samp0->getData() == samp1->getData()) == iUseMMap);
+        keptSample = samp0;
+
+        // floats may or may not be aligned within the file, but they have
+        // to be right either way
+        ABCA::ArrayPropertyReaderPtr fp = parent->getArrayProperty("floats");
+        fp->getSample(0, samp0);
+        TESTING_ASSERT(samp0->size() == floats.size() / 3);
+        TESTING_ASSERT(samp0->getDataType().getExtent() == 3);
+        TESTING_ASSERT(memcmp(samp0->getData(), &(floats.front()),
+            floats.size() * sizeof(Alembic::Util::float32_t)) == 0);
+
+        // converting always copies
+        std::vector< Alembic::Util::float64_t > doubles(floats.size());
+        fp->getAs(0, &(doubles.front()), Alembic::Util::kFloat64POD);
+        TESTING_ASSERT(doubles[floats.size() - 1] == floats.size() - 1);
+
+        ABCA::ArrayPropertyReaderPtr cp = parent->getCompoundProperty(
+            "compressed")->getArrayProperty("bytes");
+        cp->getSample(0, samp0);
+        cp->getSample(0, samp1);
+        TESTING_ASSERT(samp0->getData() != samp1->getData());
+        TESTING_ASSERT(memcmp(samp0->getData(), &(bytes.front()),
+                              bytes.size()) == 0);
+
+        // views aren't put in the cache, copies still are
+        ABCA::ReadArraySampleCachePtr cache = AO::CreateCache();
+        a->setReadArraySampleCachePtr(cache);
+        bp->getSample(0, samp0);
+        TESTING_ASSERT((samp0->getData() == keptSample->getData()) ==
+                       iUseMMap);
+        cp->getSample(0, samp0);
+        cp->getSample(0, samp1);
+        TESTING_ASSERT(samp0 == samp1);
+    }
+
+    // the view keeps the mapping around after the archive is gone
+    TESTING_ASSERT(memcmp(keptSample->getData(), &(bytes.front()),
+                          bytes.size()) == 0);
+
+    // views are off by default
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        ABCA::ArrayPropertyReaderPtr bp =
+            a->getTop()->getProperties()->getArrayProperty("bytes");
+        ABCA::ArraySamplePtr samp0, samp1;
+        bp->getSample(0, samp0);
+        bp->getSample(0, samp1);
+        TESTING_ASSERT(samp0->getData() != samp1->getData());
+    }
+}
+
+void testRequestSamples(bool iUseMMap)
+{
+    std::string archiveName = "requestSamples.abc";
+
+    ABCA::DataType fd(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType sd(Alembic::Util::kStringPOD, 1);
+    std::size_t numSamples = 20;
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr fp =
+            parent->createArrayProperty("floats", ABCA::MetaData(), fd, 0);
+        ABCA::ArrayPropertyWriterPtr gp =
+            parent->createArrayProperty("floats2", ABCA::MetaData(), fd, 0);
+        ABCA::ArrayPropertyWriterPtr sp =
+            parent->createArrayProperty("strings", ABCA::MetaData(), sd, 0);
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            // a mix of small samples which get merged and big ones which
+            // are read on their own
+            std::size_t numVals = (i % 5 == 0) ? 300000 : 3 * (i + 1);
+            std::vector< Alembic::Util::float32_t > vals(numVals);
+            for (std::size_t j = 0; j < numVals; ++j)
+            {
+                vals[j] = (Alembic::Util::float32_t)(i * 1000 + j);
+            }
+            fp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(numVals / 3)));
+            vals[0] = -1.0f;
+            gp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(numVals / 3)));
+
+            std::vector< std::string > strs(i + 1, "potato");
+            sp->setSample(ABCA::ArraySample(&(strs.front()), sd,
+                Alembic::Util::Dimensions(strs.size())));
+        }
+    }
+
+    // the small reads can also come from the block cache, when not mmapped
+    AO::ReadArchive r(1, iUseMMap);
+    r.setBlockCacheSize(256 * 1024);
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+    ABCA::ArrayPropertyReaderPtr fp = parent->getArrayProperty("floats");
+    ABCA::ArrayPropertyReaderPtr gp = parent->getArrayProperty("floats2");
+    ABCA::ArrayPropertyReaderPtr sp = parent->getArrayProperty("strings");
+
+    std::vector< ABCA::index_t > indices;
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        indices.push_back((ABCA::index_t)((i * 7) % numSamples));
+    }
+    indices.push_back(3);
+
+    // several requests going at once
+    ABCA::ArraySampleRequestPtr fr = fp->requestSamples(indices);
+    ABCA::ArraySampleRequestPtr gr = gp->requestSamples(indices);
+    ABCA::ArraySampleRequestPtr sr = sp->requestSamples(indices);
+    TESTING_ASSERT(fr->getNumSamples() == indices.size());
+
+    fr->wait();
+    TESTING_ASSERT(fr->isReady());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        ABCA::ArraySamplePtr expected;
+        fp->getSample(indices[i], expected);
+        ABCA::ArraySamplePtr samp = fr->getSample(i);
+        TESTING_ASSERT(samp->getDimensions() == expected->getDimensions());
+        TESTING_ASSERT(samp->getDataType() == fd);
+        TESTING_ASSERT(memcmp(samp->getData(), expected->getData(),
+            expected->size() * fd.getNumBytes()) == 0);
+
+        samp = gr->getSample(i);
+        TESTING_ASSERT(((const Alembic::Util::float32_t *)
+                        samp->getData())[0] == -1.0f);
+        TESTING_ASSERT(((const Alembic::Util::float32_t *)
+                        samp->getData())[1] ==
+                       ((const Alembic::Util::float32_t *)
+                        expected->getData())[1]);
+
+        samp = sr->getSample(i);
+        TESTING_ASSERT(samp->size() == (std::size_t)(indices[i] + 1));
+        TESTING_ASSERT(((const std::string *) samp->getData())[0] ==
+                       "potato");
+    }
+
+    // the same with a cache
+    a->setReadArraySampleCachePtr(AO::CreateCache());
+    fr = fp->requestSamples(indices);
+    TESTING_ASSERT(fr->getSample(indices.size() - 1)->size() == 4);
+
+    TESTING_ASSERT(fp->requestSamples(std::vector< ABCA::index_t >())->isReady());
+
+    bool threw = false;
+    try
+    {
+        indices.push_back((ABCA::index_t) numSamples);
+        fp->requestSamples(indices);
+    }
+    catch (std::exception &)
+    {
+        threw = true;
+    }
+    TESTING_ASSERT(threw);
+}
+
+std::size_t writeLimitedArchive(const std::string & iName,
+                                std::size_t iMaxBytes)
+{
+    {
+        AO::WriteArchive w;
+        w.setWrittenSampleMapSize(iMaxBytes);
+        ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), i32d, 0);
+        ABCA::ArrayPropertyWriterPtr bwp =
+            parent->createArrayProperty("b", ABCA::MetaData(), i32d, 0);
+
+        Alembic::Util::int32_t vals[4] = { 0, 1, 2, 3 };
+        Alembic::Util::Dimensions dims(4);
+        for (std::size_t i = 0; i < 20000; ++i)
+        {
+            vals[0] = (Alembic::Util::int32_t) i;
+            awp->setSample(ABCA::ArraySample(vals, i32d, dims));
+        }
+
+        // the oldest and the newest samples of a
+        for (std::size_t i = 0; i < 1200; ++i)
+        {
+            vals[0] = (Alembic::Util::int32_t)(i < 1000 ? i : 18800 + i);
+            bwp->setSample(ABCA::ArraySample(vals, i32d, dims));
+        }
+    }
+    return getFileSize(iName);
+}
+
+void testWrittenSampleMapSize(bool iUseMMap)
+{
+    std::size_t unlimited = writeLimitedArchive("unlimitedMap.abc", 0);
+    std::size_t limited = writeLimitedArchive("limitedMap.abc", 1024 * 1024);
+
+    // only the oldest samples were forgotten and written again, each one
+    // is the data size, key and 16 bytes of data
+    TESTING_ASSERT(limited == unlimited + 1000 * 40);
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr a = r("limitedMap.abc");
+    ABCA::ArrayPropertyReaderPtr bp =
+        a->getTop()->getProperties()->getArrayProperty("b");
+    TESTING_ASSERT(bp->getNumSamples() == 1200);
+    for (std::size_t i = 0; i < 1200; ++i)
+    {
+        ABCA::ArraySamplePtr samp;
+        bp->getSample(i, samp);
+        const Alembic::Util::int32_t * data =
+            (const Alembic::Util::int32_t *) samp->getData();
+        TESTING_ASSERT(samp->size() == 4);
+        TESTING_ASSERT(data[0] == (Alembic::Util::int32_t)
+            (i < 1000 ? i : 18800 + i));
+        TESTING_ASSERT(data[3] == 3);
+    }
+}
+
+std::size_t writeDigestArchive(const std::string & iName,
+                               ABCA::DigestAlgorithm iAlgorithm)
+{
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+        a->setDigestAlgorithm(iAlgorithm);
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ABCA::DataType f32d(Alembic::Util::kFloat32POD, 3);
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), f32d, 0);
+        ABCA::ArrayPropertyWriterPtr bwp =
+            parent->createArrayProperty("b", ABCA::MetaData(), f32d, 0);
+
+        // a few chunks worth of points
+        std::size_t numPoints = 300000;
+        std::vector< Alembic::Util::float32_t > vals(numPoints * 3);
+        for (std::size_t i = 0; i < vals.size(); ++i)
+        {
+            vals[i] = (Alembic::Util::float32_t) i;
+        }
+        Alembic::Util::Dimensions dims(numPoints);
+
+        // a is a, a, b and bwp is the same as a
+        awp->setSample(ABCA::ArraySample(vals.data(), f32d, dims));
+        awp->setSample(ABCA::ArraySample(vals.data(), f32d, dims));
+        bwp->setSample(ABCA::ArraySample(vals.data(), f32d, dims));
+        vals.back() = -1.0f;
+        awp->setSample(ABCA::ArraySample(vals.data(), f32d, dims));
+        bwp->setSample(ABCA::ArraySample(vals.data(), f32d, dims));
+    }
+    return getFileSize(iName);
+}
+
+void testChunkedDigests(bool iUseMMap)
+{
+    std::size_t plainSize = writeDigestArchive("plainDigest.abc",
+                                               ABCA::kMurmur3Digest);
+    std::size_t chunkedSize = writeDigestArchive("chunkedDigest.abc",
+                                                 ABCA::kChunkedMurmur3Digest);
+
+    // the same samples are shared either way, the only difference is
+    // the archive metadata
+    TESTING_ASSERT(chunkedSize > plainSize);
+    TESTING_ASSERT(chunkedSize < plainSize + 100);
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr plain = r("plainDigest.abc");
+    TESTING_ASSERT(plain->getMetaData().get("_ai_DigestAlgorithm").empty());
+
+    ABCA::ArchiveReaderPtr a = r("chunkedDigest.abc");
+    TESTING_ASSERT(a->getMetaData().get("_ai_DigestAlgorithm") ==
+                   "Murmur3Chunked");
+
+    ABCA::ArrayPropertyReaderPtr ap =
+        a->getTop()->getProperties()->getArrayProperty("a");
+    ABCA::ArrayPropertyReaderPtr bp =
+        a->getTop()->getProperties()->getArrayProperty("b");
+    TESTING_ASSERT(ap->getNumSamples() == 3);
+    TESTING_ASSERT(bp->getNumSamples() == 2);
+    TESTING_ASSERT(!ap->isConstant());
+
+    ABCA::ArraySampleKey key0, key1, key2, bkey1;
+    ap->getKey(0, key0);
+    ap->getKey(1, key1);
+    ap->getKey(2, key2);
+    bp->getKey(1, bkey1);
+    TESTING_ASSERT(key0 == key1);
+    TESTING_ASSERT(key1 != key2);
+    TESTING_ASSERT(key2 == bkey1);
+
+    ABCA::ArraySamplePtr samp;
+    ap->getSample(2, samp);
+    const Alembic::Util::float32_t * data =
+        (const Alembic::Util::float32_t *) samp->getData();
+    TESTING_ASSERT(samp->size() == 300000);
+    TESTING_ASSERT(data[1] == 1.0f);
+    TESTING_ASSERT(data[300000 * 3 - 2] == 300000 * 3 - 2);
+    TESTING_ASSERT(data[300000 * 3 - 1] == -1.0f);
+}
+
+std::string readFile(const std::string & iName)
+{
+    std::ifstream f(iName.c_str(), std::ios::binary);
+    std::stringstream strm;
+    strm << f.rdbuf();
+    return strm.str();
+}
+
+void copyArrays(ABCA::ArchiveReaderPtr iSrc, const std::string & iName,
+                bool iUseKeys)
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+    ABCA::CompoundPropertyReaderPtr src = iSrc->getTop()->getProperties();
+
+    for (std::size_t i = 0; i < src->getNumProperties(); ++i)
+    {
+        ABCA::ArrayPropertyReaderPtr reader = src->getArrayProperty(i);
+        ABCA::ArrayPropertyWriterPtr writer = parent->createArrayProperty(
+            reader->getName(), reader->getMetaData(),
+            reader->getDataType(), 0);
+
+        for (std::size_t j = 0; j < reader->getNumSamples(); ++j)
+        {
+            ABCA::ArraySamplePtr samp;
+            reader->getSample(j, samp);
+
+            ABCA::ArraySampleKey key;
+            if (iUseKeys && reader->getKey(j, key))
+            {
+                writer->setSampleWithKey(*samp, key);
+            }
+            else
+            {
+                writer->setSample(*samp);
+            }
+        }
+    }
+}
+
+void testSetWithKey(bool iUseMMap)
+{
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("keySource.abc", ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+        ABCA::DataType f32d(Alembic::Util::kFloat32POD, 3);
+        ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+        ABCA::ArrayPropertyWriterPtr fwp =
+            parent->createArrayProperty("f", ABCA::MetaData(), f32d, 0);
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("s", ABCA::MetaData(), strd, 0);
+
+        Alembic::Util::float32_t vals[6] = { 0.0f, 1.0f, 2.0f,
+                                             3.0f, 4.0f, 5.0f };
+        fwp->setSample(ABCA::ArraySample(vals, f32d,
+                                         Alembic::Util::Dimensions(2)));
+        fwp->setSample(ABCA::ArraySample(vals, f32d,
+                                         Alembic::Util::Dimensions(1)));
+        fwp->setSample(ABCA::ArraySample(vals, f32d,
+                                         Alembic::Util::Dimensions(2)));
+
+        std::string strs[2] = { "abc", "de" };
+        swp->setSample(ABCA::ArraySample(strs, strd,
+                                         Alembic::Util::Dimensions(2)));
+        swp->setSample(ABCA::ArraySample(strs, strd,
+                                         Alembic::Util::Dimensions(1)));
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr src = r("keySource.abc");
+    copyArrays(src, "keyCopy.abc", true);
+    copyArrays(src, "hashCopy.abc", false);
+
+    // the given keys are used exactly like the computed ones
+    std::string keyCopy = readFile("keyCopy.abc");
+    TESTING_ASSERT(!keyCopy.empty());
+    TESTING_ASSERT(keyCopy == readFile("hashCopy.abc"));
+
+#ifndef NDEBUG
+    // debug builds check that the key belongs to the sample
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w("badKey.abc", ABCA::MetaData());
+    ABCA::DataType f32d(Alembic::Util::kFloat32POD, 1);
+    ABCA::ArrayPropertyWriterPtr awp = a->getTop()->getProperties()->
+        createArrayProperty("a", ABCA::MetaData(), f32d, 0);
+
+    Alembic::Util::float32_t val = 1.0f;
+    ABCA::ArraySample samp(&val, f32d, Alembic::Util::Dimensions(1));
+    ABCA::ArraySampleKey key = samp.getKey();
+    key.digest.words[0] ^= 1;
+
+    bool threw = false;
+    try
+    {
+        awp->setSampleWithKey(samp, key);
+    }
+    catch (std::exception &)
+    {
+        threw = true;
+    }
+    TESTING_ASSERT(threw);
+#endif
+}
+
+void writeCopySource(const std::string & iName, Alembic::Util::int8_t iHint)
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+    a->setCompressionHint(iHint);
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+    ABCA::ArrayPropertyWriterPtr iwp =
+        parent->createArrayProperty("i", ABCA::MetaData(), i32d, 0);
+    ABCA::ArrayPropertyWriterPtr swp =
+        parent->createArrayProperty("s", ABCA::MetaData(), strd, 0);
+
+    std::vector< Alembic::Util::int32_t > vals(1000);
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+        vals[i] = (Alembic::Util::int32_t)(i % 10);
+    }
+
+    // same, different, empty, then back to the first again
+    Alembic::Util::Dimensions dims(vals.size());
+    iwp->setSample(ABCA::ArraySample(&vals.front(), i32d, dims));
+    iwp->setSample(ABCA::ArraySample(&vals.front(), i32d, dims));
+    vals[500] = 42;
+    iwp->setSample(ABCA::ArraySample(&vals.front(), i32d, dims));
+    iwp->setSample(ABCA::ArraySample(&vals.front(), i32d,
+                                     Alembic::Util::Dimensions(0)));
+    vals[500] = 0;
+    iwp->setSample(ABCA::ArraySample(&vals.front(), i32d, dims));
+
+    std::string strs[3] = { "first", "second", "" };
+    swp->setSample(ABCA::ArraySample(strs, strd, Alembic::Util::Dimensions(3)));
+    swp->setSample(ABCA::ArraySample(strs, strd, Alembic::Util::Dimensions(1)));
+}
+
+void copyRawArrays(ABCA::ArchiveReaderPtr iSrc, const std::string & iName)
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w(iName, ABCA::MetaData());
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+    ABCA::CompoundPropertyReaderPtr src = iSrc->getTop()->getProperties();
+
+    for (std::size_t i = 0; i < src->getNumProperties(); ++i)
+    {
+        ABCA::ArrayPropertyReaderPtr reader = src->getArrayProperty(i);
+        ABCA::ArrayPropertyWriterPtr writer = parent->createArrayProperty(
+            reader->getName(), reader->getMetaData(),
+            reader->getDataType(), 0);
+
+        for (std::size_t j = 0; j < reader->getNumSamples(); ++j)
+        {
+            TESTING_ASSERT(writer->copySample(reader, j));
+        }
+    }
+}
+
+void checkCopiedArrays(ABCA::ArchiveReaderPtr iSrc,
+                       ABCA::ArchiveReaderPtr iCopy)
+{
+    ABCA::CompoundPropertyReaderPtr src = iSrc->getTop()->getProperties();
+    ABCA::CompoundPropertyReaderPtr copy = iCopy->getTop()->getProperties();
+    TESTING_ASSERT(src->getNumProperties() == copy->getNumProperties());
+
+    for (std::size_t i = 0; i < src->getNumProperties(); ++i)
+    {
+        ABCA::ArrayPropertyReaderPtr a = src->getArrayProperty(i);
+        ABCA::ArrayPropertyReaderPtr b = copy->getArrayProperty(i);
+        TESTING_ASSERT(a->getNumSamples() == b->getNumSamples());
+        TESTING_ASSERT(a->isConstant() == b->isConstant());
+        TESTING_ASSERT(a->isScalarLike() == b->isScalarLike());
+
+        for (std::size_t j = 0; j < a->getNumSamples(); ++j)
+        {
+            ABCA::ArraySampleKey keyA, keyB;
+            TESTING_ASSERT(a->getKey(j, keyA) && b->getKey(j, keyB));
+            TESTING_ASSERT(keyA == keyB);
+
+            ABCA::ArraySamplePtr sampA, sampB;
+            a->getSample(j, sampA);
+            b->getSample(j, sampB);
+            TESTING_ASSERT(sampA->getDimensions() == sampB->getDimensions());
+            TESTING_ASSERT(sampA->getKey() == sampB->getKey());
+        }
+    }
+}
+
+void testCopySample(bool iUseMMap)
+{
+    writeCopySource("copySource.abc", -1);
+    writeCopySource("copySourceEncoded.abc", 0);
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr src = r("copySource.abc");
+    copyRawArrays(src, "rawCopy.abc");
+    copyArrays(src, "setCopy.abc", false);
+
+    // copied data is written exactly like the same samples being set
+    std::string rawCopy = readFile("rawCopy.abc");
+    TESTING_ASSERT(!rawCopy.empty());
+    TESTING_ASSERT(rawCopy == readFile("setCopy.abc"));
+    checkCopiedArrays(src, r("rawCopy.abc"));
+
+    // encoded samples stay encoded
+    ABCA::ArchiveReaderPtr encSrc = r("copySourceEncoded.abc");
+    copyRawArrays(encSrc, "rawCopyEncoded.abc");
+    checkCopiedArrays(encSrc, r("rawCopyEncoded.abc"));
+    TESTING_ASSERT(getFileSize("rawCopyEncoded.abc") < rawCopy.size());
+
+    // but can't be mixed with samples that aren't
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("mixedCopy.abc", ABCA::MetaData());
+        ABCA::ArrayPropertyReaderPtr reader =
+            encSrc->getTop()->getProperties()->getArrayProperty("i");
+        ABCA::ArrayPropertyWriterPtr writer =
+            a->getTop()->getProperties()->createArrayProperty(
+                "i", ABCA::MetaData(), reader->getDataType(), 0);
+
+        ABCA::ArraySamplePtr samp;
+        reader->getSample(0, samp);
+        writer->setSample(*samp);
+        TESTING_ASSERT(!writer->copySample(reader, 1));
+        TESTING_ASSERT(writer->getNumSamples() == 1);
+        TESTING_ASSERT(writer->copySample(
+            src->getTop()->getProperties()->getArrayProperty("i"), 1));
+        TESTING_ASSERT(writer->getNumSamples() == 2);
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testEmptyArray(iUseMMap);
@@ -2025,6 +2937,14 @@ void runTests(bool iUseMMap)
     testExtentArrayStrings(iUseMMap);
     testArrayStringsRepeats(iUseMMap);
     testArraySamples(iUseMMap);
+    testCompressedArrays(iUseMMap);
+    testFilteredArrays(iUseMMap);
+    testMappedViews(iUseMMap);
+    testRequestSamples(iUseMMap);
+    testWrittenSampleMapSize(iUseMMap);
+    testChunkedDigests(iUseMMap);
+    testSetWithKey(iUseMMap);
+    testCopySample(iUseMMap);
 
     if (!iUseMMap)
     {
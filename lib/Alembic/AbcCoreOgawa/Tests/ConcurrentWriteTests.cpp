@@ -0,0 +1,260 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+const std::size_t NUM_OBJECTS = 64;
+const std::size_t NUM_SAMPLES = 12;
+const std::size_t NUM_THREADS = 8;
+
+//-*****************************************************************************
+// "pos" is different for every object and sample, "shared" is the same for
+// every object so different threads keep writing the same samples, and
+// "constant" never changes.
+Alembic::Util::int32_t posValue( std::size_t iObj, std::size_t iSamp,
+                                 std::size_t iIndex )
+{
+    return ( Alembic::Util::int32_t )( iObj * 100000 + iSamp * 100 + iIndex );
+}
+
+std::size_t posSize( std::size_t iObj, std::size_t iSamp )
+{
+    return 1 + ( iObj * 7 + iSamp * 13 ) % 500;
+}
+
+float sharedValue( std::size_t iSamp, std::size_t iIndex )
+{
+    return ( float )( iSamp ) + ( float )( iIndex ) * 0.5f;
+}
+
+std::size_t sharedSize( std::size_t iSamp )
+{
+    return 64 + iSamp * 16;
+}
+
+//-*****************************************************************************
+void writeObjects( std::vector< ABCA::ArrayPropertyWriterPtr > & ioProps,
+                   std::size_t iThread )
+{
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+    ABCA::DataType f32d( Alembic::Util::kFloat32POD, 1 );
+
+    for ( std::size_t i = iThread; i < NUM_OBJECTS; i += NUM_THREADS )
+    {
+        for ( std::size_t s = 0; s < NUM_SAMPLES; ++s )
+        {
+            std::vector< Alembic::Util::int32_t > pos( posSize( i, s ) );
+            for ( std::size_t j = 0; j < pos.size(); ++j )
+            {
+                pos[j] = posValue( i, s, j );
+            }
+            ioProps[i * 3]->setSample( ABCA::ArraySample( &pos.front(), i32d,
+                Alembic::Util::Dimensions( pos.size() ) ) );
+
+            std::vector< float > shared( sharedSize( s ) );
+            for ( std::size_t j = 0; j < shared.size(); ++j )
+            {
+                shared[j] = sharedValue( s, j );
+            }
+            ioProps[i * 3 + 1]->setSample( ABCA::ArraySample( &shared.front(),
+                f32d, Alembic::Util::Dimensions( shared.size() ) ) );
+
+            std::vector< Alembic::Util::int32_t > constant( 30, 7 );
+            ioProps[i * 3 + 2]->setSample( ABCA::ArraySample(
+                &constant.front(), i32d,
+                Alembic::Util::Dimensions( constant.size() ) ) );
+        }
+
+        // close them here too
+        ioProps[i * 3].reset();
+        ioProps[i * 3 + 1].reset();
+        ioProps[i * 3 + 2].reset();
+    }
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName, std::size_t iNumThreads,
+                   Alembic::Ogawa::WriteStrategy iStrategy,
+                   Alembic::Util::int8_t iCompressionHint )
+{
+    ABCA::MetaData m;
+    AO::WriteArchive w( iStrategy );
+    ABCA::ArchiveWriterPtr a = w( iName, m );
+    a->setCompressionHint( iCompressionHint );
+
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+    ABCA::DataType f32d( Alembic::Util::kFloat32POD, 1 );
+
+    // objects and properties are created on one thread
+    std::vector< ABCA::ObjectWriterPtr > objs;
+    std::vector< ABCA::ArrayPropertyWriterPtr > props;
+    for ( std::size_t i = 0; i < NUM_OBJECTS; ++i )
+    {
+        std::stringstream strm;
+        strm << "obj" << i;
+        objs.push_back(
+            a->getTop()->createChild( ABCA::ObjectHeader( strm.str(), m ) ) );
+        ABCA::CompoundPropertyWriterPtr top = objs.back()->getProperties();
+        props.push_back( top->createArrayProperty( "pos", m, i32d, 0 ) );
+        props.push_back( top->createArrayProperty( "shared", m, f32d, 0 ) );
+        props.push_back( top->createArrayProperty( "constant", m, i32d, 0 ) );
+    }
+
+    // and the samples are set on many
+    if ( iNumThreads == 1 )
+    {
+        for ( std::size_t t = 0; t < NUM_THREADS; ++t )
+        {
+            writeObjects( props, t );
+        }
+    }
+    else
+    {
+        std::vector< std::thread > threads;
+        for ( std::size_t t = 0; t < iNumThreads; ++t )
+        {
+            threads.push_back( std::thread( writeObjects, std::ref( props ),
+                                            t ) );
+        }
+
+        for ( std::size_t t = 0; t < threads.size(); ++t )
+        {
+            threads[t].join();
+        }
+    }
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName,
+                  std::vector< Alembic::Util::Digest > & oHashes )
+{
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( iName );
+    ABCA::ObjectReaderPtr top = a->getTop();
+    TESTING_ASSERT( top->getNumChildren() == NUM_OBJECTS );
+    TESTING_ASSERT( a->getMaxNumSamplesForTimeSamplingIndex( 0 ) ==
+                    NUM_SAMPLES );
+
+    oHashes.clear();
+    for ( std::size_t i = 0; i < NUM_OBJECTS; ++i )
+    {
+        ABCA::ObjectReaderPtr obj = top->getChild( i );
+        ABCA::CompoundPropertyReaderPtr cpr = obj->getProperties();
+        ABCA::ArrayPropertyReaderPtr pos = cpr->getArrayProperty( "pos" );
+        ABCA::ArrayPropertyReaderPtr shared =
+            cpr->getArrayProperty( "shared" );
+        ABCA::ArrayPropertyReaderPtr constant =
+            cpr->getArrayProperty( "constant" );
+
+        TESTING_ASSERT( pos->getNumSamples() == NUM_SAMPLES );
+        TESTING_ASSERT( shared->getNumSamples() == NUM_SAMPLES );
+        TESTING_ASSERT( constant->getNumSamples() == NUM_SAMPLES );
+        TESTING_ASSERT( constant->isConstant() );
+
+        for ( std::size_t s = 0; s < NUM_SAMPLES; ++s )
+        {
+            ABCA::ArraySamplePtr samp;
+            pos->getSample( s, samp );
+            TESTING_ASSERT( samp->size() == posSize( i, s ) );
+            const Alembic::Util::int32_t * posData =
+                ( const Alembic::Util::int32_t * ) samp->getData();
+            for ( std::size_t j = 0; j < samp->size(); ++j )
+            {
+                TESTING_ASSERT( posData[j] == posValue( i, s, j ) );
+            }
+
+            shared->getSample( s, samp );
+            TESTING_ASSERT( samp->size() == sharedSize( s ) );
+            const float * sharedData = ( const float * ) samp->getData();
+            for ( std::size_t j = 0; j < samp->size(); ++j )
+            {
+                TESTING_ASSERT( sharedData[j] == sharedValue( s, j ) );
+            }
+
+            constant->getSample( s, samp );
+            TESTING_ASSERT( samp->size() == 30 );
+            const Alembic::Util::int32_t * constantData =
+                ( const Alembic::Util::int32_t * ) samp->getData();
+            TESTING_ASSERT( constantData[0] == 7 && constantData[29] == 7 );
+        }
+
+        Alembic::Util::Digest hash;
+        TESTING_ASSERT( obj->getPropertiesHash( hash ) );
+        oHashes.push_back( hash );
+    }
+}
+
+//-*****************************************************************************
+void testConcurrentWrites( Alembic::Ogawa::WriteStrategy iStrategy,
+                           Alembic::Util::int8_t iCompressionHint )
+{
+    // written in a different order, but the same samples
+    std::vector< Alembic::Util::Digest > serialHashes;
+    writeArchive( "serialWrite.abc", 1, iStrategy, iCompressionHint );
+    readArchive( "serialWrite.abc", serialHashes );
+
+    for ( std::size_t pass = 0; pass < 4; ++pass )
+    {
+        std::vector< Alembic::Util::Digest > hashes;
+        writeArchive( "concurrentWrite.abc", NUM_THREADS, iStrategy,
+                      iCompressionHint );
+        readArchive( "concurrentWrite.abc", hashes );
+        TESTING_ASSERT( hashes == serialHashes );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testConcurrentWrites( Alembic::Ogawa::kSynchronousWrites, -1 );
+    testConcurrentWrites( Alembic::Ogawa::kBackgroundWrites, -1 );
+    testConcurrentWrites( Alembic::Ogawa::kSynchronousWrites, 1 );
+    testConcurrentWrites( Alembic::Ogawa::kBackgroundWrites, 1 );
+
+    return 0;
+}
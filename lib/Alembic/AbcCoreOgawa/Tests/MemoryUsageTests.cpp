@@ -0,0 +1,318 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <sstream>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+void writeArchive(const std::string & iName)
+{
+    AO::WriteArchive w;
+    w.setHierarchyIndex(true);
+    AbcA::MetaData m;
+    m.set("archive", "metadata");
+    AbcA::ArchiveWriterPtr a = w(iName, m);
+    AbcA::TimeSamplingPtr ts(new AbcA::TimeSampling(1.0 / 24.0, 0.0));
+    Alembic::Util::uint32_t tsIndex = a->addTimeSampling(*ts);
+
+    AbcA::DataType dtype(Alembic::Util::kInt32POD, 1);
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        std::stringstream strm;
+        strm << "child" << i;
+        AbcA::MetaData childMeta;
+        childMeta.set("kind", i % 2 ? "odd" : "even");
+        AbcA::ObjectWriterPtr child = a->getTop()->createChild(
+            AbcA::ObjectHeader(strm.str(), childMeta));
+        child->createChild(AbcA::ObjectHeader("grandChild", childMeta));
+
+        AbcA::ArrayPropertyWriterPtr prop =
+            child->getProperties()->createArrayProperty("vals",
+                AbcA::MetaData(), dtype, tsIndex);
+        std::vector< Alembic::Util::int32_t > vals(1000, (int) i);
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            vals[0] = (int) j;
+            prop->setSample(AbcA::ArraySample(&vals.front(), dtype,
+                Alembic::Util::Dimensions(vals.size())));
+        }
+    }
+}
+
+//-*****************************************************************************
+// holds onto every object and its properties in oHeld
+void readEverything(AbcA::ObjectReaderPtr iObj,
+                    std::vector< AbcA::CompoundPropertyReaderPtr > & oHeld)
+{
+    AbcA::CompoundPropertyReaderPtr props = iObj->getProperties();
+    for (std::size_t i = 0; i < props->getNumProperties(); ++i)
+    {
+        TESTING_ASSERT(!props->getPropertyHeader(i).getName().empty());
+    }
+    oHeld.push_back(props);
+
+    for (std::size_t i = 0; i < iObj->getNumChildren(); ++i)
+    {
+        readEverything(iObj->getChild(i), oHeld);
+    }
+}
+
+//-*****************************************************************************
+void testHeaders(const std::string & iName, bool iLazy)
+{
+    AO::ReadArchive reader(1, Alembic::Ogawa::kMemoryMappedReads);
+    reader.setLazyHeaders(iLazy);
+    AbcA::ArchiveReaderPtr a = reader(iName);
+
+    AbcA::MemoryUsage atOpen;
+    a->getMemoryUsage(atOpen);
+    TESTING_ASSERT(atOpen.headers > 0);
+    TESTING_ASSERT(atOpen.metaData > 0);
+    TESTING_ASSERT(atOpen.timeSamplings > 0);
+    TESTING_ASSERT(atOpen.samples == 0);
+    TESTING_ASSERT(atOpen.streams == 0);
+    TESTING_ASSERT(atOpen.readers > 0);
+    TESTING_ASSERT(atOpen.total() == atOpen.headers + atOpen.metaData +
+                   atOpen.timeSamplings + atOpen.readers);
+
+    std::size_t walkedReaders = 0;
+    {
+        std::vector< AbcA::CompoundPropertyReaderPtr > held;
+        readEverything(a->getTop(), held);
+        TESTING_ASSERT(held.size() == 41);
+
+        AbcA::MemoryUsage walked;
+        a->getMemoryUsage(walked);
+        TESTING_ASSERT(walked.headers > atOpen.headers);
+        TESTING_ASSERT(walked.metaData == atOpen.metaData);
+        TESTING_ASSERT(walked.readers >= atOpen.readers);
+        walkedReaders = walked.readers;
+    }
+
+    // the readers are gone, and so is what they held, except for lazily
+    // read headers of the top object's children which it holds onto
+    AbcA::MemoryUsage released;
+    a->getMemoryUsage(released);
+    TESTING_ASSERT(iLazy ? released.headers > atOpen.headers :
+                   released.headers == atOpen.headers);
+
+    // but the memory the readers were made in is kept for the next ones
+    TESTING_ASSERT(released.readers == walkedReaders);
+
+    // walking again doesn't hold onto any more
+    {
+        std::vector< AbcA::CompoundPropertyReaderPtr > held;
+        readEverything(a->getTop(), held);
+    }
+
+    AbcA::MemoryUsage releasedAgain;
+    a->getMemoryUsage(releasedAgain);
+    TESTING_ASSERT(releasedAgain.headers == released.headers);
+    TESTING_ASSERT(releasedAgain.readers == released.readers);
+
+    // findObject remembers where objects are until trimmed
+    {
+        AbcA::ObjectReaderPtr obj = a->findObject("/child7/grandChild");
+        TESTING_ASSERT(obj);
+        TESTING_ASSERT(obj->getMetaData().get("kind") == "odd");
+    }
+
+    AbcA::MemoryUsage found;
+    a->getMemoryUsage(found);
+    TESTING_ASSERT(found.headers > atOpen.headers);
+
+    a->trim();
+
+    AbcA::MemoryUsage trimmed;
+    a->getMemoryUsage(trimmed);
+    TESTING_ASSERT(trimmed.headers == released.headers);
+
+    // and it all still works afterwards
+    TESTING_ASSERT(a->findObject("/child7/grandChild"));
+    TESTING_ASSERT(!a->findObject("/child7/notThere"));
+    TESTING_ASSERT(a->getTop()->getNumChildren() == 20);
+}
+
+//-*****************************************************************************
+void testCaches(const std::string & iName)
+{
+    AO::ReadArchive reader(1, Alembic::Ogawa::kFileReads);
+    reader.setBlockCacheSize(1024 * 1024);
+    AbcA::ArchiveReaderPtr a = reader(iName, AO::CreateCache());
+
+    AbcA::MemoryUsage atOpen;
+    a->getMemoryUsage(atOpen);
+
+    // the headers were read through the block cache
+    TESTING_ASSERT(atOpen.streams > 0);
+    TESTING_ASSERT(atOpen.samples == 0);
+
+    AbcA::ArraySamplePtr held;
+    {
+        AbcA::ArrayPropertyReaderPtr prop =
+            a->getTop()->getChild("child3")->getProperties()->
+            getArrayProperty("vals");
+        for (std::size_t i = 0; i < prop->getNumSamples(); ++i)
+        {
+            prop->getSample(i, held);
+        }
+    }
+
+    AbcA::MemoryUsage read;
+    a->getMemoryUsage(read);
+    TESTING_ASSERT(read.samples >= 3 * 1000 * sizeof(Alembic::Util::int32_t));
+    TESTING_ASSERT(read.total() > atOpen.total());
+
+    a->trim();
+
+    AbcA::MemoryUsage trimmed;
+    a->getMemoryUsage(trimmed);
+    TESTING_ASSERT(trimmed.samples == 0);
+    TESTING_ASSERT(trimmed.streams == 0);
+    TESTING_ASSERT(trimmed.headers == atOpen.headers);
+    TESTING_ASSERT(trimmed.metaData == atOpen.metaData);
+    TESTING_ASSERT(trimmed.timeSamplings == atOpen.timeSamplings);
+
+    // what was handed out is still good
+    TESTING_ASSERT(held->size() == 1000);
+    TESTING_ASSERT(((const Alembic::Util::int32_t *) held->getData())[1] ==
+                   3);
+
+    // and reading again fills the caches back up
+    AbcA::ArraySamplePtr again;
+    a->getTop()->getChild("child3")->getProperties()->getArrayProperty(
+        "vals")->getSample(2, again);
+    TESTING_ASSERT(((const Alembic::Util::int32_t *) again->getData())[0] ==
+                   2);
+
+    AbcA::MemoryUsage reread;
+    a->getMemoryUsage(reread);
+    TESTING_ASSERT(reread.samples > 0);
+    TESTING_ASSERT(reread.streams > 0);
+}
+
+//-*****************************************************************************
+// like the archives an IFactory opens, both archives use the same cache, so
+// neither counts it, nor empties it when trimmed
+void testSharedCache(const std::string & iName)
+{
+    // hold onto the cache the whole time, like an IFactory does
+    AO::ReadArchive reader;
+    AbcA::ReadArraySampleCachePtr cache = AO::CreateCache();
+    AO::CacheImpl * cacheImpl = dynamic_cast<AO::CacheImpl *>(cache.get());
+    TESTING_ASSERT(cacheImpl);
+
+    AbcA::ArchiveReaderPtr a = reader(iName, cache);
+    AbcA::ArchiveReaderPtr b = reader(iName, cache);
+
+    AbcA::ArraySamplePtr fromA;
+    a->getTop()->getChild("child3")->getProperties()->getArrayProperty(
+        "vals")->getSample(0, fromA);
+
+    AbcA::MemoryUsage usageA;
+    AbcA::MemoryUsage usageB;
+    a->getMemoryUsage(usageA);
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageA.samples >= 1000 * sizeof(Alembic::Util::int32_t));
+    TESTING_ASSERT(usageB.samples == 0);
+
+    AbcA::ArraySamplePtr otherB;
+    b->getTop()->getChild("child5")->getProperties()->getArrayProperty(
+        "vals")->getSample(0, otherB);
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageB.samples >= 1000 * sizeof(Alembic::Util::int32_t));
+    std::size_t bytesB = usageB.samples;
+
+    // b finds what a read in the cache, but it's still a's
+    AbcA::ArraySamplePtr fromB;
+    b->getTop()->getChild("child3")->getProperties()->getArrayProperty(
+        "vals")->getSample(0, fromB);
+    TESTING_ASSERT(fromA == fromB);
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageB.samples == bytesB);
+    TESTING_ASSERT(usageA.samples + usageB.samples ==
+                   cacheImpl->getNumBytes());
+
+    // trimming a only drops what a put there
+    a->trim();
+    a->getMemoryUsage(usageA);
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageA.samples == 0);
+    TESTING_ASSERT(usageB.samples == bytesB);
+    TESTING_ASSERT(cacheImpl->getNumBytes() == bytesB);
+    TESTING_ASSERT(cacheImpl->getNumSamples() == 1);
+
+    AbcA::ArraySamplePtr otherBAgain;
+    b->getTop()->getChild("child5")->getProperties()->getArrayProperty(
+        "vals")->getSample(0, otherBAgain);
+    TESTING_ASSERT(otherB == otherBAgain);
+
+    // what a reads again after going away is left in the cache, but no
+    // longer counted by anyone
+    a->getTop()->getChild("child7")->getProperties()->getArrayProperty(
+        "vals")->getSample(0, fromA);
+    a.reset();
+    TESTING_ASSERT(cacheImpl->getNumSamples() == 2);
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageB.samples == bytesB);
+
+    b->trim();
+    b->getMemoryUsage(usageB);
+    TESTING_ASSERT(usageB.samples == 0);
+    TESTING_ASSERT(cacheImpl->getNumSamples() == 1);
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    std::string name = "memoryUsageTest.abc";
+    writeArchive(name);
+    testHeaders(name, false);
+    testHeaders(name, true);
+    testCaches(name);
+    testSharedCache(name);
+    return 0;
+}
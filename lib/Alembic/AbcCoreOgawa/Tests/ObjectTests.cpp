@@ -34,6 +34,7 @@
 //
 //-*****************************************************************************
 
+#include <algorithm>
 #include <sstream>
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
@@ -301,11 +302,291 @@ void testMetaData(bool iUseMMap)
     }
 }
 
+void checkSameProperties(AbcA::CompoundPropertyReaderPtr iLazy,
+                         AbcA::CompoundPropertyReaderPtr iFull)
+{
+    TESTING_ASSERT(iLazy->getNumProperties() == iFull->getNumProperties());
+
+    // go backwards so the lazy headers aren't read in order
+    for (std::size_t i = iFull->getNumProperties(); i > 0; --i)
+    {
+        const AbcA::PropertyHeader & full = iFull->getPropertyHeader(i - 1);
+        const AbcA::PropertyHeader * lazy =
+            iLazy->getPropertyHeader(full.getName());
+        TESTING_ASSERT(lazy == &(iLazy->getPropertyHeader(i - 1)));
+        TESTING_ASSERT(lazy->getName() == full.getName());
+        TESTING_ASSERT(lazy->getPropertyType() == full.getPropertyType());
+        TESTING_ASSERT(lazy->getDataType() == full.getDataType());
+        TESTING_ASSERT(lazy->getMetaData().matchesExactly(
+            full.getMetaData()));
+        TESTING_ASSERT(!full.getTimeSampling() ||
+            *(lazy->getTimeSampling()) == *(full.getTimeSampling()));
+
+        if (full.isCompound())
+        {
+            checkSameProperties(iLazy->getCompoundProperty(full.getName()),
+                                iFull->getCompoundProperty(full.getName()));
+        }
+        else if (full.isArray())
+        {
+            AbcA::ArrayPropertyReaderPtr lazyProp =
+                iLazy->getArrayProperty(full.getName());
+            AbcA::ArrayPropertyReaderPtr fullProp =
+                iFull->getArrayProperty(full.getName());
+            TESTING_ASSERT(lazyProp->getNumSamples() ==
+                           fullProp->getNumSamples());
+            TESTING_ASSERT(lazyProp->isConstant() == fullProp->isConstant());
+            for (std::size_t j = 0; j < fullProp->getNumSamples(); ++j)
+            {
+                AbcA::ArraySampleKey lazyKey, fullKey;
+                TESTING_ASSERT(lazyProp->getKey(j, lazyKey));
+                TESTING_ASSERT(fullProp->getKey(j, fullKey));
+                TESTING_ASSERT(lazyKey == fullKey);
+            }
+        }
+        else
+        {
+            TESTING_ASSERT(iLazy->getScalarProperty(full.getName())->
+                getNumSamples() == iFull->getScalarProperty(full.getName())->
+                getNumSamples());
+        }
+    }
+
+    TESTING_ASSERT(!iLazy->getPropertyHeader("notThere"));
+    TESTING_ASSERT(!iLazy->getArrayProperty("notThere"));
+}
+
+void checkSameObjects(AbcA::ObjectReaderPtr iLazy, AbcA::ObjectReaderPtr iFull)
+{
+    TESTING_ASSERT(iLazy->getNumChildren() == iFull->getNumChildren());
+    checkSameProperties(iLazy->getProperties(), iFull->getProperties());
+
+    for (std::size_t i = iFull->getNumChildren(); i > 0; --i)
+    {
+        const AbcA::ObjectHeader & full = iFull->getChildHeader(i - 1);
+        const AbcA::ObjectHeader * lazy = iLazy->getChildHeader(full.getName());
+        TESTING_ASSERT(lazy == &(iLazy->getChildHeader(i - 1)));
+        TESTING_ASSERT(lazy->getName() == full.getName());
+        TESTING_ASSERT(lazy->getFullName() == full.getFullName());
+        TESTING_ASSERT(lazy->getMetaData().matchesExactly(
+            full.getMetaData()));
+        checkSameObjects(iLazy->getChild(i - 1), iFull->getChild(i - 1));
+    }
+
+    TESTING_ASSERT(!iLazy->getChildHeader("notThere"));
+    TESTING_ASSERT(!iLazy->getChild("notThere"));
+}
+
+void testLazyHeaders(bool iUseMMap)
+{
+    std::string archiveName = "lazyHeadersTest.abc";
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::TimeSamplingPtr ts(new AbcA::TimeSampling(1.0 / 24.0, 2.0));
+        Alembic::Util::uint32_t tsIndex = a->addTimeSampling(*ts);
+
+        AbcA::ObjectWriterPtr child = a->getTop()->createChild(
+            AbcA::ObjectHeader("lazy", AbcA::MetaData()));
+
+        // long metadata isn't indexed, it is written with the header
+        AbcA::MetaData longMeta;
+        longMeta.set("long", std::string(300, 'x'));
+
+        AbcA::CompoundPropertyWriterPtr props = child->getProperties();
+        for (std::size_t i = 0; i < 300; ++i)
+        {
+            std::stringstream strm;
+            strm << "prop" << i;
+            AbcA::MetaData m;
+            m.set("index", strm.str());
+            AbcA::DataType dtype(i % 2 ? Alembic::Util::kInt32POD :
+                                 Alembic::Util::kFloat64POD, 1 + i % 3);
+            AbcA::ArrayPropertyWriterPtr prop = props->createArrayProperty(
+                strm.str(), i % 7 ? m : longMeta, dtype, i % 5 ? tsIndex : 0);
+
+            std::vector< Alembic::Util::float64_t > vals(3 * (i + 1), i);
+            prop->setSample(AbcA::ArraySample(&vals.front(), dtype,
+                Alembic::Util::Dimensions(i + 1)));
+            prop->setSample(AbcA::ArraySample(&vals.front(), dtype,
+                Alembic::Util::Dimensions(i % 4 + 1)));
+        }
+
+        AbcA::CompoundPropertyWriterPtr compound =
+            props->createCompoundProperty("compound", longMeta);
+        AbcA::DataType i8d(Alembic::Util::kInt8POD, 1);
+        AbcA::ScalarPropertyWriterPtr scalar =
+            compound->createScalarProperty("scalar", AbcA::MetaData(), i8d,
+                                           tsIndex);
+        Alembic::Util::int8_t val = 3;
+        scalar->setSample(&val);
+        compound->createCompoundProperty("empty", AbcA::MetaData());
+
+        for (std::size_t i = 0; i < 50; ++i)
+        {
+            std::stringstream strm;
+            strm << "child" << i;
+            child->createChild(AbcA::ObjectHeader(strm.str(),
+                i % 3 ? longMeta : AbcA::MetaData()))->createChild(
+                AbcA::ObjectHeader("grandChild", AbcA::MetaData()));
+        }
+    }
+
+    {
+        AO::ReadArchive lazyReader(1, iUseMMap);
+        lazyReader.setLazyHeaders(true);
+        AbcA::ArchiveReaderPtr lazy = lazyReader(archiveName);
+        AO::ReadArchive fullReader(1, iUseMMap);
+        AbcA::ArchiveReaderPtr full = fullReader(archiveName);
+
+        // ask for one property first, which is the point of lazy headers
+        AbcA::ArrayPropertyReaderPtr prop =
+            lazy->getTop()->getChild(0)->getProperties()->getArrayProperty(
+            "prop150");
+        TESTING_ASSERT(prop->getNumSamples() == 2);
+        TESTING_ASSERT(prop->getMetaData().get("index") == "prop150");
+
+        AbcA::ArraySamplePtr samp;
+        prop->getSample(0, samp);
+        TESTING_ASSERT(samp->getDimensions().numPoints() == 151);
+        TESTING_ASSERT(((const Alembic::Util::float64_t *)
+            samp->getData())[0] == 150.0);
+
+        checkSameObjects(lazy->getTop(), full->getTop());
+    }
+}
+
+bool headerNameLess(const AbcA::ObjectHeader & iA,
+                    const AbcA::ObjectHeader & iB)
+{
+    return iA.getName() < iB.getName();
+}
+
+void checkIndexedObjects(AbcA::ArchiveReaderPtr iArchive,
+                         AbcA::ObjectReaderPtr iObject)
+{
+    std::vector< AbcA::ObjectHeader > walked;
+    for (std::size_t i = 0; i < iObject->getNumChildren(); ++i)
+    {
+        const AbcA::ObjectHeader & child = iObject->getChildHeader(i);
+        walked.push_back(child);
+
+        AbcA::ObjectHeader indexed;
+        TESTING_ASSERT(iArchive->getIndexedObjectHeader(child.getFullName(),
+                                                        indexed));
+        TESTING_ASSERT(indexed.getName() == child.getName());
+        TESTING_ASSERT(indexed.getFullName() == child.getFullName());
+        TESTING_ASSERT(indexed.getMetaData().matchesExactly(
+            child.getMetaData()));
+
+        checkIndexedObjects(iArchive, iObject->getChild(i));
+    }
+
+    std::sort(walked.begin(), walked.end(), headerNameLess);
+
+    std::vector< AbcA::ObjectHeader > children;
+    TESTING_ASSERT(iArchive->getIndexedChildHeaders(
+        iObject->getFullName(), children));
+    TESTING_ASSERT(children.size() == walked.size());
+    for (std::size_t i = 0; i < children.size(); ++i)
+    {
+        TESTING_ASSERT(children[i].getFullName() == walked[i].getFullName());
+    }
+}
+
+void testHierarchyIndex(bool iUseMMap)
+{
+    std::string archiveName = "hierarchyIndexTest.abc";
+    {
+        AO::WriteArchive w;
+        w.setHierarchyIndex(true);
+        AbcA::MetaData archiveMeta;
+        archiveMeta.set("archive", "meta");
+        AbcA::ArchiveWriterPtr a = w(archiveName, archiveMeta);
+
+        AbcA::MetaData longMeta;
+        longMeta.set("long", std::string(300, 'x'));
+
+        // ' ' and '-' sort before '/' so the children of "a" are not all
+        // next to each other in the index
+        const char * names[] = {"a", "a b", "a-b", "ab", "b"};
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            AbcA::MetaData m;
+            m.set("index", names[i]);
+            AbcA::ObjectWriterPtr child = a->getTop()->createChild(
+                AbcA::ObjectHeader(names[i], i % 2 ? longMeta : m));
+            for (std::size_t j = 0; j < 5; ++j)
+            {
+                AbcA::ObjectWriterPtr grandChild = child->createChild(
+                    AbcA::ObjectHeader(names[4 - j], m));
+                grandChild->createChild(AbcA::ObjectHeader("leaf", m));
+            }
+        }
+        a->getTop()->createChild(AbcA::ObjectHeader("empty",
+                                                    AbcA::MetaData()));
+    }
+
+    {
+        AO::ReadArchive reader(1, iUseMMap);
+        AbcA::ArchiveReaderPtr a = reader(archiveName);
+
+        AbcA::ObjectHeader header;
+        TESTING_ASSERT(a->getIndexedObjectHeader("/a-b/a b/leaf", header));
+        TESTING_ASSERT(header.getName() == "leaf");
+        TESTING_ASSERT(header.getFullName() == "/a-b/a b/leaf");
+        TESTING_ASSERT(header.getMetaData().get("index") == "a-b");
+
+        TESTING_ASSERT(a->getIndexedObjectHeader("/", header));
+        TESTING_ASSERT(header.getFullName() == "/");
+        TESTING_ASSERT(header.getMetaData().get("archive") == "meta");
+
+        TESTING_ASSERT(!a->getIndexedObjectHeader("/a/c", header));
+        TESTING_ASSERT(!a->getIndexedObjectHeader("/a/", header));
+        TESTING_ASSERT(!a->getIndexedObjectHeader("/empty/leaf", header));
+        TESTING_ASSERT(!a->getIndexedObjectHeader("", header));
+
+        std::vector< AbcA::ObjectHeader > children;
+        TESTING_ASSERT(a->getIndexedChildHeaders("/", children));
+        TESTING_ASSERT(children.size() == 6);
+        TESTING_ASSERT(a->getIndexedChildHeaders("/a", children));
+        TESTING_ASSERT(children.size() == 5);
+        TESTING_ASSERT(children[0].getFullName() == "/a/a");
+        TESTING_ASSERT(children[4].getFullName() == "/a/b");
+        TESTING_ASSERT(a->getIndexedChildHeaders("/empty", children));
+        TESTING_ASSERT(children.empty());
+        TESTING_ASSERT(a->getIndexedChildHeaders("/notThere", children));
+        TESTING_ASSERT(children.empty());
+
+        checkIndexedObjects(a, a->getTop());
+    }
+
+    // archives written without the index just don't have one
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        a->getTop()->createChild(AbcA::ObjectHeader("a", AbcA::MetaData()));
+    }
+
+    {
+        AO::ReadArchive reader(1, iUseMMap);
+        AbcA::ArchiveReaderPtr a = reader(archiveName);
+        AbcA::ObjectHeader header;
+        TESTING_ASSERT(!a->getIndexedObjectHeader("/a", header));
+        TESTING_ASSERT(!a->getIndexedObjectHeader("/", header));
+        std::vector< AbcA::ObjectHeader > children;
+        TESTING_ASSERT(!a->getIndexedChildHeaders("/", children));
+        TESTING_ASSERT(a->getTop()->getNumChildren() == 1);
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testObjects(iUseMMap);
     testChildObjects(iUseMMap);
     testMetaData(iUseMMap);
+    testLazyHeaders(iUseMMap);
+    testHierarchyIndex(iUseMMap);
 }
 
 int main ( int argc, char *argv[] )
@@ -0,0 +1,198 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Not run as part of the tests.  Writes a hierarchy where every object has
+// a few scalar, array and compound properties, then times walking all of it
+// the way an importer does, making a reader for every object and property
+// and letting them go again as it moves on.
+//
+// usage: AbcCoreOgawa_ReaderTraversal_Bench [childrenPerObject] [depth]
+//                                            [numPasses] [file]
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace AO = Alembic::AbcCoreOgawa;
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+namespace
+{
+
+//-*****************************************************************************
+void addProperties( ABCA::CompoundPropertyWriterPtr iProps,
+                    std::size_t iDepth )
+{
+    ABCA::MetaData m;
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+    ABCA::DataType f32d( Alembic::Util::kFloat32POD, 3 );
+    Alembic::Util::int32_t vals[3] = { 0, 1, 2 };
+
+    for ( std::size_t i = 0; i < 2; ++i )
+    {
+        std::stringstream strm;
+        strm << "scalar" << i;
+        iProps->createScalarProperty( strm.str(), m, i32d, 0 )->setSample(
+            vals );
+
+        strm.str( "" );
+        strm << "array" << i;
+        iProps->createArrayProperty( strm.str(), m, f32d, 0 )->setSample(
+            ABCA::ArraySample( vals, f32d, Alembic::Util::Dimensions( 1 ) ) );
+    }
+
+    if ( iDepth > 0 )
+    {
+        addProperties( iProps->createCompoundProperty( "compound", m ),
+                       iDepth - 1 );
+    }
+}
+
+//-*****************************************************************************
+void addChildren( ABCA::ObjectWriterPtr iParent, std::size_t iNumChildren,
+                  std::size_t iDepth )
+{
+    addProperties( iParent->getProperties(), 1 );
+
+    if ( iDepth == 0 )
+    {
+        return;
+    }
+
+    for ( std::size_t i = 0; i < iNumChildren; ++i )
+    {
+        std::stringstream strm;
+        strm << "object" << i;
+        addChildren( iParent->createChild(
+            ABCA::ObjectHeader( strm.str(), ABCA::MetaData() ) ),
+            iNumChildren, iDepth - 1 );
+    }
+}
+
+//-*****************************************************************************
+// returns a count so the work can't be optimized away
+std::size_t walkProperties( ABCA::CompoundPropertyReaderPtr iProps )
+{
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < iProps->getNumProperties(); ++i )
+    {
+        const ABCA::PropertyHeader & header = iProps->getPropertyHeader( i );
+        if ( header.isScalar() )
+        {
+            count += iProps->getScalarProperty( i )->getNumSamples();
+        }
+        else if ( header.isArray() )
+        {
+            count += iProps->getArrayProperty( i )->getNumSamples();
+        }
+        else
+        {
+            count += walkProperties( iProps->getCompoundProperty( i ) );
+        }
+    }
+
+    return count;
+}
+
+//-*****************************************************************************
+std::size_t walkObjects( ABCA::ObjectReaderPtr iObj )
+{
+    std::size_t count = walkProperties( iObj->getProperties() );
+    for ( std::size_t i = 0; i < iObj->getNumChildren(); ++i )
+    {
+        count += walkObjects( iObj->getChild( i ) );
+    }
+
+    return count;
+}
+
+}
+
+int main( int argc, char *argv[] )
+{
+    std::size_t numChildren = 10;
+    if ( argc > 1 )
+    {
+        numChildren = strtoul( argv[1], NULL, 10 );
+    }
+
+    std::size_t depth = 4;
+    if ( argc > 2 )
+    {
+        depth = strtoul( argv[2], NULL, 10 );
+    }
+
+    std::size_t numPasses = 5;
+    if ( argc > 3 )
+    {
+        numPasses = strtoul( argv[3], NULL, 10 );
+    }
+
+    std::string fileName = "readerTraversalBench.abc";
+    if ( argc > 4 )
+    {
+        fileName = argv[4];
+    }
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( fileName, ABCA::MetaData() );
+        addChildren( a->getTop(), numChildren, depth );
+    }
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < numPasses; ++i )
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( fileName );
+        count += walkObjects( a->getTop() );
+    }
+
+    double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << numChildren << " children, depth " << depth << ": "
+              << seconds / numPasses << " s per pass (" << count << ")"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,421 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreOgawa/CacheImpl.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+ABCA::ArraySamplePtr makeSample(std::size_t iNumVals,
+                                Alembic::Util::int32_t iVal)
+{
+    ABCA::DataType dtype(Alembic::Util::kInt32POD, 1);
+    ABCA::ArraySamplePtr samp = ABCA::AllocateArraySample(dtype,
+        Alembic::Util::Dimensions(iNumVals));
+    Alembic::Util::int32_t * data =
+        (Alembic::Util::int32_t *)(samp->getData());
+    for (std::size_t i = 0; i < iNumVals; ++i)
+    {
+        data[i] = iVal;
+    }
+    return samp;
+}
+
+//-*****************************************************************************
+void testLRU()
+{
+    // room for 2 samples of 100 ints
+    AO::CacheImpl cache(1000);
+
+    ABCA::ArraySamplePtr a = makeSample(100, 1);
+    ABCA::ArraySamplePtr b = makeSample(100, 2);
+    ABCA::ArraySamplePtr c = makeSample(100, 3);
+    ABCA::ArraySample::Key aKey = a->getKey();
+    ABCA::ArraySample::Key bKey = b->getKey();
+    ABCA::ArraySample::Key cKey = c->getKey();
+
+    TESTING_ASSERT(!cache.find(aKey));
+    TESTING_ASSERT(cache.store(aKey, a).getSample() == a);
+    TESTING_ASSERT(cache.store(bKey, b).getSample() == b);
+    TESTING_ASSERT(cache.getNumBytes() == 800);
+
+    // storing the same key again gives back what was already there
+    ABCA::ArraySamplePtr a2 = makeSample(100, 1);
+    TESTING_ASSERT(cache.store(aKey, a2).getSample() == a);
+
+    // a is the most recently used now, so b gets dropped
+    TESTING_ASSERT(cache.find(aKey).getSample() == a);
+    cache.store(cKey, c);
+    TESTING_ASSERT(cache.getNumSamples() == 2);
+    TESTING_ASSERT(cache.getNumBytes() == 800);
+    TESTING_ASSERT(!cache.find(bKey));
+    TESTING_ASSERT(cache.find(aKey));
+    TESTING_ASSERT(cache.find(cKey));
+
+    // b is still valid for whoever is holding onto it
+    TESTING_ASSERT(((Alembic::Util::int32_t *)(b->getData()))[99] == 2);
+
+    // too big to cache, but we still get it back
+    ABCA::ArraySamplePtr big = makeSample(1000, 4);
+    TESTING_ASSERT(cache.store(big->getKey(), big).getSample() == big);
+    TESTING_ASSERT(!cache.find(big->getKey()));
+    TESTING_ASSERT(cache.getNumSamples() == 2);
+}
+
+//-*****************************************************************************
+void testThreads()
+{
+    ABCA::ReadArraySampleCachePtr cache = AO::CreateCache(40000);
+
+    std::vector< ABCA::ArraySamplePtr > samps;
+    for (Alembic::Util::int32_t i = 0; i < 64; ++i)
+    {
+        samps.push_back(makeSample(100, i));
+    }
+
+    std::vector< std::thread > threads;
+    for (std::size_t t = 0; t < 8; ++t)
+    {
+        threads.push_back(std::thread([&cache, &samps, t]()
+        {
+            for (std::size_t i = 0; i < 5000; ++i)
+            {
+                ABCA::ArraySamplePtr samp =
+                    samps[(i * 7 + t * 13) % samps.size()];
+                ABCA::ArraySample::Key key = samp->getKey();
+                ABCA::ReadArraySampleID found = cache->find(key);
+                if (!found)
+                {
+                    found = cache->store(key, samp);
+                }
+                TESTING_ASSERT(found.getSample()->getKey() == key);
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    AO::CacheImpl * impl = dynamic_cast< AO::CacheImpl * >(cache.get());
+    TESTING_ASSERT(impl && impl->getNumBytes() <= 40000);
+    TESTING_ASSERT(impl->getNumSamples() == 64);
+}
+
+//-*****************************************************************************
+void testArchiveCache(bool iUseMMap)
+{
+    std::string archiveName = "sampleCache.abc";
+
+    std::vector< Alembic::Util::float32_t > vals(300);
+    for (std::size_t i = 0; i < vals.size(); ++i)
+    {
+        vals[i] = (Alembic::Util::float32_t) i;
+    }
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr top = a->getTop();
+
+        ABCA::DataType fd(Alembic::Util::kFloat32POD, 1);
+        ABCA::DataType v3d(Alembic::Util::kFloat32POD, 3);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            std::string name = std::string("obj") + char('0' + i);
+            ABCA::ObjectWriterPtr obj = top->createChild(
+                ABCA::ObjectHeader(name, ABCA::MetaData()));
+            ABCA::CompoundPropertyWriterPtr parent = obj->getProperties();
+
+            ABCA::ArrayPropertyWriterPtr fp =
+                parent->createArrayProperty("f", ABCA::MetaData(), fd, 0);
+            fp->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(vals.size())));
+
+            // same data, different shape
+            ABCA::ArrayPropertyWriterPtr vp =
+                parent->createArrayProperty("v", ABCA::MetaData(), v3d, 0);
+            vp->setSample(ABCA::ArraySample(&(vals.front()), v3d,
+                Alembic::Util::Dimensions(vals.size() / 3)));
+
+            // an empty sample
+            ABCA::ArrayPropertyWriterPtr ep =
+                parent->createArrayProperty("e", ABCA::MetaData(), fd, 0);
+            ep->setSample(ABCA::ArraySample(&(vals.front()), fd,
+                Alembic::Util::Dimensions(0)));
+        }
+    }
+
+    ABCA::ReadArraySampleCachePtr cache = AO::CreateCache();
+    AO::CacheImpl * impl = dynamic_cast< AO::CacheImpl * >(cache.get());
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName, cache);
+        TESTING_ASSERT(a->getReadArraySampleCachePtr() == cache);
+
+        ABCA::ObjectReaderPtr top = a->getTop();
+        ABCA::ArraySamplePtr firstF, firstV;
+        for (std::size_t i = 0; i < top->getNumChildren(); ++i)
+        {
+            ABCA::CompoundPropertyReaderPtr parent =
+                top->getChild(i)->getProperties();
+
+            ABCA::ArraySamplePtr fSamp, vSamp, eSamp;
+            parent->getArrayProperty("f")->getSample(0, fSamp);
+            parent->getArrayProperty("v")->getSample(0, vSamp);
+            parent->getArrayProperty("e")->getSample(0, eSamp);
+
+            TESTING_ASSERT(fSamp->size() == 300);
+            TESTING_ASSERT(fSamp->getDataType().getExtent() == 1);
+            TESTING_ASSERT(vSamp->size() == 100);
+            TESTING_ASSERT(vSamp->getDataType().getExtent() == 3);
+            TESTING_ASSERT(eSamp->size() == 0);
+            TESTING_ASSERT(
+                ((const Alembic::Util::float32_t *)vSamp->getData())[299] ==
+                299.0f);
+
+            // the shared data was only read once
+            if (i == 0)
+            {
+                firstF = fSamp;
+                firstV = vSamp;
+            }
+            else
+            {
+                TESTING_ASSERT(fSamp == firstF);
+                TESTING_ASSERT(vSamp == firstV);
+            }
+        }
+
+        TESTING_ASSERT(impl->getNumSamples() == 2);
+    }
+
+    // a new archive can share the same cache
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName, cache);
+        ABCA::ArraySamplePtr fSamp;
+        a->getTop()->getChild(2)->getProperties()->getArrayProperty(
+            "f")->getSample(0, fSamp);
+        TESTING_ASSERT(fSamp->size() == 300);
+        TESTING_ASSERT(impl->getNumSamples() == 2);
+    }
+
+    // no cache
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        TESTING_ASSERT(!a->getReadArraySampleCachePtr());
+        ABCA::CompoundPropertyReaderPtr p0 =
+            a->getTop()->getChild(0)->getProperties();
+        ABCA::CompoundPropertyReaderPtr p1 =
+            a->getTop()->getChild(1)->getProperties();
+        ABCA::ArraySamplePtr s0, s1;
+        p0->getArrayProperty("f")->getSample(0, s0);
+        p1->getArrayProperty("f")->getSample(0, s1);
+        TESTING_ASSERT(s0 != s1);
+    }
+}
+
+//-*****************************************************************************
+void testBufferPool(bool iHugePages)
+{
+    // room to keep 2 buffers of 4000 bytes
+    ABCA::SampleBufferAllocatorPtr pool =
+        AO::CreateSampleBufferPool(10000, iHugePages);
+
+    void * a = pool->allocate(4000);
+    void * b = pool->allocate(4000);
+    void * c = pool->allocate(4000);
+    TESTING_ASSERT(a != b && b != c && a != c);
+    TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+
+    // what is given back is handed out again, for about the same size
+    pool->deallocate(a, 4000);
+    TESTING_ASSERT(pool->getNumFreeBytes() >= 4000);
+    TESTING_ASSERT(pool->allocate(3900) == a);
+    TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+
+    // but not for a very different one
+    pool->deallocate(a, 3900);
+    void * d = pool->allocate(100);
+    TESTING_ASSERT(d != a);
+    pool->deallocate(d, 100);
+
+    // only what fits in the budget is kept
+    pool->deallocate(b, 4000);
+    pool->deallocate(c, 4000);
+    TESTING_ASSERT(pool->getNumFreeBytes() <= 10000);
+
+    pool->trim();
+    TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+
+    // big enough for huge pages, if they were asked for
+    std::size_t numBytes = 3 * 1024 * 1024;
+    char * big = (char *) pool->allocate(numBytes);
+    big[0] = 1;
+    big[numBytes - 1] = 2;
+    pool->deallocate(big, numBytes);
+    TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+
+    // from many threads at once
+    std::vector< std::thread > threads;
+    for (std::size_t t = 0; t < 8; ++t)
+    {
+        threads.push_back(std::thread([&pool, t]()
+        {
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                std::size_t size = 100 + ((i + t) % 10) * 100;
+                char * buf = (char *) pool->allocate(size);
+                buf[0] = (char) t;
+                buf[size - 1] = (char) i;
+                TESTING_ASSERT(buf[0] == (char) t);
+                pool->deallocate(buf, size);
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    TESTING_ASSERT(pool->getNumFreeBytes() <= 10000);
+}
+
+//-*****************************************************************************
+void testArchiveBufferPool(bool iUseMMap)
+{
+    // written by testArchiveCache
+    std::string archiveName = "sampleCache.abc";
+
+    ABCA::SampleBufferAllocatorPtr pool = AO::CreateSampleBufferPool();
+
+    AO::ReadArchive r(1, iUseMMap);
+    r.setSampleBufferAllocator(pool);
+    ABCA::ArchiveReaderPtr a = r(archiveName);
+    TESTING_ASSERT(a->getSampleBufferAllocator() == pool);
+
+    ABCA::ArrayPropertyReaderPtr fp =
+        a->getTop()->getChild(0)->getProperties()->getArrayProperty("f");
+    ABCA::ArrayPropertyReaderPtr ep =
+        a->getTop()->getChild(0)->getProperties()->getArrayProperty("e");
+
+    const void * first = NULL;
+    {
+        ABCA::ArraySamplePtr fSamp;
+        fp->getSample(0, fSamp);
+        TESTING_ASSERT(fSamp->size() == 300);
+        TESTING_ASSERT(
+            ((const Alembic::Util::float32_t *)fSamp->getData())[299] ==
+            299.0f);
+        first = fSamp->getData();
+        TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+    }
+
+    // the buffer is kept, and reported with the samples
+    TESTING_ASSERT(pool->getNumFreeBytes() >= 300 * 4);
+    ABCA::MemoryUsage usage;
+    a->getMemoryUsage(usage);
+    TESTING_ASSERT(usage.samples == pool->getNumFreeBytes());
+
+    // reading the same sample again reuses it
+    {
+        ABCA::ArraySamplePtr fSamp;
+        fp->getSample(0, fSamp);
+        TESTING_ASSERT(fSamp->getData() == first);
+        TESTING_ASSERT(
+            ((const Alembic::Util::float32_t *)fSamp->getData())[12] ==
+            12.0f);
+    }
+
+    // and so does reading it in the background
+    {
+        std::vector< ABCA::index_t > indices(1, 0);
+        ABCA::ArraySampleRequestPtr request = fp->requestSamples(indices);
+        ABCA::ArraySamplePtr fSamp = request->getSample(0);
+        TESTING_ASSERT(fSamp->getData() == first);
+        TESTING_ASSERT(fSamp->size() == 300);
+    }
+
+    // empty samples don't need a buffer
+    {
+        ABCA::ArraySamplePtr eSamp;
+        ep->getSample(0, eSamp);
+        TESTING_ASSERT(eSamp->size() == 0);
+    }
+
+    // samples outlive the archive and hand their buffer back afterwards
+    ABCA::ArraySamplePtr held;
+    fp->getSample(0, held);
+    fp.reset();
+    ep.reset();
+    a->trim();
+    TESTING_ASSERT(pool->getNumFreeBytes() == 0);
+    a.reset();
+    TESTING_ASSERT(
+        ((const Alembic::Util::float32_t *)held->getData())[299] == 299.0f);
+    held.reset();
+    TESTING_ASSERT(pool->getNumFreeBytes() >= 300 * 4);
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testLRU();
+    testThreads();
+    testArchiveCache(true);
+    testArchiveCache(false);
+    testBufferPool(false);
+    testBufferPool(true);
+    testArchiveBufferPool(true);
+    testArchiveBufferPool(false);
+    return 0;
+}
@@ -0,0 +1,147 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Not run as part of the tests.  Writes lots of small array samples, most of
+// them different, and reports how fast they were written and the peak
+// memory use of the process.  Run it once per limit to compare them.
+//
+// usage: AbcCoreOgawa_WrittenSampleMap_Bench [numSamples] [limitMB] [file]
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace AO = Alembic::AbcCoreOgawa;
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+namespace
+{
+
+const std::size_t NUM_OBJECTS = 10;
+const std::size_t PROPS_PER_OBJECT = 100;
+
+// in megabytes
+double peakMemory()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+#ifdef __APPLE__
+    return usage.ru_maxrss / ( 1024.0 * 1024.0 );
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#else
+    return -1.0;
+#endif
+}
+
+}
+
+int main( int argc, char *argv[] )
+{
+    std::size_t numSamples = 10000000;
+    if ( argc > 1 )
+    {
+        numSamples = strtoul( argv[1], NULL, 10 );
+    }
+
+    std::size_t limitMB = 0;
+    if ( argc > 2 )
+    {
+        limitMB = strtoul( argv[2], NULL, 10 );
+    }
+
+    std::string fileName = "writtenSampleMapBench.abc";
+    if ( argc > 3 )
+    {
+        fileName = argv[3];
+    }
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    {
+        AO::WriteArchive w;
+        w.setWrittenSampleMapSize( limitMB * 1024 * 1024 );
+        ABCA::MetaData m;
+        ABCA::ArchiveWriterPtr a = w( fileName, m );
+        ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+
+        std::vector< ABCA::ObjectWriterPtr > objs;
+        std::vector< ABCA::ArrayPropertyWriterPtr > props;
+        for ( std::size_t i = 0; i < NUM_OBJECTS; ++i )
+        {
+            std::stringstream strm;
+            strm << "obj" << i;
+            objs.push_back( a->getTop()->createChild(
+                ABCA::ObjectHeader( strm.str(), m ) ) );
+            for ( std::size_t j = 0; j < PROPS_PER_OBJECT; ++j )
+            {
+                std::stringstream propName;
+                propName << "prop" << j;
+                props.push_back( objs.back()->getProperties()->
+                    createArrayProperty( propName.str(), m, i32d, 0 ) );
+            }
+        }
+
+        // every 8th sample repeats one from a long time ago, the rest are new
+        Alembic::Util::int32_t vals[4] = { 0, 1, 2, 3 };
+        for ( std::size_t i = 0; i < numSamples; ++i )
+        {
+            vals[0] = ( Alembic::Util::int32_t )
+                ( i % 8 == 7 ? i / 2 : i );
+            props[i % props.size()]->setSample( ABCA::ArraySample( vals,
+                i32d, Alembic::Util::Dimensions( 4 ) ) );
+        }
+    }
+
+    double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << numSamples << " samples, limit " << limitMB << " MB: "
+              << numSamples / seconds << " samples/s, peak memory "
+              << peakMemory() << " MB" << std::endl;
+
+    return 0;
+}
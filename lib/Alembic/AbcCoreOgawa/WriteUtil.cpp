@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/Compression.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -156,6 +157,32 @@ GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal )
     return ptr->getWrittenSampleMap();
 }
 
+//-*****************************************************************************
+void SetHasEncodedSamples( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->setHasEncodedSamples();
+}
+
+//-*****************************************************************************
+void SetHasChunkedDigests( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->setHasChunkedDigests();
+}
+
+//-*****************************************************************************
+void UpdateMaxNumSamples( AbcA::ArchiveWriterPtr iVal,
+                          Util::uint32_t iIndex,
+                          index_t iNumSamples )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->updateMaxNumSamples( iIndex, iNumSamples );
+}
+
 //-*****************************************************************************
 void WriteDimensions( Ogawa::OGroupPtr iGroup,
                       const AbcA::Dimensions & iDims,
@@ -179,11 +206,12 @@ void WriteDimensions( Ogawa::OGroupPtr iGroup,
 }
 
 //-*****************************************************************************
-WrittenSampleIDPtr
+WrittenSampleID
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint )
 {
 
     // Okay, need to actually store it.
@@ -191,9 +219,14 @@ WriteData( WrittenSampleMap &iMap,
 
     const AbcA::Dimensions & dims = iSamp.getDimensions();
 
+    bool encode = iCompressionHint >= 0;
+
     // See whether or not we've already stored this.
-    WrittenSampleIDPtr writeID = iMap.find( iKey );
-    if ( writeID )
+    // Empty samples are just the key, so they can always be shared, otherwise
+    // the already written data has to have been written the same way.
+    WrittenSampleID writeID;
+    if ( iMap.find( iKey, writeID ) &&
+         ( writeID.isEncoded() == encode || writeID.isKeyOnly() ) )
     {
         CopyWrittenData( iGroup, writeID );
         return writeID;
@@ -203,10 +236,16 @@ WriteData( WrittenSampleMap &iMap,
 
     const AbcA::DataType &dataType = iSamp.getDataType();
 
+    // what we will actually write after the key
+    const void * data = iSamp.getData();
+    Util::uint64_t dataSize = iKey.numBytes;
+
+    std::vector <Util::int8_t> strData;
+    std::vector <Util::int32_t> wstrData;
+
     if ( dataType.getPod() == Alembic::Util::kStringPOD )
     {
         size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int8_t> v;
         for ( size_t j = 0; j < numPods; ++j )
         {
             const std::string &str =
@@ -218,21 +257,19 @@ WriteData( WrittenSampleMap &iMap,
             size_t strLen = str.length();
             for ( size_t k = 0; k < strLen; ++k )
             {
-                v.push_back(str[k]);
+                strData.push_back(str[k]);
             }
 
             // append a 0 for the NULL seperator character
-            v.push_back(0);
+            strData.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        data = strData.empty() ? NULL : &strData.front();
+        dataSize = strData.size();
     }
     else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
     {
         size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int32_t> v;
         for ( size_t j = 0; j < numPods; ++j )
         {
             const std::wstring &str =
@@ -245,28 +282,45 @@ WriteData( WrittenSampleMap &iMap,
             size_t strLen = str.length();
             for ( size_t k = 0; k < strLen; ++k )
             {
-                v.push_back(str[k]);
+                wstrData.push_back(str[k]);
             }
 
             // append a 0 for the NULL seperator character
-            v.push_back(0);
+            wstrData.push_back(0);
         }
 
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16,
-            v.size() * sizeof(Util::int32_t) };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        data = wstrData.empty() ? NULL : &wstrData.front();
+        dataSize = wstrData.size() * sizeof(Util::int32_t);
     }
-    else
+
+    if ( encode && dataSize > 0 )
     {
-        const void * datas[2] = { &iKey.digest, iSamp.getData() };
-        Alembic::Util::uint64_t sizes[2] = { 16, iKey.numBytes };
+        Util::uint8_t header[ENCODED_HEADER_SIZE];
+        std::vector< Util::uint8_t > compressed;
+        EncodeData( data, dataSize, dataType.getPod(), iCompressionHint,
+                    header, compressed );
 
+        if ( !compressed.empty() )
+        {
+            data = &compressed.front();
+            dataSize = compressed.size();
+        }
+
+        const void * datas[3] = { &iKey.digest, header, data };
+        Alembic::Util::uint64_t sizes[3] = { 16, ENCODED_HEADER_SIZE,
+                                             dataSize };
+        dataPtr = iGroup->addData( 3, sizes, datas );
+    }
+    else
+    {
+        const void * datas[2] = { &iKey.digest, data };
+        Alembic::Util::uint64_t sizes[2] = { 16, dataSize };
         dataPtr = iGroup->addData( 2, sizes, datas );
     }
 
-    writeID.reset( new WrittenSampleID( iKey, dataPtr,
-                        dataType.getExtent() * dims.numPoints() ) );
+    writeID = WrittenSampleID( iKey, dataPtr->getPos(),
+                               dataType.getExtent() * dims.numPoints(),
+                               encode, dataPtr->getSize() <= 16 );
     iMap.store( writeID );
 
     // Return the reference.
@@ -274,16 +328,39 @@ WriteData( WrittenSampleMap &iMap,
 }
 
 //-*****************************************************************************
-void CopyWrittenData( Ogawa::OGroupPtr iGroup,
-                      WrittenSampleIDPtr iRef )
+WrittenSampleID
+CopyRawData( WrittenSampleMap &iMap,
+             Ogawa::OGroupPtr iGroup,
+             Ogawa::IDataPtr iData,
+             std::size_t iThreadId,
+             const AbcA::ArraySample::Key &iKey,
+             bool iIsEncoded,
+             std::size_t iNumPoints )
 {
-    ABCA_ASSERT( ( bool )iRef,
-                  "CopyWrittenData() passed a bogus ref" );
+    WrittenSampleID writeID;
+    if ( iMap.find( iKey, writeID ) &&
+         ( writeID.isEncoded() == iIsEncoded || writeID.isKeyOnly() ) )
+    {
+        CopyWrittenData( iGroup, writeID );
+        return writeID;
+    }
 
+    Ogawa::ODataPtr dataPtr = iGroup->addData( iData, iThreadId );
+
+    writeID = WrittenSampleID( iKey, dataPtr->getPos(), iNumPoints,
+                               iIsEncoded, dataPtr->getSize() <= 16 );
+    iMap.store( writeID );
+    return writeID;
+}
+
+//-*****************************************************************************
+void CopyWrittenData( Ogawa::OGroupPtr iGroup,
+                      const WrittenSampleID & iRef )
+{
     ABCA_ASSERT( iGroup,
                 "CopyWrittenData() passed in a bogus OGroupPtr" );
 
-    iGroup->addData(iRef->getObjectLocation());
+    iGroup->addExistingData( iRef.getPos() );
 }
 
 //-*****************************************************************************
@@ -291,6 +368,7 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                     const AbcA::PropertyHeader &iHeader,
                     bool isScalarLike,
                     bool isHomogenous,
+                    bool isEncoded,
                     Util::uint32_t iTimeSamplingIndex,
                     Util::uint32_t iNumSamples,
                     Util::uint32_t iFirstChangedIndex,
@@ -345,6 +423,9 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the samples have the encoded sample header mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
 
     std::string metaData = iHeader.getMetaData().serialize();
     Util::uint32_t metaDataSize = metaData.size();
@@ -429,6 +510,11 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
             info |= 0x400;
         }
 
+        if ( isEncoded )
+        {
+            info |= 0x10000000;
+        }
+
         ABCA_ASSERT( iFirstChangedIndex <= iNumSamples &&
             iLastChangedIndex <= iNumSamples &&
             iFirstChangedIndex <= iLastChangedIndex,
@@ -509,6 +595,42 @@ void WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
     }
 }
 
+//-*****************************************************************************
+static bool
+fullNameLess( const std::pair< ObjectHeaderPtr, Util::uint64_t > & iA,
+              const std::pair< ObjectHeaderPtr, Util::uint64_t > & iB )
+{
+    return iA.first->getFullName() < iB.first->getFullName();
+}
+
+//-*****************************************************************************
+void WriteHierarchyIndex( std::vector< Util::uint8_t > & ioData,
+                          std::vector< std::pair< ObjectHeaderPtr,
+                                                  Util::uint64_t > > & ioObjects,
+                          MetaDataMapPtr iMap )
+{
+    std::sort( ioObjects.begin(), ioObjects.end(), fullNameLess );
+
+    std::size_t start = ioData.size();
+    Util::uint64_t numObjects = ioObjects.size();
+    ioData.resize( start + ( numObjects + 1 ) * 8 );
+    memcpy( &ioData[start], &numObjects, 8 );
+
+    for ( std::size_t i = 0; i < ioObjects.size(); ++i )
+    {
+        Util::uint64_t offset = ioData.size() - start;
+        memcpy( &ioData[start + ( i + 1 ) * 8], &offset, 8 );
+
+        const Util::uint8_t * pos = ( const Util::uint8_t * )
+            &( ioObjects[i].second );
+        ioData.insert( ioData.end(), pos, pos + 8 );
+
+        const AbcA::ObjectHeader & header = *( ioObjects[i].first );
+        WriteObjectHeader( ioData, AbcA::ObjectHeader( header.getFullName(),
+            header.getFullName(), header.getMetaData() ), iMap );
+    }
+}
+
 //-*****************************************************************************
 void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
                     Util::uint32_t  iMaxSample,
@@ -59,6 +59,23 @@ void HashDimensions( const AbcA::Dimensions & iDims,
 WrittenSampleMap& GetWrittenSampleMap(
     AbcA::ArchiveWriterPtr iArchive );
 
+//-*****************************************************************************
+// Lets the archive know that it needs to be written with a file version
+// which supports encoded samples.
+void SetHasEncodedSamples( AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// Lets the archive know that some of its sample digests were computed with
+// AbcA::kChunkedMurmur3Digest, so that it can be recorded in the metadata.
+void SetHasChunkedDigests( AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// Raises the max number of samples for the time sampling to iNumSamples,
+// if it is smaller.
+void UpdateMaxNumSamples( AbcA::ArchiveWriterPtr iArchive,
+                          Util::uint32_t iIndex,
+                          index_t iNumSamples );
+
 //-*****************************************************************************
 void
 WriteDimensions( Ogawa::OGroupPtr iGroup,
@@ -68,14 +85,30 @@ WriteDimensions( Ogawa::OGroupPtr iGroup,
 //-*****************************************************************************
 void
 CopyWrittenData( Ogawa::OGroupPtr iParent,
-                 WrittenSampleIDPtr iRef );
+                 const WrittenSampleID & iRef );
 
 //-*****************************************************************************
-WrittenSampleIDPtr
+// A compression hint of -1 writes the data as is, 0 to 9 writes it with the
+// encoded sample header described in Compression.h
+WrittenSampleID
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           Util::int8_t iCompressionHint = -1 );
+
+//-*****************************************************************************
+// Like WriteData, but for a sample copied as is from another Ogawa archive.
+// iData is the stored key and sample, iKey is the key WriteData would have
+// been given.
+WrittenSampleID
+CopyRawData( WrittenSampleMap &iMap,
+             Ogawa::OGroupPtr iGroup,
+             Ogawa::IDataPtr iData,
+             std::size_t iThreadId,
+             const AbcA::ArraySample::Key &iKey,
+             bool iIsEncoded,
+             std::size_t iNumPoints );
 
 //-*****************************************************************************
 void
@@ -83,6 +116,7 @@ WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                    const AbcA::PropertyHeader &iHeader,
                    bool isScalarLike,
                    bool isHomogenous,
+                   bool isEncoded,
                    Util::uint32_t iTimeSamplingIndex,
                    Util::uint32_t iNumSamples,
                    Util::uint32_t iFirstChangedIndex,
@@ -95,6 +129,17 @@ WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
                    const AbcA::ObjectHeader &iHeader,
                    MetaDataMapPtr iMap );
 
+//-*****************************************************************************
+// Writes the number of objects, the offset of each object's entry from the
+// start of the index, and then the entries sorted by full name.  Each entry
+// is the position of the object's group, followed by its header written
+// like WriteObjectHeader but with its full name instead of its name.
+void
+WriteHierarchyIndex( std::vector< Util::uint8_t > & ioData,
+                     std::vector< std::pair< ObjectHeaderPtr,
+                                             Util::uint64_t > > & ioObjects,
+                     MetaDataMapPtr iMap );
+
 //-*****************************************************************************
 void
 WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
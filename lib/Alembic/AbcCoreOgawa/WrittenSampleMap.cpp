@@ -0,0 +1,259 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// the smallest table a shard uses, always a power of 2
+const std::size_t MIN_SLOTS = 64;
+
+inline std::size_t slotIndex( const AbcA::ArraySample::Key &iKey,
+                              std::size_t iNumSlots )
+{
+    return iKey.digest.words[0] & ( iNumSlots - 1 );
+}
+
+}
+
+//-*****************************************************************************
+WrittenSampleMap::WrittenSampleMap()
+{
+}
+
+//-*****************************************************************************
+bool WrittenSampleMap::find( const AbcA::ArraySample::Key &iKey,
+                             WrittenSampleID & oID ) const
+{
+    const Shard & shard = m_shards[ getShardIndex( iKey ) ];
+    Alembic::Util::scoped_lock l( shard.lock );
+    const Slot * slot = shard.find( iKey );
+    if ( slot )
+    {
+        oID = slot->get();
+        return true;
+    }
+    return false;
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::store( const WrittenSampleID & iID )
+{
+    Shard & shard = m_shards[ getShardIndex( iID.getKey() ) ];
+    Alembic::Util::scoped_lock l( shard.lock );
+    shard.store( iID );
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::clear()
+{
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        std::vector< Slot > empty;
+        m_shards[i].slots.swap( empty );
+        m_shards[i].numUsed = 0;
+    }
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::setMaxBytes( std::size_t iMaxBytes )
+{
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        m_shards[i].maxSlots = iMaxBytes / NUM_SHARDS / sizeof( Slot );
+    }
+}
+
+//-*****************************************************************************
+std::size_t WrittenSampleMap::getBytes() const
+{
+    std::size_t bytes = 0;
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        bytes += m_shards[i].slots.capacity() * sizeof( Slot );
+    }
+    return bytes;
+}
+
+//-*****************************************************************************
+std::size_t WrittenSampleMap::getNumSamples() const
+{
+    std::size_t numSamples = 0;
+    for ( std::size_t i = 0; i < NUM_SHARDS; ++i )
+    {
+        Alembic::Util::scoped_lock l( m_shards[i].lock );
+        numSamples += m_shards[i].numUsed;
+    }
+    return numSamples;
+}
+
+//-*****************************************************************************
+bool WrittenSampleMap::Slot::matches(
+    const AbcA::ArraySample::Key &iKey ) const
+{
+    return digest == iKey.digest && numBytes == iKey.numBytes &&
+        origPOD == iKey.origPOD && readPOD == iKey.readPOD;
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::Slot::set( const WrittenSampleID & iID )
+{
+    const AbcA::ArraySample::Key & key = iID.getKey();
+    digest = key.digest;
+    numBytes = key.numBytes;
+    origPOD = ( Util::uint8_t ) key.origPOD;
+    readPOD = ( Util::uint8_t ) key.readPOD;
+    pos = iID.getPos();
+    numPoints = iID.getNumPoints();
+    isEncoded = iID.isEncoded();
+    isKeyOnly = iID.isKeyOnly();
+}
+
+//-*****************************************************************************
+WrittenSampleID WrittenSampleMap::Slot::get() const
+{
+    AbcA::ArraySample::Key key;
+    key.digest = digest;
+    key.numBytes = numBytes;
+    key.origPOD = ( Util::PlainOldDataType ) origPOD;
+    key.readPOD = ( Util::PlainOldDataType ) readPOD;
+    return WrittenSampleID( key, pos, numPoints, isEncoded, isKeyOnly );
+}
+
+//-*****************************************************************************
+const WrittenSampleMap::Slot *
+WrittenSampleMap::Shard::find( const AbcA::ArraySample::Key &iKey ) const
+{
+    std::size_t numSlots = slots.size();
+    if ( numSlots == 0 )
+    {
+        return NULL;
+    }
+
+    // the table is never more than 3/4 full, so this always ends
+    for ( std::size_t i = slotIndex( iKey, numSlots ); ;
+          i = ( i + 1 ) & ( numSlots - 1 ) )
+    {
+        const Slot & slot = slots[i];
+        if ( slot.age == 0 )
+        {
+            return NULL;
+        }
+        else if ( slot.matches( iKey ) )
+        {
+            return &slot;
+        }
+    }
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::Shard::store( const WrittenSampleID & iID )
+{
+    Slot * found = const_cast< Slot * >( find( iID.getKey() ) );
+    if ( found )
+    {
+        found->set( iID );
+        found->age = nextAge++;
+        return;
+    }
+
+    if ( slots.empty() )
+    {
+        rehash( MIN_SLOTS, 0 );
+    }
+    else if ( ( numUsed + 1 ) * 4 > slots.size() * 3 )
+    {
+        // at our limit, so forget the older half instead of growing
+        if ( maxSlots != 0 && slots.size() * 2 > maxSlots )
+        {
+            rehash( slots.size(), nextAge - numUsed / 2 );
+        }
+        else
+        {
+            rehash( slots.size() * 2, 0 );
+        }
+    }
+
+    std::size_t numSlots = slots.size();
+    std::size_t i = slotIndex( iID.getKey(), numSlots );
+    while ( slots[i].age != 0 )
+    {
+        i = ( i + 1 ) & ( numSlots - 1 );
+    }
+
+    slots[i].set( iID );
+    slots[i].age = nextAge++;
+    numUsed++;
+}
+
+//-*****************************************************************************
+void WrittenSampleMap::Shard::rehash( std::size_t iNumSlots,
+                                      Util::uint64_t iMinAge )
+{
+    std::vector< Slot > oldSlots( iNumSlots );
+    oldSlots.swap( slots );
+    numUsed = 0;
+
+    for ( std::size_t j = 0; j < oldSlots.size(); ++j )
+    {
+        const Slot & old = oldSlots[j];
+
+        // the empty samples the archive starts with are always kept
+        if ( old.age == 0 ||
+             ( old.age < iMinAge && old.pos != 0 ) )
+        {
+            continue;
+        }
+
+        std::size_t i = old.digest.words[0] & ( iNumSlots - 1 );
+        while ( slots[i].age != 0 )
+        {
+            i = ( i + 1 ) & ( iNumSlots - 1 );
+        }
+        slots[i] = old;
+        numUsed++;
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
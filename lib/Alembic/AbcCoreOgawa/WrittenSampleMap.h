@@ -51,7 +51,8 @@ namespace ALEMBIC_VERSION_NS {
 // It also contains the Key of the sample, so it may be verified.
 //
 // This object is used to "reuse" an already written sample by linking
-// it from the previous usage.
+// it from the previous usage.  It is a small value, so that the map of
+// every sample written to the archive doesn't need an allocation per sample.
 //-*****************************************************************************
 class WrittenSampleID
 {
@@ -61,75 +62,135 @@ public:
         m_sampleKey.numBytes = 0;
         m_sampleKey.origPOD = Alembic::Util::kInt8POD;
         m_sampleKey.readPOD = Alembic::Util::kInt8POD;
+        m_pos = 0;
         m_numPoints = 0;
+        m_isEncoded = false;
+        m_isKeyOnly = true;
     }
 
+    // iPos is that of the Ogawa data the sample was written to, a position
+    // of 0 is the empty data
     WrittenSampleID( const AbcA::ArraySample::Key &iKey,
-                     Ogawa::ODataPtr iData,
-                     std::size_t iNumPoints )
-      : m_sampleKey( iKey ), m_data( iData ), m_numPoints( iNumPoints )
+                     Util::uint64_t iPos,
+                     std::size_t iNumPoints,
+                     bool iIsEncoded,
+                     bool iIsKeyOnly )
+      : m_sampleKey( iKey ), m_pos( iPos ), m_numPoints( iNumPoints )
+      , m_isEncoded( iIsEncoded ), m_isKeyOnly( iIsKeyOnly )
     {
     }
 
     const AbcA::ArraySample::Key &getKey() const { return m_sampleKey; }
 
-    Ogawa::ODataPtr getObjectLocation() const { return m_data; }
+    Util::uint64_t getPos() const { return m_pos; }
 
-    std::size_t getNumPoints() { return m_numPoints; }
+    std::size_t getNumPoints() const { return m_numPoints; }
+
+    // whether the data was written with the encoded sample header
+    bool isEncoded() const { return m_isEncoded; }
+
+    // whether nothing but the key was written, which reads the same
+    // whether it was encoded or not
+    bool isKeyOnly() const { return m_isKeyOnly; }
 
 private:
     AbcA::ArraySample::Key m_sampleKey;
-    Ogawa::ODataPtr m_data;
+    Util::uint64_t m_pos;
     std::size_t m_numPoints;
+    bool m_isEncoded;
+    bool m_isKeyOnly;
 };
 
-//-*****************************************************************************
-typedef Alembic::Util::shared_ptr<WrittenSampleID> WrittenSampleIDPtr;
-
 //-*****************************************************************************
 // This class handles the mapping.
+// It is shared by every property of the archive, which may be written from
+// different threads, so the keys are spread over a number of separately
+// locked shards to keep those threads from waiting on each other.
+// Each shard is a flat, open addressing hash table keyed on the digest.
+// If a memory limit is set, the oldest half of a shard is forgotten whenever
+// it would otherwise grow past its share of the limit, later copies of those
+// samples are then written again instead of being shared.
 class WrittenSampleMap
 {
 protected:
     friend class AwImpl;
 
-    WrittenSampleMap() {}
+    WrittenSampleMap();
 
 public:
 
-    // Returns 0 if it can't find it
-    WrittenSampleIDPtr find( const AbcA::ArraySample::Key &key ) const
-    {
-        Map::const_iterator miter = m_map.find( key );
-        if ( miter != m_map.end() )
-        {
-            return (*miter).second;
-        }
-        else
-        {
-            return WrittenSampleIDPtr();
-        }
-    }
+    // Returns false if it can't find it
+    bool find( const AbcA::ArraySample::Key &iKey,
+               WrittenSampleID & oID ) const;
 
     // Store. Will clobber if you've already stored it.
-    void store( WrittenSampleIDPtr r )
+    void store( const WrittenSampleID & iID );
+
+    void clear();
+
+    // 0 means no limit
+    void setMaxBytes( std::size_t iMaxBytes );
+
+    // the memory used by the tables of all the shards
+    std::size_t getBytes() const;
+
+    std::size_t getNumSamples() const;
+
+protected:
+    // what a WrittenSampleID needs, packed down to 56 bytes
+    struct Slot
     {
-        if ( !r )
-        {
-            ABCA_THROW( "Invalid WrittenSampleIDPtr" );
-        }
+        Slot() : age( 0 ) {}
 
-        m_map[r->getKey()] = r;
-    }
+        bool matches( const AbcA::ArraySample::Key &iKey ) const;
+        void set( const WrittenSampleID & iID );
+        WrittenSampleID get() const;
 
-    void clear()
+        Util::Digest digest;
+        Util::uint64_t numBytes;
+        Util::uint64_t pos;
+        Util::uint64_t numPoints;
+
+        // when this was stored, 0 for an unused slot
+        Util::uint64_t age;
+
+        Util::uint8_t origPOD;
+        Util::uint8_t readPOD;
+
+        bool isEncoded;
+        bool isKeyOnly;
+    };
+
+    class Shard
+    {
+    public:
+        Shard() : numUsed( 0 ), nextAge( 1 ), maxSlots( 0 ) {}
+
+        const Slot * find( const AbcA::ArraySample::Key &iKey ) const;
+        void store( const WrittenSampleID & iID );
+
+        // copies the newer slots into a table of iNumSlots slots
+        void rehash( std::size_t iNumSlots, Util::uint64_t iMinAge );
+
+        mutable Alembic::Util::mutex lock;
+        std::vector< Slot > slots;
+        std::size_t numUsed;
+        Util::uint64_t nextAge;
+
+        // 0 for no limit
+        std::size_t maxSlots;
+    };
+
+    static const std::size_t NUM_SHARDS = 16;
+
+    // the digest is already well mixed, so different bits of it pick
+    // the shard and the slot
+    static std::size_t getShardIndex( const AbcA::ArraySample::Key &iKey )
     {
-        m_map.clear();
+        return iKey.digest.words[1] % NUM_SHARDS;
     }
 
-protected:
-    typedef AbcA::UnorderedMapUtil<WrittenSampleIDPtr>::umap_type Map;
-    Map m_map;
+    Shard m_shards[NUM_SHARDS];
 };
 
 } // End namespace ALEMBIC_VERSION_NS
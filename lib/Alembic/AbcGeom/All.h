@@ -54,6 +54,7 @@
 
 #include <Alembic/AbcGeom/OGeomParam.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
+#include <Alembic/AbcGeom/IArraySampleReuser.h>
 
 #include <Alembic/AbcGeom/FilmBackXformOp.h>
 #include <Alembic/AbcGeom/CameraSample.h>
@@ -79,6 +80,8 @@
 #include <Alembic/AbcGeom/XformSample.h>
 #include <Alembic/AbcGeom/OXform.h>
 #include <Alembic/AbcGeom/IXform.h>
+#include <Alembic/AbcGeom/XformHierarchy.h>
+#include <Alembic/AbcGeom/BoundsHierarchy.h>
 
 #include <Alembic/AbcGeom/Visibility.h>
 
@@ -0,0 +1,541 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/BoundsHierarchy.h>
+#include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/Util/ThreadPool.h>
+
+#include <Imath/ImathBoxAlgo.h>
+
+#include <algorithm>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || \
+    ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ALEMBIC_ABCGEOM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+const std::size_t BoundsHierarchy::NO_OBJECT = std::size_t( -1 );
+
+namespace {
+
+// how many objects each task works out the bounds of, enough that handing
+// them out is cheap compared to reading them
+const std::size_t OBJECTS_PER_TASK = 16;
+
+//-*****************************************************************************
+bool IsBoxProperty( const AbcA::PropertyHeader * iHeader )
+{
+    return iHeader && iHeader->isScalar() &&
+        iHeader->getDataType().getPod() == Util::kFloat64POD &&
+        iHeader->getDataType().getExtent() == 6;
+}
+
+//-*****************************************************************************
+bool IsPointsProperty( const AbcA::PropertyHeader * iHeader )
+{
+    return iHeader && iHeader->isArray() &&
+        ( iHeader->getDataType().getPod() == Util::kFloat32POD ||
+          iHeader->getDataType().getPod() == Util::kFloat64POD ) &&
+        iHeader->getDataType().getExtent() == 3;
+}
+
+//-*****************************************************************************
+// a box reads the same as its 6 doubles, min then max
+Abc::Box3d ReadBox( const AbcA::ScalarPropertyReaderPtr & iProp,
+                    const Abc::ISampleSelector & iSS )
+{
+    Abc::Box3d ret;
+    ret.makeEmpty();
+
+    std::size_t numSamples = iProp->getNumSamples();
+    if ( numSamples > 0 )
+    {
+        iProp->getSample( iSS.getIndex( iProp->getTimeSampling(),
+                                        numSamples ), &ret );
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+template < class T >
+Abc::Box3d ComputeScalarPointBounds( const T * iPoints, std::size_t iBegin,
+                                     std::size_t iEnd, T * ioMin, T * ioMax )
+{
+    for ( std::size_t i = iBegin; i < iEnd; ++i )
+    {
+        const T * p = iPoints + 3 * i;
+        for ( std::size_t j = 0; j < 3; ++j )
+        {
+            ioMin[j] = std::min( ioMin[j], p[j] );
+            ioMax[j] = std::max( ioMax[j], p[j] );
+        }
+    }
+
+    return Abc::Box3d( Abc::V3d( ioMin[0], ioMin[1], ioMin[2] ),
+                       Abc::V3d( ioMax[0], ioMax[1], ioMax[2] ) );
+}
+
+}
+
+//-*****************************************************************************
+Abc::Box3d ComputePointBounds( const float * iPoints, std::size_t iNumPoints )
+{
+    if ( iNumPoints == 0 )
+    {
+        Abc::Box3d ret;
+        ret.makeEmpty();
+        return ret;
+    }
+
+    float minP[3] = { iPoints[0], iPoints[1], iPoints[2] };
+    float maxP[3] = { iPoints[0], iPoints[1], iPoints[2] };
+    std::size_t i = 1;
+
+#ifdef ALEMBIC_ABCGEOM_SSE2
+    if ( iNumPoints >= 8 )
+    {
+        // 4 points fill 3 registers, the lanes of which hold
+        // x y z x, y z x y and z x y z
+        __m128 minA = _mm_loadu_ps( iPoints );
+        __m128 minB = _mm_loadu_ps( iPoints + 4 );
+        __m128 minC = _mm_loadu_ps( iPoints + 8 );
+        __m128 maxA = minA;
+        __m128 maxB = minB;
+        __m128 maxC = minC;
+
+        for ( i = 4; i + 4 <= iNumPoints; i += 4 )
+        {
+            const float * p = iPoints + 3 * i;
+            __m128 a = _mm_loadu_ps( p );
+            __m128 b = _mm_loadu_ps( p + 4 );
+            __m128 c = _mm_loadu_ps( p + 8 );
+            minA = _mm_min_ps( minA, a );
+            minB = _mm_min_ps( minB, b );
+            minC = _mm_min_ps( minC, c );
+            maxA = _mm_max_ps( maxA, a );
+            maxB = _mm_max_ps( maxB, b );
+            maxC = _mm_max_ps( maxC, c );
+        }
+
+        float lanes[12];
+        _mm_storeu_ps( lanes, minA );
+        _mm_storeu_ps( lanes + 4, minB );
+        _mm_storeu_ps( lanes + 8, minC );
+        for ( std::size_t j = 0; j < 12; ++j )
+        {
+            minP[j % 3] = std::min( minP[j % 3], lanes[j] );
+        }
+
+        _mm_storeu_ps( lanes, maxA );
+        _mm_storeu_ps( lanes + 4, maxB );
+        _mm_storeu_ps( lanes + 8, maxC );
+        for ( std::size_t j = 0; j < 12; ++j )
+        {
+            maxP[j % 3] = std::max( maxP[j % 3], lanes[j] );
+        }
+    }
+#endif
+
+    return ComputeScalarPointBounds( iPoints, i, iNumPoints, minP, maxP );
+}
+
+//-*****************************************************************************
+Abc::Box3d ComputePointBounds( const double * iPoints, std::size_t iNumPoints )
+{
+    if ( iNumPoints == 0 )
+    {
+        Abc::Box3d ret;
+        ret.makeEmpty();
+        return ret;
+    }
+
+    double minP[3] = { iPoints[0], iPoints[1], iPoints[2] };
+    double maxP[3] = { iPoints[0], iPoints[1], iPoints[2] };
+    return ComputeScalarPointBounds( iPoints, 1, iNumPoints, minP, maxP );
+}
+
+//-*****************************************************************************
+BoundsHierarchy::BoundsHierarchy( Abc::IArchive iArchive,
+                                  bool iUseChildBounds,
+                                  std::size_t iMaxCachedTimes )
+    : m_archive( iArchive )
+    , m_useChildBounds( iUseChildBounds )
+    , m_xforms( iArchive, iMaxCachedTimes )
+    , m_constantRead( false )
+    , m_maxCachedTimes( iMaxCachedTimes )
+{
+    Abc::IObject top = m_archive.getTop();
+    AbcA::CompoundPropertyReaderPtr topProps = top.getProperties().getPtr();
+    if ( m_useChildBounds &&
+         IsBoxProperty( topProps->getPropertyHeader( ".childBnds" ) ) )
+    {
+        m_archiveBounds = topProps->getScalarProperty( ".childBnds" );
+    }
+
+    addObjects( top, NO_OBJECT, XformHierarchy::NO_XFORM, false );
+    m_constantLocal.resize( m_constantObjects.size() );
+}
+
+//-*****************************************************************************
+BoundsHierarchy::~BoundsHierarchy()
+{
+}
+
+//-*****************************************************************************
+void BoundsHierarchy::addObjects( Abc::IObject iObject, std::size_t iParent,
+                                  std::size_t iXform, bool iUnderStored )
+{
+    std::size_t numChildren = iObject.getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        Abc::IObject child = iObject.getChild( i );
+
+        Object o;
+        o.fullName = child.getFullName();
+        o.parent = iParent;
+        o.end = 0;
+        o.xform = iXform;
+        o.constantIndex = NO_OBJECT;
+
+        // the properties of an xform are in .xform, and those of the
+        // geometry with bounds in .geom
+        bool isXform = IXform::matches( child.getHeader() );
+        bool isGeom = IGeomBase::matches( child.getMetaData() );
+        if ( isXform )
+        {
+            o.xform = m_xforms.find( o.fullName );
+        }
+
+        AbcA::CompoundPropertyReaderPtr props = child.getProperties().getPtr();
+        const AbcA::PropertyHeader * schemaHeader =
+            props->getPropertyHeader( isXform ? ".xform" : ".geom" );
+        AbcA::CompoundPropertyReaderPtr schema;
+        if ( schemaHeader && schemaHeader->isCompound() &&
+             ( isXform || isGeom ) && !iUnderStored )
+        {
+            schema = props->getCompoundProperty( schemaHeader->getName() );
+        }
+
+        if ( schema && isGeom )
+        {
+            if ( IsBoxProperty( schema->getPropertyHeader( ".selfBnds" ) ) )
+            {
+                o.selfBounds = schema->getScalarProperty( ".selfBnds" );
+            }
+
+            if ( IsPointsProperty( schema->getPropertyHeader( "P" ) ) )
+            {
+                o.positions = schema->getArrayProperty( "P" );
+            }
+
+            // P is only read when the bounds weren't written
+            if ( o.selfBounds )
+            {
+                o.positions.reset();
+            }
+
+            if ( o.selfBounds || o.positions )
+            {
+                bool isConstant = o.selfBounds ? o.selfBounds->isConstant() :
+                    o.positions->isConstant();
+                if ( isConstant )
+                {
+                    o.constantIndex = m_constantObjects.size();
+                    m_constantObjects.push_back( m_objects.size() );
+                }
+                m_selfObjects.push_back( m_objects.size() );
+            }
+        }
+
+        bool underStored = iUnderStored;
+        if ( schema && m_useChildBounds &&
+             IsBoxProperty( schema->getPropertyHeader( ".childBnds" ) ) )
+        {
+            o.childBounds = schema->getScalarProperty( ".childBnds" );
+            m_storedObjects.push_back( m_objects.size() );
+            underStored = true;
+        }
+
+        std::size_t index = m_objects.size();
+        m_names[o.fullName] = index;
+        m_objects.push_back( o );
+
+        addObjects( child, index, m_objects[index].xform, underStored );
+        m_objects[index].end = m_objects.size();
+    }
+}
+
+//-*****************************************************************************
+const std::string & BoundsHierarchy::getFullName( std::size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_objects.size(),
+                 "Invalid index in BoundsHierarchy::getFullName: " << iIndex );
+    return m_objects[iIndex].fullName;
+}
+
+//-*****************************************************************************
+std::size_t BoundsHierarchy::getParent( std::size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_objects.size(),
+                 "Invalid index in BoundsHierarchy::getParent: " << iIndex );
+    return m_objects[iIndex].parent;
+}
+
+//-*****************************************************************************
+std::size_t BoundsHierarchy::find( const std::string & iFullName ) const
+{
+    std::map< std::string, std::size_t >::const_iterator it =
+        m_names.find( iFullName );
+    if ( it == m_names.end() )
+    {
+        return NO_OBJECT;
+    }
+    return it->second;
+}
+
+//-*****************************************************************************
+Abc::Box3d BoundsHierarchy::readLocalBounds( const Object & iObject,
+    const Abc::ISampleSelector & iSS ) const
+{
+    if ( iObject.selfBounds )
+    {
+        return ReadBox( iObject.selfBounds, iSS );
+    }
+
+    Abc::Box3d ret;
+    ret.makeEmpty();
+
+    std::size_t numSamples = iObject.positions->getNumSamples();
+    if ( numSamples == 0 )
+    {
+        return ret;
+    }
+
+    AbcA::ArraySamplePtr points;
+    iObject.positions->getSample( iSS.getIndex(
+        iObject.positions->getTimeSampling(), numSamples ), points );
+    if ( points->getDataType().getPod() == Util::kFloat32POD )
+    {
+        ret = ComputePointBounds(
+            static_cast< const float * >( points->getData() ),
+            points->size() );
+    }
+    else
+    {
+        ret = ComputePointBounds(
+            static_cast< const double * >( points->getData() ),
+            points->size() );
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+void BoundsHierarchy::readConstantBounds()
+{
+    Alembic::Util::scoped_lock l( m_constantLock );
+    if ( m_constantRead )
+    {
+        return;
+    }
+
+    std::size_t numTasks = ( m_constantObjects.size() + OBJECTS_PER_TASK - 1 )
+        / OBJECTS_PER_TASK;
+    Util::ThreadPool::global().parallelFor( numTasks,
+        [this]( std::size_t iTask )
+        {
+            std::size_t end = std::min( m_constantObjects.size(),
+                                        ( iTask + 1 ) * OBJECTS_PER_TASK );
+            for ( std::size_t i = iTask * OBJECTS_PER_TASK; i < end; ++i )
+            {
+                m_constantLocal[i] = readLocalBounds(
+                    m_objects[m_constantObjects[i]], Abc::ISampleSelector() );
+            }
+        } );
+
+    m_constantRead = true;
+}
+
+//-*****************************************************************************
+BoundsHierarchySamplePtr
+BoundsHierarchy::get( const Abc::ISampleSelector & iSS )
+{
+    CacheKey key;
+    key.index = iSS.getRequestedIndex();
+    key.time = iSS.getRequestedTime();
+    key.timeIndexType = iSS.getRequestedTimeIndexType();
+
+    {
+        Alembic::Util::scoped_lock l( m_cacheLock );
+        for ( Cache::iterator it = m_cache.begin(); it != m_cache.end();
+              ++it )
+        {
+            if ( it->first == key )
+            {
+                m_cache.splice( m_cache.begin(), m_cache, it );
+                return m_cache.front().second;
+            }
+        }
+    }
+
+    readConstantBounds();
+    XformHierarchySamplePtr xforms = m_xforms.get( iSS );
+
+    Util::shared_ptr< BoundsHierarchySample > sample(
+        new BoundsHierarchySample() );
+    Abc::Box3d empty;
+    empty.makeEmpty();
+    sample->m_self.resize( m_objects.size(), empty );
+    sample->m_bounds.resize( m_objects.size(), empty );
+
+    // each object's own bounds, in world space
+    BoundsHierarchySample * samplePtr = sample.get();
+    std::size_t numTasks = ( m_selfObjects.size() + OBJECTS_PER_TASK - 1 ) /
+        OBJECTS_PER_TASK;
+    Util::ThreadPool::global().parallelFor( numTasks,
+        [this, &iSS, &xforms, samplePtr]( std::size_t iTask )
+        {
+            std::size_t end = std::min( m_selfObjects.size(),
+                                        ( iTask + 1 ) * OBJECTS_PER_TASK );
+            for ( std::size_t i = iTask * OBJECTS_PER_TASK; i < end; ++i )
+            {
+                const Object & o = m_objects[m_selfObjects[i]];
+                Abc::Box3d local = o.constantIndex == NO_OBJECT ?
+                    readLocalBounds( o, iSS ) :
+                    m_constantLocal[o.constantIndex];
+
+                if ( o.xform != XformHierarchy::NO_XFORM && !local.isEmpty() )
+                {
+                    local = Imath::transform( local,
+                        xforms->getWorldMatrix( o.xform ) );
+                }
+                samplePtr->m_self[m_selfObjects[i]] = local;
+            }
+        } );
+
+    // what was stored for everything below an object
+    for ( std::size_t i = 0; i < m_storedObjects.size(); ++i )
+    {
+        const Object & o = m_objects[m_storedObjects[i]];
+        Abc::Box3d bounds = ReadBox( o.childBounds, iSS );
+        if ( o.xform != XformHierarchy::NO_XFORM && !bounds.isEmpty() )
+        {
+            bounds = Imath::transform( bounds,
+                xforms->getWorldMatrix( o.xform ) );
+        }
+        sample->m_bounds[m_storedObjects[i]] = bounds;
+    }
+
+    // children come after their parents, so going backwards every object is
+    // done before it is added to its parent
+    for ( std::size_t i = m_objects.size(); i > 0; --i )
+    {
+        std::size_t index = i - 1;
+        Abc::Box3d & bounds = sample->m_bounds[index];
+        bounds.extendBy( sample->m_self[index] );
+
+        std::size_t parent = m_objects[index].parent;
+        if ( parent == NO_OBJECT )
+        {
+            sample->m_archiveBounds.extendBy( bounds );
+        }
+        else
+        {
+            sample->m_bounds[parent].extendBy( bounds );
+        }
+    }
+
+    if ( m_maxCachedTimes > 0 )
+    {
+        Alembic::Util::scoped_lock l( m_cacheLock );
+        m_cache.push_front( std::make_pair( key, sample ) );
+        while ( m_cache.size() > m_maxCachedTimes )
+        {
+            m_cache.pop_back();
+        }
+    }
+
+    return sample;
+}
+
+//-*****************************************************************************
+Abc::Box3d BoundsHierarchy::getArchiveBounds( const Abc::ISampleSelector & iSS )
+{
+    if ( m_archiveBounds && m_archiveBounds->getNumSamples() > 0 )
+    {
+        return ReadBox( m_archiveBounds, iSS );
+    }
+
+    return get( iSS )->getArchiveBounds();
+}
+
+//-*****************************************************************************
+void BoundsHierarchy::writeArchiveBounds( Abc::OArchive & iArchive,
+                                          Util::uint32_t iTimeSamplingIndex,
+                                          std::size_t iNumSamples )
+{
+    AbcA::TimeSamplingPtr ts = iArchive.getTimeSampling( iTimeSamplingIndex );
+    ABCA_ASSERT( ts, "Invalid time sampling index in "
+                 "BoundsHierarchy::writeArchiveBounds: "
+                 << iTimeSamplingIndex );
+
+    Abc::OBox3dProperty bounds = CreateOArchiveBounds( iArchive,
+                                                       iTimeSamplingIndex );
+    for ( std::size_t i = 0; i < iNumSamples; ++i )
+    {
+        bounds.set( getArchiveBounds(
+            Abc::ISampleSelector( ts->getSampleTime( i ) ) ) );
+    }
+}
+
+//-*****************************************************************************
+void BoundsHierarchy::clearCache()
+{
+    {
+        Alembic::Util::scoped_lock l( m_cacheLock );
+        m_cache.clear();
+    }
+    m_xforms.clearCache();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
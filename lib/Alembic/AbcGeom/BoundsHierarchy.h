@@ -0,0 +1,234 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_BoundsHierarchy_h
+#define Alembic_AbcGeom_BoundsHierarchy_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/XformHierarchy.h>
+
+#include <list>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The world space bounds of every object of a BoundsHierarchy at one time,
+//! in the same order as the hierarchy's objects.
+class ALEMBIC_EXPORT BoundsHierarchySample
+{
+public:
+    BoundsHierarchySample() { m_archiveBounds.makeEmpty(); }
+
+    std::size_t getNumObjects() const { return m_self.size(); }
+
+    //! The bounds of the object's own geometry, empty if it doesn't have
+    //! any, or if it is below an object whose stored child bounds were used.
+    const Abc::Box3d & getSelfBounds( std::size_t iIndex ) const
+    { return m_self[iIndex]; }
+
+    //! The bounds of the object and everything below it.
+    const Abc::Box3d & getBounds( std::size_t iIndex ) const
+    { return m_bounds[iIndex]; }
+
+    //! The bounds of everything in the archive.
+    const Abc::Box3d & getArchiveBounds() const { return m_archiveBounds; }
+
+private:
+    friend class BoundsHierarchy;
+
+    std::vector< Abc::Box3d > m_self;
+    std::vector< Abc::Box3d > m_bounds;
+    Abc::Box3d m_archiveBounds;
+};
+
+typedef Util::shared_ptr< const BoundsHierarchySample >
+    BoundsHierarchySamplePtr;
+
+//-*****************************************************************************
+//! The bounds of every object in an archive, and of everything below each
+//! of them, for when they weren't all written out.
+//! An object's own bounds come from its .selfBnds, or from its P when it
+//! doesn't have any.  They are worked out on the global thread pool, and
+//! the ones which never change are only read once.  Where an xform, or a
+//! piece of geometry, has .childBnds everything below it can be skipped.
+//! Like XformHierarchy, the last few times asked for are kept.
+//! It is safe to call get() from many threads at once.
+class ALEMBIC_EXPORT BoundsHierarchy : private Alembic::Util::noncopyable
+{
+public:
+    //! Returned by getParent and find when there isn't one.
+    static const std::size_t NO_OBJECT;
+
+    //! Walks the whole of iArchive, including instances.
+    //! If iUseChildBounds is false .childBnds are ignored, and the bounds
+    //! of every object are worked out.
+    //! iMaxCachedTimes is how many times get() remembers.
+    explicit BoundsHierarchy( Abc::IArchive iArchive,
+                              bool iUseChildBounds = true,
+                              std::size_t iMaxCachedTimes = 4 );
+
+    ~BoundsHierarchy();
+
+    //! The objects are in depth first order, so parents come before their
+    //! children, and the top object isn't included.
+    std::size_t getNumObjects() const { return m_objects.size(); }
+
+    const std::string & getFullName( std::size_t iIndex ) const;
+
+    std::size_t getParent( std::size_t iIndex ) const;
+
+    //! The object with this full name, or NO_OBJECT.
+    std::size_t find( const std::string & iFullName ) const;
+
+    //! Works out the bounds of every object at iSS.
+    BoundsHierarchySamplePtr get(
+        const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    //! The bounds of everything in the archive at iSS, which are read from
+    //! the top object's .childBnds when they were written, and used.
+    Abc::Box3d getArchiveBounds(
+        const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    //! Writes the bounds of everything in the archive at the first
+    //! iNumSamples times of iArchive's time sampling iTimeSamplingIndex
+    //! to iArchive's top object, where GetIArchiveBounds will find them.
+    //! Only the archive's bounds are written, not .selfBnds or .childBnds
+    //! for each object, since those have to go on the objects of a copy of
+    //! the whole archive.  A tool which makes such a copy, like
+    //! AbcStitcher, can get them in world space from get() as it writes
+    //! each object.
+    void writeArchiveBounds( Abc::OArchive & iArchive,
+                             Util::uint32_t iTimeSamplingIndex,
+                             std::size_t iNumSamples );
+
+    //! The world matrices the bounds are transformed by.
+    XformHierarchy & getXformHierarchy() { return m_xforms; }
+
+    //! Forgets the times get() has remembered, and those of the
+    //! XformHierarchy.
+    void clearCache();
+
+private:
+    struct Object
+    {
+        std::string fullName;
+        std::size_t parent;
+
+        // one past the last object below this one
+        std::size_t end;
+
+        // the xform whose world matrix applies to this object's space,
+        // the object itself for xforms
+        std::size_t xform;
+
+        AbcA::ScalarPropertyReaderPtr selfBounds;
+        AbcA::ArrayPropertyReaderPtr positions;
+        AbcA::ScalarPropertyReaderPtr childBounds;
+
+        // into m_constantLocal, or NO_OBJECT if its bounds can change
+        std::size_t constantIndex;
+    };
+
+    void addObjects( Abc::IObject iObject, std::size_t iParent,
+                     std::size_t iXform, bool iUnderStored );
+
+    // the bounds of an object's geometry in its own space
+    Abc::Box3d readLocalBounds( const Object & iObject,
+                                const Abc::ISampleSelector & iSS ) const;
+
+    void readConstantBounds();
+
+    Abc::IArchive m_archive;
+    bool m_useChildBounds;
+    XformHierarchy m_xforms;
+
+    std::vector< Object > m_objects;
+    std::map< std::string, std::size_t > m_names;
+
+    // objects whose own bounds are worked out, and whose .childBnds are used
+    std::vector< std::size_t > m_selfObjects;
+    std::vector< std::size_t > m_storedObjects;
+
+    // the local bounds of the objects which never change, read the first
+    // time they are needed
+    std::vector< std::size_t > m_constantObjects;
+    std::vector< Abc::Box3d > m_constantLocal;
+    bool m_constantRead;
+    Alembic::Util::mutex m_constantLock;
+
+    AbcA::ScalarPropertyReaderPtr m_archiveBounds;
+
+    struct CacheKey
+    {
+        index_t index;
+        chrono_t time;
+        Abc::ISampleSelector::TimeIndexType timeIndexType;
+
+        bool operator==( const CacheKey & iOther ) const
+        {
+            return index == iOther.index && time == iOther.time &&
+                timeIndexType == iOther.timeIndexType;
+        }
+    };
+
+    // most recently used at the front
+    typedef std::list< std::pair< CacheKey, BoundsHierarchySamplePtr > >
+        Cache;
+    Cache m_cache;
+    std::size_t m_maxCachedTimes;
+    Alembic::Util::mutex m_cacheLock;
+};
+
+typedef Util::shared_ptr< BoundsHierarchy > BoundsHierarchyPtr;
+
+//-*****************************************************************************
+//! The bounds of iNumPoints xyz points, which is empty if there aren't any.
+ALEMBIC_EXPORT Abc::Box3d
+ComputePointBounds( const float * iPoints, std::size_t iNumPoints );
+
+ALEMBIC_EXPORT Abc::Box3d
+ComputePointBounds( const double * iPoints, std::size_t iNumPoints );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
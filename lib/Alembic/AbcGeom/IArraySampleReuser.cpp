@@ -0,0 +1,101 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/IArraySampleReuser.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+void IArraySampleReuser::reset()
+{
+    m_property.reset();
+    m_sample.reset();
+    m_index = -1;
+    m_hasKey = false;
+}
+
+//-*****************************************************************************
+bool IArraySampleReuser::get( const Abc::IArrayProperty &iProp,
+                              AbcA::ArraySamplePtr &oSample,
+                              const Abc::ISampleSelector &iSS )
+{
+    AbcA::ArrayPropertyReaderPtr prop = iProp.getPtr();
+    if ( prop != m_property )
+    {
+        reset();
+        m_property = prop;
+    }
+
+    if ( !prop )
+    {
+        oSample.reset();
+        return false;
+    }
+
+    AbcA::index_t index = iSS.getIndex( prop->getTimeSampling(),
+                                        prop->getNumSamples() );
+
+    // same sample as last time, or every sample is the same
+    if ( m_sample && ( index == m_index || prop->isConstant() ) )
+    {
+        oSample = m_sample;
+        return false;
+    }
+
+    // a different sample, but it may still have been stored as the same
+    // data, which only costs reading its key to find out
+    Abc::ISampleSelector indexSS( index );
+    AbcA::ArraySampleKey key;
+    bool hasKey = iProp.getKey( key, indexSS );
+    if ( m_sample && hasKey && m_hasKey && key == m_key )
+    {
+        m_index = index;
+        oSample = m_sample;
+        return false;
+    }
+
+    iProp.get( m_sample, indexSS );
+    m_index = index;
+    m_key = key;
+    m_hasKey = hasKey;
+    oSample = m_sample;
+    return true;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,96 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_IArraySampleReuser_h
+#define Alembic_AbcGeom_IArraySampleReuser_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Reads samples of an array property one after another, and hands back
+//! the sample it read last instead of reading it again when the one asked
+//! for was stored as the same data, which is told apart by the stored
+//! sample keys.  This is what lets playback of a deforming mesh skip
+//! reading its topology on every frame.
+//! It remembers one sample, so use one per property, and one per thread.
+class ALEMBIC_EXPORT IArraySampleReuser
+{
+public:
+    IArraySampleReuser() { reset(); }
+
+    //! Gets the sample of iProp at iSS into oSample.  Returns true if the
+    //! sample was read, and false if the last one was handed back.
+    bool get( const Abc::IArrayProperty &iProp,
+              AbcA::ArraySamplePtr &oSample,
+              const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    template <class TRAITS>
+    bool get( const Abc::ITypedArrayProperty<TRAITS> &iProp,
+              Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> >
+              &oSample,
+              const Abc::ISampleSelector &iSS = Abc::ISampleSelector() )
+    {
+        AbcA::ArraySamplePtr ptr;
+        bool read = get( static_cast< const Abc::IArrayProperty & >( iProp ),
+                         ptr, iSS );
+        oSample = Alembic::Util::static_pointer_cast<
+            Abc::TypedArraySample<TRAITS>, AbcA::ArraySample >( ptr );
+        return read;
+    }
+
+    //! Forgets the last sample, so the next get reads.
+    void reset();
+
+private:
+    AbcA::ArrayPropertyReaderPtr m_property;
+    AbcA::ArraySamplePtr m_sample;
+    AbcA::index_t m_index;
+    AbcA::ArraySampleKey m_key;
+    bool m_hasKey;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
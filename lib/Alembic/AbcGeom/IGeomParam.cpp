@@ -0,0 +1,200 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/IGeomParam.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || \
+    ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ALEMBIC_ABCGEOM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// V2f and the like, two values are put together into one store
+void Expand8( const char * iVals, const Util::uint32_t * iIndices,
+              std::size_t iNumIndices, char * oExpanded )
+{
+    std::size_t i = 0;
+#ifdef ALEMBIC_ABCGEOM_SSE2
+    for ( ; i + 2 <= iNumIndices; i += 2 )
+    {
+        __m128i a = _mm_loadl_epi64(
+            reinterpret_cast< const __m128i * >( iVals + 8 * iIndices[i] ) );
+        __m128i b = _mm_loadl_epi64(
+            reinterpret_cast< const __m128i * >(
+                iVals + 8 * iIndices[i + 1] ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( oExpanded + 8 * i ),
+                          _mm_unpacklo_epi64( a, b ) );
+    }
+#endif
+    for ( ; i < iNumIndices; ++i )
+    {
+        std::memcpy( oExpanded + 8 * i, iVals + 8 * iIndices[i], 8 );
+    }
+}
+
+//-*****************************************************************************
+// V3f, N3f and the like.  All 16 bytes are copied, the last 4 of which are
+// written over by the next value, as long as that doesn't go past the end
+// of the values or of what they are expanded into.
+void Expand12( const char * iVals, std::size_t iNumVals,
+               const Util::uint32_t * iIndices, std::size_t iNumIndices,
+               char * oExpanded )
+{
+    std::size_t i = 0;
+#ifdef ALEMBIC_ABCGEOM_SSE2
+    for ( ; i + 1 < iNumIndices; ++i )
+    {
+        Util::uint32_t index = iIndices[i];
+        if ( index + 1 < iNumVals )
+        {
+            _mm_storeu_si128(
+                reinterpret_cast< __m128i * >( oExpanded + 12 * i ),
+                _mm_loadu_si128( reinterpret_cast< const __m128i * >(
+                    iVals + 12 * index ) ) );
+        }
+        else
+        {
+            std::memcpy( oExpanded + 12 * i, iVals + 12 * index, 12 );
+        }
+    }
+#endif
+    for ( ; i < iNumIndices; ++i )
+    {
+        std::memcpy( oExpanded + 12 * i, iVals + 12 * iIndices[i], 12 );
+    }
+}
+
+//-*****************************************************************************
+// C4f, V2d and the like
+void Expand16( const char * iVals, const Util::uint32_t * iIndices,
+               std::size_t iNumIndices, char * oExpanded )
+{
+#ifdef ALEMBIC_ABCGEOM_SSE2
+    for ( std::size_t i = 0; i < iNumIndices; ++i )
+    {
+        _mm_storeu_si128(
+            reinterpret_cast< __m128i * >( oExpanded + 16 * i ),
+            _mm_loadu_si128( reinterpret_cast< const __m128i * >(
+                iVals + 16 * iIndices[i] ) ) );
+    }
+#else
+    for ( std::size_t i = 0; i < iNumIndices; ++i )
+    {
+        std::memcpy( oExpanded + 16 * i, iVals + 16 * iIndices[i], 16 );
+    }
+#endif
+}
+
+//-*****************************************************************************
+template < class T >
+void ExpandPod( const T * iVals, const Util::uint32_t * iIndices,
+                std::size_t iNumIndices, T * oExpanded )
+{
+    for ( std::size_t i = 0; i < iNumIndices; ++i )
+    {
+        oExpanded[i] = iVals[iIndices[i]];
+    }
+}
+
+}
+
+//-*****************************************************************************
+void ExpandIndexedValues( const void * iVals, std::size_t iNumVals,
+                          std::size_t iValueBytes,
+                          const Util::uint32_t * iIndices,
+                          std::size_t iNumIndices, void * oExpanded )
+{
+    // checked up front, so that the copying can't read past the values
+    Util::uint32_t maxIndex = 0;
+    for ( std::size_t i = 0; i < iNumIndices; ++i )
+    {
+        maxIndex = std::max( maxIndex, iIndices[i] );
+    }
+
+    if ( iNumIndices > 0 && maxIndex >= iNumVals )
+    {
+        ABCA_THROW( "Index " << maxIndex << " is past the " << iNumVals <<
+                    " values being expanded." );
+    }
+
+    const char * vals = static_cast< const char * >( iVals );
+    char * expanded = static_cast< char * >( oExpanded );
+
+    switch ( iValueBytes )
+    {
+    case 1:
+        ExpandPod( static_cast< const Util::uint8_t * >( iVals ), iIndices,
+                   iNumIndices, static_cast< Util::uint8_t * >( oExpanded ) );
+        break;
+    case 2:
+        ExpandPod( static_cast< const Util::uint16_t * >( iVals ), iIndices,
+                   iNumIndices, static_cast< Util::uint16_t * >( oExpanded ) );
+        break;
+    case 4:
+        ExpandPod( static_cast< const Util::uint32_t * >( iVals ), iIndices,
+                   iNumIndices, static_cast< Util::uint32_t * >( oExpanded ) );
+        break;
+    case 8:
+        Expand8( vals, iIndices, iNumIndices, expanded );
+        break;
+    case 12:
+        Expand12( vals, iNumVals, iIndices, iNumIndices, expanded );
+        break;
+    case 16:
+        Expand16( vals, iIndices, iNumIndices, expanded );
+        break;
+    default:
+        for ( std::size_t i = 0; i < iNumIndices; ++i )
+        {
+            std::memcpy( expanded + iValueBytes * i,
+                         vals + iValueBytes * iIndices[i], iValueBytes );
+        }
+        break;
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
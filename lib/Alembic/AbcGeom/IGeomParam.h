@@ -44,6 +44,17 @@ namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! Copies value iIndices[i] of iVals into oExpanded[i], for each of the
+//! iNumIndices indices, where each value is iValueBytes long.
+//! The common sizes, like those of V2f, V3f and C4f, are copied with SIMD
+//! loads and stores.  Throws if any index is past iNumVals.
+ALEMBIC_EXPORT void
+ExpandIndexedValues( const void * iVals, std::size_t iNumVals,
+                     std::size_t iValueBytes,
+                     const Alembic::Util::uint32_t * iIndices,
+                     std::size_t iNumIndices, void * oExpanded );
+
 //-*****************************************************************************
 template <class TRAITS>
 class ITypedGeomParam
@@ -136,6 +147,19 @@ public:
     void getExpanded( sample_type &oSamp,
                       const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Expands the values into oExpanded, reusing whatever it has already
+    //! allocated.  Returns how many values there are.
+    std::size_t getExpanded( std::vector< value_type > &oExpanded,
+                             const Abc::ISampleSelector &iSS =
+                             Abc::ISampleSelector() ) const;
+
+    //! Like getIndexed, but when the values aren't indexed the indices are
+    //! left empty, instead of being filled with 0, 1, 2 and so on.
+    //! Check the sample's isIndexed() to tell which it is.
+    void getUnexpanded( sample_type &oSamp,
+                        const Abc::ISampleSelector &iSS =
+                        Abc::ISampleSelector() ) const;
+
     sample_type getIndexedValue( const Abc::ISampleSelector &iSS = \
                                  Abc::ISampleSelector() ) const
     {
@@ -152,6 +176,14 @@ public:
         return ret;
     }
 
+    sample_type getUnexpandedValue( const Abc::ISampleSelector &iSS =
+                                    Abc::ISampleSelector() ) const
+    {
+        sample_type ret;
+        getUnexpanded( ret, iSS );
+        return ret;
+    }
+
     size_t getNumSamples() const;
 
     AbcA::DataType getDataType() const { return TRAITS::dataType(); }
@@ -205,6 +237,11 @@ private:
     { return m_valProp.getErrorHandler(); }
 
 protected:
+    // strings can't be copied a byte at a time
+    static void expand( const Abc::TypedArraySample<TRAITS> &iVals,
+                        const Abc::UInt32ArraySample &iIndices,
+                        value_type *oExpanded );
+
     prop_type m_valProp;
 
     // if the GeomParam is not indexed, these will not exist.
@@ -377,9 +414,14 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
 
         typename TRAITS::value_type *v = new typename TRAITS::value_type[size];
 
-        for ( size_t i = 0 ; i < size ; ++i )
+        try
+        {
+            expand( *valPtr, *idxPtr, v );
+        }
+        catch ( ... )
         {
-            v[i] = (*valPtr)[ (*idxPtr)[i] ];
+            delete [] v;
+            throw;
         }
 
         // NOTE: we could create an ArraySampleKey and insert this into the
@@ -397,6 +439,74 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
 
 }
 
+//-*****************************************************************************
+template <class TRAITS>
+std::size_t
+ITypedGeomParam<TRAITS>::getExpanded(
+    std::vector< typename ITypedGeomParam<TRAITS>::value_type > &oExpanded,
+    const Abc::ISampleSelector &iSS ) const
+{
+    Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> > valPtr =
+        m_valProp.getValue( iSS );
+
+    Abc::UInt32ArraySamplePtr idxPtr;
+    if ( m_indicesProperty )
+    {
+        idxPtr = m_indicesProperty.getValue( iSS );
+    }
+
+    // no indices?  just copy what we have in our values
+    if ( ! idxPtr || idxPtr->size() == 0 )
+    {
+        oExpanded.assign( valPtr->get(), valPtr->get() + valPtr->size() );
+        return oExpanded.size();
+    }
+
+    oExpanded.resize( idxPtr->size() );
+    expand( *valPtr, *idxPtr, &oExpanded.front() );
+    return oExpanded.size();
+}
+
+//-*****************************************************************************
+template <class TRAITS>
+void
+ITypedGeomParam<TRAITS>::getUnexpanded(
+    typename ITypedGeomParam<TRAITS>::Sample &oSamp,
+    const Abc::ISampleSelector &iSS ) const
+{
+    m_valProp.get( oSamp.m_vals, iSS );
+    oSamp.m_indices.reset();
+    if ( m_indicesProperty ) { m_indicesProperty.get( oSamp.m_indices, iSS ); }
+
+    oSamp.m_scope = this->getScope();
+    oSamp.m_isIndexed = m_isIndexed;
+}
+
+//-*****************************************************************************
+template <class TRAITS>
+void ITypedGeomParam<TRAITS>::expand(
+    const Abc::TypedArraySample<TRAITS> &iVals,
+    const Abc::UInt32ArraySample &iIndices,
+    typename ITypedGeomParam<TRAITS>::value_type *oExpanded )
+{
+    Alembic::Util::PlainOldDataType pod = TRAITS::dataType().getPod();
+    if ( pod != Alembic::Util::kStringPOD &&
+         pod != Alembic::Util::kWstringPOD )
+    {
+        ExpandIndexedValues( iVals.get(), iVals.size(), sizeof( value_type ),
+                             iIndices.get(), iIndices.size(), oExpanded );
+        return;
+    }
+
+    for ( size_t i = 0 ; i < iIndices.size() ; ++i )
+    {
+        ABCA_ASSERT( iIndices[i] < iVals.size(),
+                     "Index " << iIndices[i] << " is past the " <<
+                     iVals.size() << " values being expanded." );
+        oExpanded[i] = iVals[ iIndices[i] ];
+    }
+}
+
 //-*****************************************************************************
 template <class TRAITS>
 size_t ITypedGeomParam<TRAITS>::getNumSamples() const
@@ -229,6 +229,39 @@ IPolyMeshSchema::getFaceSet ( const std::string &iFaceSetName )
 }
 
 
+//-*****************************************************************************
+void IPolyMeshReader::get( IPolyMeshSchema::Sample &oSample,
+                           const Abc::ISampleSelector &iSS )
+{
+    m_positionsChanged = m_positions.get(
+        m_schema.getPositionsProperty(), oSample.m_positions, iSS );
+
+    bool indicesChanged = m_indices.get(
+        m_schema.getFaceIndicesProperty(), oSample.m_indices, iSS );
+    bool countsChanged = m_counts.get(
+        m_schema.getFaceCountsProperty(), oSample.m_counts, iSS );
+    m_topologyChanged = indicesChanged || countsChanged;
+
+    m_schema.getSelfBoundsProperty().get( oSample.m_selfBounds, iSS );
+
+    Abc::IV3fArrayProperty velocities = m_schema.getVelocitiesProperty();
+    if ( velocities && velocities.getNumSamples() > 0 )
+    {
+        m_velocities.get( velocities, oSample.m_velocities, iSS );
+    }
+}
+
+//-*****************************************************************************
+void IPolyMeshReader::reset()
+{
+    m_positions.reset();
+    m_velocities.reset();
+    m_indices.reset();
+    m_counts.reset();
+    m_positionsChanged = false;
+    m_topologyChanged = false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
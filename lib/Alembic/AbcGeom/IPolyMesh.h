@@ -43,11 +43,14 @@
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/IArraySampleReuser.h>
 
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+class IPolyMeshReader;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT IPolyMeshSchema
     : public IGeomBaseSchema<PolyMeshSchemaInfo>
@@ -85,6 +88,7 @@ public:
 
     protected:
         friend class IPolyMeshSchema;
+        friend class IPolyMeshReader;
         Abc::P3fArraySamplePtr m_positions;
         Abc::V3fArraySamplePtr m_velocities;
         Abc::Int32ArraySamplePtr m_indices;
@@ -300,6 +304,52 @@ typedef Abc::ISchemaObject<IPolyMeshSchema> IPolyMesh;
 
 typedef Util::shared_ptr< IPolyMesh > IPolyMeshPtr;
 
+//-*****************************************************************************
+//! Reads samples of a mesh one after another, like during playback.
+//! Arrays that were stored as the same data as in the last sample read are
+//! handed back from it instead of being read again, so a deforming mesh
+//! only reads its positions, and a mesh whose topology only changes now
+//! and then only reads its indices and counts when they do.
+//! It remembers the last sample, so use one per thread.
+class ALEMBIC_EXPORT IPolyMeshReader
+{
+public:
+    IPolyMeshReader() : m_positionsChanged( false ),
+                        m_topologyChanged( false ) {}
+
+    explicit IPolyMeshReader( const IPolyMeshSchema &iSchema )
+      : m_schema( iSchema )
+      , m_positionsChanged( false )
+      , m_topologyChanged( false ) {}
+
+    //! Like IPolyMeshSchema::get, but reuses what it can of the last
+    //! sample read.
+    void get( IPolyMeshSchema::Sample &oSample,
+              const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! Whether the last get read positions that differ from the ones
+    //! before it.  The first get always does.
+    bool positionsChanged() const { return m_positionsChanged; }
+
+    //! Whether the last get read face indices or counts that differ from
+    //! the ones before it.  The first get always does.
+    bool topologyChanged() const { return m_topologyChanged; }
+
+    //! Forgets the last sample read.
+    void reset();
+
+private:
+    IPolyMeshSchema m_schema;
+
+    IArraySampleReuser m_positions;
+    IArraySampleReuser m_velocities;
+    IArraySampleReuser m_indices;
+    IArraySampleReuser m_counts;
+
+    bool m_positionsChanged;
+    bool m_topologyChanged;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
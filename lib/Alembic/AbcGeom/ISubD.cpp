@@ -399,6 +399,92 @@ ISubDSchema::getFaceSet( const std::string &iFaceSetName )
     return empty;
 }
 
+//-*****************************************************************************
+void ISubDReader::get( ISubDSchema::Sample &oSample,
+                       const Abc::ISampleSelector &iSS )
+{
+    m_positionsChanged = m_positions.get(
+        m_schema.getPositionsProperty(), oSample.m_positions, iSS );
+
+    bool indicesChanged = m_faceIndices.get(
+        m_schema.getFaceIndicesProperty(), oSample.m_faceIndices, iSS );
+    bool countsChanged = m_faceCounts.get(
+        m_schema.getFaceCountsProperty(), oSample.m_faceCounts, iSS );
+    m_topologyChanged = indicesChanged || countsChanged;
+
+    Abc::IInt32Property fvib =
+        m_schema.getFaceVaryingInterpolateBoundaryProperty();
+    oSample.m_faceVaryingInterpolateBoundary = fvib ? fvib.getValue( iSS ) : 0;
+
+    Abc::IInt32Property fvpc =
+        m_schema.getFaceVaryingPropagateCornersProperty();
+    oSample.m_faceVaryingPropagateCorners = fvpc ? fvpc.getValue( iSS ) : 0;
+
+    Abc::IInt32Property ib = m_schema.getInterpolateBoundaryProperty();
+    oSample.m_interpolateBoundary = ib ? ib.getValue( iSS ) : 0;
+
+    m_schema.getSelfBoundsProperty().get( oSample.m_selfBounds, iSS );
+
+    Abc::IInt32ArrayProperty creaseIndices =
+        m_schema.getCreaseIndicesProperty();
+    if ( creaseIndices )
+    { m_creaseIndices.get( creaseIndices, oSample.m_creaseIndices, iSS ); }
+
+    Abc::IInt32ArrayProperty creaseLengths =
+        m_schema.getCreaseLengthsProperty();
+    if ( creaseLengths )
+    { m_creaseLengths.get( creaseLengths, oSample.m_creaseLengths, iSS ); }
+
+    Abc::IFloatArrayProperty creaseSharpnesses =
+        m_schema.getCreaseSharpnessesProperty();
+    if ( creaseSharpnesses )
+    {
+        m_creaseSharpnesses.get( creaseSharpnesses,
+                                 oSample.m_creaseSharpnesses, iSS );
+    }
+
+    Abc::IInt32ArrayProperty cornerIndices =
+        m_schema.getCornerIndicesProperty();
+    if ( cornerIndices )
+    { m_cornerIndices.get( cornerIndices, oSample.m_cornerIndices, iSS ); }
+
+    Abc::IFloatArrayProperty cornerSharpnesses =
+        m_schema.getCornerSharpnessesProperty();
+    if ( cornerSharpnesses )
+    {
+        m_cornerSharpnesses.get( cornerSharpnesses,
+                                 oSample.m_cornerSharpnesses, iSS );
+    }
+
+    Abc::IInt32ArrayProperty holes = m_schema.getHolesProperty();
+    if ( holes ) { m_holes.get( holes, oSample.m_holes, iSS ); }
+
+    Abc::IStringProperty subdScheme = m_schema.getSubdivisionSchemeProperty();
+    oSample.m_subdScheme = subdScheme ? subdScheme.getValue( iSS ) :
+        std::string( "catmull-clark" );
+
+    Abc::IV3fArrayProperty velocities = m_schema.getVelocitiesProperty();
+    if ( velocities && velocities.getNumSamples() > 0 )
+    { m_velocities.get( velocities, oSample.m_velocities, iSS ); }
+}
+
+//-*****************************************************************************
+void ISubDReader::reset()
+{
+    m_positions.reset();
+    m_velocities.reset();
+    m_faceIndices.reset();
+    m_faceCounts.reset();
+    m_creaseIndices.reset();
+    m_creaseLengths.reset();
+    m_creaseSharpnesses.reset();
+    m_cornerIndices.reset();
+    m_cornerSharpnesses.reset();
+    m_holes.reset();
+    m_positionsChanged = false;
+    m_topologyChanged = false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
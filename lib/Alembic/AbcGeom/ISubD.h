@@ -43,11 +43,14 @@
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/IArraySampleReuser.h>
 
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+class ISubDReader;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT ISubDSchema : public IGeomBaseSchema<SubDSchemaInfo>
 {
@@ -141,6 +144,7 @@ public:
 
     protected:
         friend class ISubDSchema;
+        friend class ISubDReader;
 
         Abc::P3fArraySamplePtr m_positions;
         Abc::V3fArraySamplePtr m_velocities;
@@ -413,6 +417,56 @@ typedef Abc::ISchemaObject<ISubDSchema> ISubD;
 
 typedef Util::shared_ptr< ISubD > ISubDPtr;
 
+//-*****************************************************************************
+//! Reads samples of a subd one after another, like during playback.
+//! Arrays that were stored as the same data as in the last sample read are
+//! handed back from it instead of being read again, see IPolyMeshReader.
+//! It remembers the last sample, so use one per thread.
+class ALEMBIC_EXPORT ISubDReader
+{
+public:
+    ISubDReader() : m_positionsChanged( false ),
+                    m_topologyChanged( false ) {}
+
+    explicit ISubDReader( const ISubDSchema &iSchema )
+      : m_schema( iSchema )
+      , m_positionsChanged( false )
+      , m_topologyChanged( false ) {}
+
+    //! Like ISubDSchema::get, but reuses what it can of the last sample
+    //! read.
+    void get( ISubDSchema::Sample &oSample,
+              const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+    //! Whether the last get read positions that differ from the ones
+    //! before it.  The first get always does.
+    bool positionsChanged() const { return m_positionsChanged; }
+
+    //! Whether the last get read face indices or counts that differ from
+    //! the ones before it.  The first get always does.
+    bool topologyChanged() const { return m_topologyChanged; }
+
+    //! Forgets the last sample read.
+    void reset();
+
+private:
+    ISubDSchema m_schema;
+
+    IArraySampleReuser m_positions;
+    IArraySampleReuser m_velocities;
+    IArraySampleReuser m_faceIndices;
+    IArraySampleReuser m_faceCounts;
+    IArraySampleReuser m_creaseIndices;
+    IArraySampleReuser m_creaseLengths;
+    IArraySampleReuser m_creaseSharpnesses;
+    IArraySampleReuser m_cornerIndices;
+    IArraySampleReuser m_cornerSharpnesses;
+    IArraySampleReuser m_holes;
+
+    bool m_positionsChanged;
+    bool m_topologyChanged;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -41,6 +41,13 @@ namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// the most channels OXformSchema writes into a scalar .vals
+const std::size_t MAX_SCALAR_CHANS = 256;
+
+}
+
 //-*****************************************************************************
 void IXformSchema::init( const Abc::Argument &iArg0,
                          const Abc::Argument &iArg1 )
@@ -66,6 +73,7 @@ void IXformSchema::init( const Abc::Argument &iArg0,
     }
 
     m_useArrayProp = false;
+    m_valsAreConstant = false;
 
     const AbcA::PropertyHeader *valsPH = ptr->getPropertyHeader( ".vals" );
     if ( valsPH != NULL )
@@ -90,15 +98,25 @@ void IXformSchema::init( const Abc::Argument &iArg0,
     }
 
     m_isConstant = true;
+    bool valsHaveSamples = false;
 
     if ( m_valsProperty )
     {
 
         if ( m_useArrayProp )
-        { m_isConstant = m_valsProperty->asArrayPtr()->isConstant(); }
+        {
+            m_isConstant = m_valsProperty->asArrayPtr()->isConstant();
+            valsHaveSamples =
+                m_valsProperty->asArrayPtr()->getNumSamples() > 0;
+        }
         else
-        { m_isConstant = m_valsProperty->asScalarPtr()->isConstant(); }
+        {
+            m_isConstant = m_valsProperty->asScalarPtr()->isConstant();
+            valsHaveSamples =
+                m_valsProperty->asScalarPtr()->getNumSamples() > 0;
+        }
     }
+    bool valsAreConstant = m_isConstant && valsHaveSamples;
 
     m_isConstant = m_isConstant && ( !m_inheritsProperty ||
         m_inheritsProperty.isConstant() );
@@ -156,7 +174,8 @@ void IXformSchema::init( const Abc::Argument &iArg0,
                 {
                     if ( animChan == chanPos )
                     {
-                        op->m_animChannels.insert( curChan );
+                        op->m_animChannels |=
+                            ( Alembic::Util::uint16_t )( 1 << curChan );
                         foundChan = true;
                         break;
                     }
@@ -179,6 +198,13 @@ void IXformSchema::init( const Abc::Argument &iArg0,
         }
     }
 
+    // the values can't change, so get doesn't need to read them each time
+    if ( valsAreConstant )
+    {
+        getChannelValues( 0, m_sample );
+        m_valsAreConstant = true;
+    }
+
     if ( ptr->getPropertyHeader( ".arbGeomParams" ) != NULL )
     {
         m_arbGeomParams = Abc::ICompoundProperty( ptr, ".arbGeomParams",
@@ -235,22 +261,34 @@ std::size_t IXformSchema::getNumSamples() const
 void IXformSchema::getChannelValues( const AbcA::index_t iSampleIndex,
     XformSample & oSamp ) const
 {
-    std::vector<Alembic::Util::float64_t> dataVec;
+    // scalar values small enough are read onto the stack, so that nothing
+    // is allocated
+    Alembic::Util::float64_t scalarData[MAX_SCALAR_CHANS];
+    std::vector<Alembic::Util::float64_t> bigScalarData;
+    AbcA::ArraySamplePtr sptr;
+
+    const Alembic::Util::float64_t * data = NULL;
+    std::size_t dataSize = 0;
 
     if ( m_useArrayProp )
     {
-        AbcA::ArraySamplePtr sptr;
         m_valsProperty->asArrayPtr()->getSample( iSampleIndex, sptr );
 
-        dataVec.assign(
-            static_cast<const Alembic::Util::float64_t*>( sptr->getData() ),
-            static_cast<const Alembic::Util::float64_t*>( sptr->getData() ) +
-            sptr->size() );
+        data = static_cast<const Alembic::Util::float64_t*>(
+            sptr->getData() );
+        dataSize = sptr->size();
     }
     else
     {
-        dataVec.resize( m_valsProperty->asScalarPtr()->getDataType().getExtent() );
-        m_valsProperty->asScalarPtr()->getSample( iSampleIndex, &(dataVec.front()) );
+        dataSize = m_valsProperty->asScalarPtr()->getDataType().getExtent();
+        Alembic::Util::float64_t * scalarPtr = scalarData;
+        if ( dataSize > MAX_SCALAR_CHANS )
+        {
+            bigScalarData.resize( dataSize );
+            scalarPtr = &( bigScalarData.front() );
+        }
+        m_valsProperty->asScalarPtr()->getSample( iSampleIndex, scalarPtr );
+        data = scalarPtr;
     }
 
     std::vector< XformOp >::iterator op = oSamp.m_ops.begin();
@@ -261,13 +299,13 @@ void IXformSchema::getChannelValues( const AbcA::index_t iSampleIndex,
         for ( std::size_t j = 0; j < op->getNumChannels();
             ++j, ++chanPos )
         {
-            if (chanPos >= dataVec.size())
+            if (chanPos >= dataSize)
             {
                 return;
             }
 
             // we ran out of data because of some malformed data
-            op->setChannelValue( j, dataVec[chanPos] );
+            op->m_channels[j] = data[chanPos];
         }
         ++op;
     }
@@ -289,7 +327,7 @@ void IXformSchema::get( XformSample &oSamp, const Abc::ISampleSelector &iSS ) co
         oSamp.setInheritsXforms( m_inheritsProperty.getValue( iSS ) );
     }
 
-    if ( ! m_valsProperty ) { return; }
+    if ( ! m_valsProperty || m_valsAreConstant ) { return; }
 
     AbcA::index_t numSamples = 0;
     if ( m_useArrayProp )
@@ -70,6 +70,7 @@ public:
     IXformSchema()
     {
         m_useArrayProp = false;
+        m_valsAreConstant = false;
         m_isConstant = true;
         m_isConstantIdentity = true;
     }
@@ -113,6 +114,8 @@ public:
     size_t getNumSamples() const;
 
     //! fill the supplied sample reference with values
+    //! Reusing the same sample for many reads, instead of calling getValue,
+    //! doesn't allocate anything once it has held as many ops.
     void get( XformSample &oSamp,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
@@ -138,6 +141,8 @@ public:
         m_childBoundsProperty.reset();
         m_sample = XformSample();
         m_inheritsProperty.reset();
+        m_valsProperty.reset();
+        m_valsAreConstant = false;
         m_isConstant = true;
         m_isConstantIdentity = true;
 
@@ -184,7 +189,10 @@ private:
     // is m_vals an ArrayProperty, or a ScalarProperty?
     bool m_useArrayProp;
 
-    // fills m_valVec with data
+    // if m_vals never changes its values are read into m_sample up front
+    bool m_valsAreConstant;
+
+    // fills the channels of oSamp's ops with the values at iSampleIndex
     void getChannelValues( const AbcA::index_t iSampleIndex,
                            XformSample & oSamp ) const;
 };
@@ -0,0 +1,360 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <Imath/ImathBoxAlgo.h>
+
+#include <sstream>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+static const std::size_t NUM_SAMPLES = 4;
+static const std::size_t NUM_LOOSE = 200;
+
+//-*****************************************************************************
+// points and no .selfBnds, like some caches are written
+void writeLoosePoints( OObject & iParent, const std::string & iName,
+                       std::size_t iSeed )
+{
+    MetaData md;
+    md.set( "schema", "AbcGeom_Points_v1" );
+    md.set( "schemaObjTitle", "AbcGeom_Points_v1:.geom" );
+    md.set( "schemaBaseType", "AbcGeom_GeomBase_v1" );
+    OObject obj( iParent, iName, md );
+
+    OCompoundProperty geom( obj.getProperties(), ".geom" );
+    OP3fArrayProperty p( geom, "P" );
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        std::vector< V3f > points;
+        for ( std::size_t j = 0; j < 10 + iSeed % 7; ++j )
+        {
+            float f = ( float ) ( ( iSeed * 31 + j * 17 + i * 5 ) % 23 );
+            points.push_back( V3f( f - 11.0f, f * 0.5f - ( float ) j,
+                                   ( float ) iSeed ) );
+        }
+        p.set( points );
+    }
+}
+
+//-*****************************************************************************
+void writeMesh( OObject & iParent, const std::string & iName, bool iAnimated )
+{
+    OPolyMesh mesh( iParent, iName );
+    int32_t indices[] = { 0, 1, 2 };
+    int32_t counts[] = { 3 };
+    for ( std::size_t i = 0; i < ( iAnimated ? NUM_SAMPLES : 1 ); ++i )
+    {
+        float t = ( float ) i;
+        V3f points[] = { V3f( -1.0f, 0.0f, t ), V3f( 1.0f, 2.0f, 0.0f ),
+                         V3f( 0.0f, -3.0f * t, 1.0f ) };
+        OPolyMeshSchema::Sample samp( P3fArraySample( points, 3 ),
+                                      Int32ArraySample( indices, 3 ),
+                                      Int32ArraySample( counts, 1 ) );
+        mesh.getSchema().set( samp );
+    }
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top = archive.getTop();
+
+    OXform a( top, "a" );
+    OXform b( a, "b" );
+    OXform stored( top, "stored" );
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        XformSample as;
+        as.setTranslation( V3d( ( double ) i, 1.0, 0.0 ) );
+        as.setYRotation( 20.0 * i );
+        a.getSchema().set( as );
+
+        XformSample bs;
+        bs.setScale( V3d( 2.0, 1.0 + i, 0.5 ) );
+        bs.setInheritsXforms( i % 2 == 0 );
+        b.getSchema().set( bs );
+
+        XformSample ss;
+        ss.setTranslation( V3d( 0.0, 0.0, 10.0 ) );
+        stored.getSchema().set( ss );
+
+        // not the real bounds of what is under it, so that it shows when
+        // they were used
+        stored.getSchema().getChildBoundsProperty().set(
+            Box3d( V3d( -1.0, -1.0, -1.0 ), V3d( 1.0, 1.0, 1.0 ) ) );
+    }
+
+    writeMesh( a, "animatedMesh", true );
+    writeMesh( b, "constantMesh", true );
+    OObject group( b, "group" );
+    writeMesh( group, "groupedMesh", false );
+    writeMesh( stored, "hiddenMesh", true );
+    writeMesh( top, "topMesh", false );
+
+    for ( std::size_t i = 0; i < NUM_LOOSE; ++i )
+    {
+        std::ostringstream name;
+        name << "loose" << i;
+        if ( i % 2 )
+        {
+            writeLoosePoints( b, name.str(), i );
+        }
+        else
+        {
+            writeLoosePoints( top, name.str(), i );
+        }
+    }
+}
+
+//-*****************************************************************************
+// the world bounds of an object's own geometry, worked out the slow way
+Box3d selfBounds( IObject iObj, const ISampleSelector & iSS )
+{
+    Box3d bnds;
+    bnds.makeEmpty();
+
+    if ( IPolyMesh::matches( iObj.getHeader() ) )
+    {
+        IPolyMesh mesh( iObj );
+        bnds = mesh.getSchema().getSelfBoundsProperty().getValue( iSS );
+    }
+    else if ( IGeomBase::matches( iObj.getMetaData() ) )
+    {
+        IP3fArrayProperty p( ICompoundProperty( iObj.getProperties(),
+                                                ".geom" ), "P" );
+        P3fArraySamplePtr points = p.getValue( iSS );
+        for ( std::size_t i = 0; i < points->size(); ++i )
+        {
+            bnds.extendBy( V3d( ( *points )[i] ) );
+        }
+    }
+    else
+    {
+        return bnds;
+    }
+
+    M44d world;
+    world.makeIdentity();
+    for ( IObject parent = iObj.getParent(); parent;
+          parent = parent.getParent() )
+    {
+        if ( IXform::matches( parent.getHeader() ) )
+        {
+            XformSample samp = IXform( parent ).getSchema().getValue( iSS );
+            world = world * samp.getMatrix();
+            if ( !samp.getInheritsXforms() )
+            {
+                break;
+            }
+        }
+    }
+
+    return Imath::transform( bnds, world );
+}
+
+//-*****************************************************************************
+bool sameBox( const Box3d & iA, const Box3d & iB )
+{
+    if ( iA.isEmpty() || iB.isEmpty() )
+    {
+        return iA.isEmpty() && iB.isEmpty();
+    }
+
+    return iA.min.equalWithAbsError( iB.min, 1e-5 ) &&
+        iA.max.equalWithAbsError( iB.max, 1e-5 );
+}
+
+//-*****************************************************************************
+void checkSample( IArchive & iArchive, BoundsHierarchy & iHier,
+                  bool iUseChildBounds, const ISampleSelector & iSS )
+{
+    BoundsHierarchySamplePtr samp = iHier.get( iSS );
+    TESTING_ASSERT( samp->getNumObjects() == iHier.getNumObjects() );
+
+    std::size_t stored = iHier.find( "/stored" );
+    std::size_t hidden = iHier.find( "/stored/hiddenMesh" );
+    Box3d all;
+    all.makeEmpty();
+
+    for ( std::size_t i = 0; i < iHier.getNumObjects(); ++i )
+    {
+        IObject obj = iArchive.getTop();
+        std::string name = iHier.getFullName( i );
+        std::size_t start = 1;
+        while ( start < name.size() )
+        {
+            std::size_t slash = name.find( '/', start );
+            if ( slash == std::string::npos )
+            {
+                slash = name.size();
+            }
+            obj = obj.getChild( name.substr( start, slash - start ) );
+            start = slash + 1;
+        }
+        TESTING_ASSERT( obj.valid() );
+
+        if ( iUseChildBounds && i == hidden )
+        {
+            TESTING_ASSERT( samp->getSelfBounds( i ).isEmpty() );
+            continue;
+        }
+
+        Box3d self = selfBounds( obj, iSS );
+        TESTING_ASSERT( sameBox( samp->getSelfBounds( i ), self ) );
+        all.extendBy( self );
+
+        // everything below is in the bounds of its parents
+        for ( std::size_t p = iHier.getParent( i );
+              p != BoundsHierarchy::NO_OBJECT; p = iHier.getParent( p ) )
+        {
+            if ( iUseChildBounds && p == stored )
+            {
+                break;
+            }
+            Box3d parentBounds = samp->getBounds( p );
+            parentBounds.extendBy( samp->getBounds( i ) );
+            TESTING_ASSERT( sameBox( parentBounds, samp->getBounds( p ) ) );
+        }
+    }
+
+    if ( iUseChildBounds )
+    {
+        Box3d storedBounds( V3d( -1.0, -1.0, 9.0 ), V3d( 1.0, 1.0, 11.0 ) );
+        TESTING_ASSERT( sameBox( samp->getBounds( stored ), storedBounds ) );
+        all.extendBy( storedBounds );
+    }
+
+    TESTING_ASSERT( sameBox( samp->getArchiveBounds(), all ) );
+    TESTING_ASSERT( sameBox( iHier.getArchiveBounds( iSS ), all ) );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName, bool iUseChildBounds )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    BoundsHierarchy hier( archive, iUseChildBounds, 2 );
+
+    TESTING_ASSERT( hier.getNumObjects() == 9 + NUM_LOOSE );
+    TESTING_ASSERT( hier.find( "/a/b/group/groupedMesh" ) !=
+                    BoundsHierarchy::NO_OBJECT );
+    TESTING_ASSERT( hier.getParent( hier.find( "/a/b/group" ) ) ==
+                    hier.find( "/a/b" ) );
+    TESTING_ASSERT( hier.find( "/nope" ) == BoundsHierarchy::NO_OBJECT );
+
+    for ( index_t i = 0; i < ( index_t ) NUM_SAMPLES; ++i )
+    {
+        checkSample( archive, hier, iUseChildBounds, ISampleSelector( i ) );
+    }
+    checkSample( archive, hier, iUseChildBounds, ISampleSelector( 1.5 ) );
+
+    // remembered until pushed out
+    BoundsHierarchySamplePtr first = hier.get( ISampleSelector( 1.0 ) );
+    TESTING_ASSERT( first == hier.get( ISampleSelector( 1.0 ) ) );
+    hier.clearCache();
+    TESTING_ASSERT( first != hier.get( ISampleSelector( 1.0 ) ) );
+
+    // written into another archive, where they are read back directly
+    std::string boundsName = "boundsHierarchyBounds.abc";
+    {
+        OArchive out( Alembic::AbcCoreOgawa::WriteArchive(), boundsName );
+        Alembic::Util::uint32_t tsIndex = out.addTimeSampling(
+            TimeSampling( 1.0, 0.0 ) );
+        hier.writeArchiveBounds( out, tsIndex, NUM_SAMPLES );
+    }
+
+    IArchive in( Alembic::AbcCoreOgawa::ReadArchive(), boundsName );
+    IBox3dProperty written = GetIArchiveBounds( in );
+    TESTING_ASSERT( written.getNumSamples() == NUM_SAMPLES );
+    for ( index_t i = 0; i < ( index_t ) NUM_SAMPLES; ++i )
+    {
+        TESTING_ASSERT( sameBox( written.getValue( ISampleSelector( i ) ),
+            hier.get( ISampleSelector( i ) )->getArchiveBounds() ) );
+    }
+
+    BoundsHierarchy writtenHier( in );
+    TESTING_ASSERT( writtenHier.getNumObjects() == 0 );
+    TESTING_ASSERT( sameBox( writtenHier.getArchiveBounds(
+        ISampleSelector( ( index_t ) 2 ) ),
+        hier.get( ISampleSelector( ( index_t ) 2 ) )->getArchiveBounds() ) );
+}
+
+//-*****************************************************************************
+void pointBounds()
+{
+    std::vector< float > points;
+    std::vector< double > dpoints;
+    for ( std::size_t i = 0; i < 3 * 37; ++i )
+    {
+        float f = ( float ) ( ( i * 7919 ) % 101 ) - 50.0f;
+        points.push_back( f );
+        dpoints.push_back( f );
+    }
+
+    // every count, so that every leftover after 4 at a time is covered
+    for ( std::size_t n = 0; n <= 37; ++n )
+    {
+        Box3d expected;
+        expected.makeEmpty();
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            expected.extendBy( V3d( points[3 * i], points[3 * i + 1],
+                                    points[3 * i + 2] ) );
+        }
+
+        Box3d bnds = ComputePointBounds( n ? &points.front() : NULL, n );
+        TESTING_ASSERT( bnds.isEmpty() == expected.isEmpty() );
+        TESTING_ASSERT( n == 0 || bnds == expected );
+
+        bnds = ComputePointBounds( n ? &dpoints.front() : NULL, n );
+        TESTING_ASSERT( n == 0 || bnds == expected );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "boundsHierarchy.abc";
+    writeArchive( name );
+    pointBounds();
+    readArchive( name, true );
+    readArchive( name, false );
+    return 0;
+}
@@ -0,0 +1,226 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <cstring>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// every size of value, every number of indices around the SIMD widths, and
+// indices that point at the last value
+void testKernels()
+{
+    const std::size_t numVals = 9;
+    std::vector< unsigned char > vals( numVals * 48 );
+    for ( std::size_t i = 0; i < vals.size(); ++i )
+    {
+        vals[i] = ( unsigned char ) ( i * 13 + 7 );
+    }
+
+    std::size_t sizes[] = { 1, 2, 4, 8, 12, 16, 24, 48 };
+    for ( std::size_t s = 0; s < sizeof( sizes ) / sizeof( sizes[0] ); ++s )
+    {
+        std::size_t bytes = sizes[s];
+        for ( std::size_t n = 0; n < 12; ++n )
+        {
+            std::vector< uint32_t > indices;
+            for ( std::size_t i = 0; i < n; ++i )
+            {
+                indices.push_back( ( uint32_t ) ( ( i * 5 + 8 ) % numVals ) );
+            }
+
+            // one more value than needed, to catch anything written past
+            std::vector< unsigned char > expanded( ( n + 1 ) * bytes, 0xAB );
+            ExpandIndexedValues( &vals.front(), numVals, bytes,
+                                 n ? &indices.front() : NULL, n,
+                                 &expanded.front() );
+
+            for ( std::size_t i = 0; i < n; ++i )
+            {
+                TESTING_ASSERT( std::memcmp( &expanded[i * bytes],
+                    &vals[indices[i] * bytes], bytes ) == 0 );
+            }
+
+            for ( std::size_t i = n * bytes; i < expanded.size(); ++i )
+            {
+                TESTING_ASSERT( expanded[i] == 0xAB );
+            }
+        }
+    }
+
+    // an index past the values
+    uint32_t badIndices[] = { 0, 1, 9 };
+    std::vector< unsigned char > out( 3 * 12 );
+    bool threw = false;
+    try
+    {
+        ExpandIndexedValues( &vals.front(), numVals, 12, badIndices, 3,
+                             &out.front() );
+    }
+    catch ( std::exception & )
+    {
+        threw = true;
+    }
+    TESTING_ASSERT( threw );
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject obj( archive.getTop(), "params" );
+    OCompoundProperty props = obj.getProperties();
+
+    std::vector< uint32_t > indices;
+    for ( uint32_t i = 0; i < 101; ++i )
+    {
+        indices.push_back( ( i * 7 ) % 5 );
+    }
+    UInt32ArraySample idxSamp( indices );
+
+    std::vector< V2f > uvs;
+    std::vector< N3f > normals;
+    std::vector< C4f > colors;
+    std::vector< std::string > names;
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+        float f = ( float ) i;
+        uvs.push_back( V2f( f, -f ) );
+        normals.push_back( N3f( f, 2.0f * f, -f ) );
+        colors.push_back( C4f( f, 0.5f, 0.25f * f, 1.0f ) );
+        names.push_back( std::string( i + 1, 'a' ) );
+    }
+
+    OV2fGeomParam uvParam( props, "uv", true, kFacevaryingScope, 1 );
+    uvParam.set( OV2fGeomParam::Sample( V2fArraySample( uvs ), idxSamp,
+                                        kFacevaryingScope ) );
+
+    ON3fGeomParam nParam( props, "N", true, kFacevaryingScope, 1 );
+    nParam.set( ON3fGeomParam::Sample( N3fArraySample( normals ), idxSamp,
+                                       kFacevaryingScope ) );
+
+    OC4fGeomParam cParam( props, "Cs", true, kFacevaryingScope, 1 );
+    cParam.set( OC4fGeomParam::Sample( C4fArraySample( colors ), idxSamp,
+                                       kFacevaryingScope ) );
+
+    OStringGeomParam sParam( props, "names", true, kFacevaryingScope, 1 );
+    sParam.set( OStringGeomParam::Sample( StringArraySample( names ),
+                                          idxSamp, kFacevaryingScope ) );
+
+    OV3fGeomParam flatParam( props, "flat", false, kVertexScope, 1 );
+    flatParam.set( OV3fGeomParam::Sample( V3fArraySample(
+        ( const V3f * ) &normals.front(), normals.size() ), kVertexScope ) );
+}
+
+//-*****************************************************************************
+template < class PARAM >
+void checkExpanded( PARAM & iParam )
+{
+    typename PARAM::Sample indexed = iParam.getIndexedValue();
+    typename PARAM::Sample expanded = iParam.getExpandedValue();
+    TESTING_ASSERT( expanded.getVals()->size() ==
+                    indexed.getIndices()->size() );
+
+    std::vector< typename PARAM::value_type > vec;
+    TESTING_ASSERT( iParam.getExpanded( vec ) == expanded.getVals()->size() );
+
+    for ( std::size_t i = 0; i < vec.size(); ++i )
+    {
+        typename PARAM::value_type val =
+            ( *indexed.getVals() )[( *indexed.getIndices() )[i]];
+        TESTING_ASSERT( ( *expanded.getVals() )[i] == val );
+        TESTING_ASSERT( vec[i] == val );
+    }
+
+    // read into again, over what was there
+    vec.assign( 3, vec[0] );
+    iParam.getExpanded( vec );
+    TESTING_ASSERT( vec.size() == expanded.getVals()->size() );
+    TESTING_ASSERT( vec.back() == expanded.getVals()->get()[vec.size() - 1] );
+
+    typename PARAM::Sample unexpanded = iParam.getUnexpandedValue();
+    TESTING_ASSERT( unexpanded.isIndexed() );
+    TESTING_ASSERT( unexpanded.getIndices()->size() == vec.size() );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IObject obj( archive.getTop(), "params" );
+    ICompoundProperty props = obj.getProperties();
+
+    IV2fGeomParam uvParam( props, "uv" );
+    checkExpanded( uvParam );
+
+    IN3fGeomParam nParam( props, "N" );
+    checkExpanded( nParam );
+
+    IC4fGeomParam cParam( props, "Cs" );
+    checkExpanded( cParam );
+
+    IStringGeomParam sParam( props, "names" );
+    checkExpanded( sParam );
+
+    // not indexed, so no made up indices unless asked for
+    IV3fGeomParam flatParam( props, "flat" );
+    IV3fGeomParam::Sample unexpanded = flatParam.getUnexpandedValue();
+    TESTING_ASSERT( !unexpanded.isIndexed() );
+    TESTING_ASSERT( !unexpanded.getIndices() );
+    TESTING_ASSERT( unexpanded.getVals()->size() == 5 );
+
+    IV3fGeomParam::Sample indexed = flatParam.getIndexedValue();
+    TESTING_ASSERT( indexed.getIndices()->size() == 5 );
+    TESTING_ASSERT( ( *indexed.getIndices() )[4] == 4 );
+
+    std::vector< V3f > vec;
+    TESTING_ASSERT( flatParam.getExpanded( vec ) == 5 );
+    TESTING_ASSERT( vec[3] == V3f( 3.0f, 6.0f, -3.0f ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testKernels();
+
+    std::string name = "geomParamTest.abc";
+    writeArchive( name );
+    readArchive( name );
+    return 0;
+}
@@ -422,6 +422,76 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+// the topology is the same for frames 0 to 2, loses a face on frame 3, and
+// is back to all of them on frames 4 and 5
+void readerTest()
+{
+    std::string name = "meshReaderTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMesh meshObj( OObject( archive, kTop ), "mesh" );
+
+        std::vector< V3f > verts( ( const V3f * ) g_verts,
+                                  ( const V3f * ) g_verts + g_numVerts );
+        for ( std::size_t i = 0; i < 6; ++i )
+        {
+            verts[0].x = ( float ) i;
+            std::size_t numCounts = i == 3 ? g_numCounts - 1 : g_numCounts;
+            OPolyMeshSchema::Sample samp(
+                V3fArraySample( verts ),
+                Int32ArraySample( g_indices, numCounts * 4 ),
+                Int32ArraySample( g_counts, numCounts ) );
+            meshObj.getSchema().set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPolyMesh meshObj( IObject( archive, kTop ), "mesh" );
+    IPolyMeshSchema &schema = meshObj.getSchema();
+    TESTING_ASSERT( schema.getTopologyVariance() == kHeterogenousTopology );
+
+    IPolyMeshReader reader( schema );
+    IPolyMeshSchema::Sample samp;
+    bool topologyChanged[] = { true, false, false, true, true, false };
+    for ( index_t i = 0; i < 6; ++i )
+    {
+        Int32ArraySamplePtr lastIndices = samp.getFaceIndices();
+        reader.get( samp, i );
+        TESTING_ASSERT( reader.positionsChanged() );
+        TESTING_ASSERT( reader.topologyChanged() == topologyChanged[i] );
+        TESTING_ASSERT( topologyChanged[i] ||
+                        samp.getFaceIndices() == lastIndices );
+
+        IPolyMeshSchema::Sample expected = schema.getValue( i );
+        TESTING_ASSERT( ( *samp.getPositions() )[0] ==
+                        V3f( ( float ) i, -1.0f, -1.0f ) );
+        TESTING_ASSERT( samp.getFaceCounts()->size() ==
+                        expected.getFaceCounts()->size() );
+        TESTING_ASSERT( samp.getFaceIndices()->size() ==
+                        expected.getFaceIndices()->size() );
+        TESTING_ASSERT( samp.getSelfBounds() == expected.getSelfBounds() );
+    }
+
+    // asking for the same frame again reads nothing
+    P3fArraySamplePtr lastPositions = samp.getPositions();
+    reader.get( samp, 5 );
+    TESTING_ASSERT( !reader.positionsChanged() );
+    TESTING_ASSERT( !reader.topologyChanged() );
+    TESTING_ASSERT( samp.getPositions() == lastPositions );
+
+    // jumping back to a frame with the same topology
+    reader.get( samp, 1 );
+    TESTING_ASSERT( reader.positionsChanged() );
+    TESTING_ASSERT( !reader.topologyChanged() );
+    TESTING_ASSERT( ( *samp.getPositions() )[0].x == 1.0f );
+
+    reader.reset();
+    reader.get( samp, 1 );
+    TESTING_ASSERT( reader.positionsChanged() );
+    TESTING_ASSERT( reader.topologyChanged() );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -444,5 +514,7 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    readerTest();
+
     return 0;
 }
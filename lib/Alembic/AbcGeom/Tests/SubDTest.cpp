@@ -474,6 +474,67 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+// deforming positions over creases and holes that only change on frame 2
+void readerTest()
+{
+    std::string name = "subdReaderTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OSubD meshObj( OObject( archive, kTop ), "subd" );
+
+        std::vector< V3f > verts( ( const V3f * ) g_verts,
+                                  ( const V3f * ) g_verts + g_numVerts );
+        std::vector< int32_t > creaseIndices( g_indices, g_indices + 4 );
+        std::vector< int32_t > creaseLengths( 1, 4 );
+        std::vector< float32_t > creaseSharpnesses( 1, 2.0f );
+        std::vector< int32_t > holes( 1, 0 );
+        for ( std::size_t i = 0; i < 4; ++i )
+        {
+            verts[0].x = ( float ) i;
+            holes[0] = i == 2 ? 3 : 0;
+            OSubDSchema::Sample samp(
+                V3fArraySample( verts ),
+                Int32ArraySample( g_indices, g_numIndices ),
+                Int32ArraySample( g_counts, g_numCounts ) );
+            samp.setCreases( Int32ArraySample( creaseIndices ),
+                             Int32ArraySample( creaseLengths ),
+                             FloatArraySample( creaseSharpnesses ) );
+            samp.setHoles( Int32ArraySample( holes ) );
+            samp.setInterpolateBoundary( ( int32_t ) i );
+            meshObj.getSchema().set( samp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    ISubD meshObj( IObject( archive, kTop ), "subd" );
+    ISubDSchema &schema = meshObj.getSchema();
+
+    ISubDReader reader( schema );
+    ISubDSchema::Sample samp;
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        Int32ArraySamplePtr lastIndices = samp.getFaceIndices();
+        Int32ArraySamplePtr lastHoles = samp.getHoles();
+        reader.get( samp, i );
+        TESTING_ASSERT( reader.positionsChanged() );
+        TESTING_ASSERT( reader.topologyChanged() == ( i == 0 ) );
+        TESTING_ASSERT( i == 0 || samp.getFaceIndices() == lastIndices );
+        TESTING_ASSERT( ( i == 0 || i == 2 || i == 3 ) ||
+                        samp.getHoles() == lastHoles );
+
+        ISubDSchema::Sample expected = schema.getValue( i );
+        TESTING_ASSERT( ( *samp.getPositions() )[0].x == ( float ) i );
+        TESTING_ASSERT( ( *samp.getHoles() )[0] == ( i == 2 ? 3 : 0 ) );
+        TESTING_ASSERT( samp.getCreaseIndices()->size() == 4 );
+        TESTING_ASSERT( ( *samp.getCreaseSharpnesses() )[0] == 2.0f );
+        TESTING_ASSERT( samp.getInterpolateBoundary() == i );
+        TESTING_ASSERT( samp.getSubdivisionScheme() ==
+                        expected.getSubdivisionScheme() );
+        TESTING_ASSERT( samp.getSelfBounds() == expected.getSelfBounds() );
+    }
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -484,5 +545,7 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    readerTest();
+
     return 0;
 }
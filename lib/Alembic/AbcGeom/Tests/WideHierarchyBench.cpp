@@ -0,0 +1,180 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Not run as part of the tests.  Writes a single level hierarchy of many
+// meshes and xforms, then times walking it the way a scene importer does:
+// matching every child against the schemas it knows about and looking at
+// the scope and extent of every mesh's UVs and normals.
+//
+// usage: AbcGeom_WideHierarchy_Bench [numObjects] [numPasses] [file]
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+using namespace Alembic::AbcGeom; // Contains Abc, AbcCoreAbstract
+
+namespace
+{
+
+//-*****************************************************************************
+void writeArchive( const std::string &iFileName, std::size_t iNumObjects )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iFileName );
+
+    const V3f points[] = { V3f( 0, 0, 0 ), V3f( 1, 0, 0 ), V3f( 1, 1, 0 ) };
+    const int32_t indices[] = { 0, 1, 2 };
+    const int32_t counts[] = { 3 };
+    const V2f uvs[] = { V2f( 0, 0 ), V2f( 1, 0 ), V2f( 1, 1 ) };
+    const N3f normals[] = { N3f( 0, 0, 1 ), N3f( 0, 0, 1 ),
+                            N3f( 0, 0, 1 ) };
+
+    OV2fGeomParam::Sample uvSamp( V2fArraySample( uvs, 3 ), kFacevaryingScope );
+    ON3fGeomParam::Sample nSamp( N3fArraySample( normals, 3 ),
+                                 kFacevaryingScope );
+    OPolyMeshSchema::Sample meshSamp( V3fArraySample( points, 3 ),
+                                      Int32ArraySample( indices, 3 ),
+                                      Int32ArraySample( counts, 1 ),
+                                      uvSamp, nSamp );
+
+    for ( std::size_t i = 0; i < iNumObjects; ++i )
+    {
+        std::stringstream strm;
+        strm << "obj" << i;
+
+        if ( i % 2 == 0 )
+        {
+            OXform xform( archive.getTop(), strm.str() );
+            XformSample xsamp;
+            xsamp.setTranslation( V3d( i, 0, 0 ) );
+            xform.getSchema().set( xsamp );
+        }
+        else
+        {
+            OPolyMesh mesh( archive.getTop(), strm.str() );
+            mesh.getSchema().set( meshSamp );
+        }
+    }
+}
+
+//-*****************************************************************************
+// returns a count so the work can't be optimized away
+std::size_t walkArchive( IArchive &iArchive )
+{
+    std::size_t count = 0;
+    IObject top = iArchive.getTop();
+
+    for ( std::size_t i = 0; i < top.getNumChildren(); ++i )
+    {
+        const ObjectHeader &header = top.getChildHeader( i );
+
+        if ( ISubD::matches( header ) || ICurves::matches( header ) ||
+             INuPatch::matches( header ) || IPoints::matches( header ) )
+        {
+            continue;
+        }
+        else if ( IXform::matches( header ) )
+        {
+            count += 1;
+        }
+        else if ( IPolyMesh::matches( header ) )
+        {
+            IPolyMesh mesh( top, header.getName() );
+            IPolyMeshSchema &schema = mesh.getSchema();
+
+            IV2fGeomParam uvs = schema.getUVsParam();
+            IN3fGeomParam normals = schema.getNormalsParam();
+            if ( uvs && uvs.getScope() == kFacevaryingScope )
+            {
+                count += uvs.getArrayExtent();
+            }
+
+            if ( normals && normals.getScope() == kFacevaryingScope )
+            {
+                count += normals.getArrayExtent();
+            }
+        }
+    }
+
+    return count;
+}
+
+}
+
+int main( int argc, char *argv[] )
+{
+    std::size_t numObjects = 100000;
+    if ( argc > 1 )
+    {
+        numObjects = strtoul( argv[1], NULL, 10 );
+    }
+
+    std::size_t numPasses = 5;
+    if ( argc > 2 )
+    {
+        numPasses = strtoul( argv[2], NULL, 10 );
+    }
+
+    std::string fileName = "wideHierarchyBench.abc";
+    if ( argc > 3 )
+    {
+        fileName = argv[3];
+    }
+
+    writeArchive( fileName, numObjects );
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < numPasses; ++i )
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), fileName );
+        count += walkArchive( archive );
+    }
+
+    double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << numObjects << " objects, " << numPasses << " passes: "
+              << seconds / numPasses << " s per pass (" << count << ")"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,285 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <map>
+#include <sstream>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+static const std::size_t NUM_SAMPLES = 6;
+static const std::size_t NUM_WIDE = 1500;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top = archive.getTop();
+
+    OXform a( top, "a" );
+    OXform b( a, "b" );
+    OObject group( b, "group" );
+    OXform c( group, "c" );
+    OXform d( c, "d" );
+    OXform e( d, "e" );
+    OXform lots( a, "lots" );
+    OXform still( top, "still" );
+    OXform stillChild( still, "child" );
+
+    for ( std::size_t i = 0; i < NUM_SAMPLES; ++i )
+    {
+        double t = ( double ) i;
+
+        XformSample as;
+        as.setTranslation( V3d( t, 2.0, -t ) );
+        as.setRotation( V3d( 1.0, 1.0, 0.0 ), 10.0 * t );
+        as.setScale( V3d( 1.0 + t, 2.0, 0.5 ) );
+        a.getSchema().set( as );
+
+        XformSample bs;
+        bs.setXRotation( 5.0 * t );
+        bs.setYRotation( -3.0 * t );
+        bs.setZRotation( 90.0 );
+        b.getSchema().set( bs );
+
+        M44d m;
+        m.makeIdentity();
+        m.x[0][1] = 0.1 * t;
+        m.x[3][0] = 3.0;
+        XformSample cs;
+        cs.setMatrix( m );
+        cs.setTranslation( V3d( 0.0, t, 0.0 ) );
+        c.getSchema().set( cs );
+
+        // stops inheriting part way through
+        XformSample ds;
+        ds.setTranslation( V3d( 1.0, 1.0, t ) );
+        ds.setInheritsXforms( i < 3 );
+        d.getSchema().set( ds );
+
+        // enough ops that the channels are kept in an array property
+        XformSample es;
+        for ( std::size_t j = 0; j < 20; ++j )
+        {
+            XformOp op( kMatrixOperation, kMatrixHint );
+            M44d om;
+            om.makeIdentity();
+            om.x[3][j % 3] = 0.01 * ( t + 1.0 );
+            for ( std::size_t k = 0; k < 16; ++k )
+            {
+                op.setChannelValue( k, om.getValue()[k] );
+            }
+            es.addOp( op );
+        }
+        e.getSchema().set( es );
+
+        XformSample ls;
+        ls.setTranslation( V3d( 0.0, 0.0, t ) );
+        lots.getSchema().set( ls );
+    }
+
+    XformSample ss;
+    ss.setTranslation( V3d( 5.0, 6.0, 7.0 ) );
+    ss.setXRotation( 45.0 );
+    still.getSchema().set( ss );
+
+    XformSample scs;
+    scs.setScale( V3d( 2.0, 2.0, 2.0 ) );
+    scs.setInheritsXforms( false );
+    stillChild.getSchema().set( scs );
+
+    // enough xforms, in enough subtrees, to be worked out in parallel
+    for ( std::size_t i = 0; i < NUM_WIDE / 100; ++i )
+    {
+        std::ostringstream branchName;
+        branchName << "branch" << i;
+        OXform branch( lots, branchName.str() );
+        XformSample bs;
+        bs.setTranslation( V3d( ( double ) i, 0.0, 0.0 ) );
+        branch.getSchema().set( bs );
+
+        for ( std::size_t j = 0; j < 99; ++j )
+        {
+            std::ostringstream leafName;
+            leafName << "leaf" << j;
+            OXform leaf( branch, leafName.str() );
+            for ( std::size_t k = 0; k < NUM_SAMPLES; ++k )
+            {
+                XformSample ls;
+                ls.setYRotation( ( double ) ( j * k ) );
+                ls.setTranslation( V3d( 0.0, ( double ) j, 0.0 ) );
+                leaf.getSchema().set( ls );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+// the world matrix of every xform worked out one at a time
+void walk( IObject iObj, const M44d & iParentWorld,
+           const ISampleSelector & iSS, std::map< std::string, M44d > & oWorld,
+           std::map< std::string, M44d > & oLocal )
+{
+    for ( std::size_t i = 0; i < iObj.getNumChildren(); ++i )
+    {
+        IObject child = iObj.getChild( i );
+        M44d world = iParentWorld;
+        if ( IXform::matches( child.getHeader() ) )
+        {
+            IXform x( child );
+            XformSample samp = x.getSchema().getValue( iSS );
+            M44d local = samp.getMatrix();
+            world = samp.getInheritsXforms() ? local * iParentWorld : local;
+            oWorld[child.getFullName()] = world;
+            oLocal[child.getFullName()] = local;
+        }
+        walk( child, world, iSS, oWorld, oLocal );
+    }
+}
+
+//-*****************************************************************************
+void checkSample( IArchive & iArchive, XformHierarchy & iHier,
+                  const ISampleSelector & iSS )
+{
+    std::map< std::string, M44d > world;
+    std::map< std::string, M44d > local;
+    M44d identity;
+    identity.makeIdentity();
+    walk( iArchive.getTop(), identity, iSS, world, local );
+
+    XformHierarchySamplePtr samp = iHier.get( iSS );
+    TESTING_ASSERT( samp->getNumXforms() == world.size() );
+    TESTING_ASSERT( iHier.getNumXforms() == world.size() );
+
+    for ( std::size_t i = 0; i < iHier.getNumXforms(); ++i )
+    {
+        const std::string & name = iHier.getFullName( i );
+        TESTING_ASSERT( world.count( name ) == 1 );
+        TESTING_ASSERT( samp->getLocalMatrix( i ).equalWithAbsError(
+            local[name], 1e-9 ) );
+        TESTING_ASSERT( samp->getWorldMatrix( i ).equalWithAbsError(
+            world[name], 1e-9 ) );
+
+        std::size_t parent = iHier.getParent( i );
+        TESTING_ASSERT( parent == XformHierarchy::NO_XFORM || parent < i );
+    }
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    XformHierarchy hier( archive, 2 );
+
+    // a, b, c, d, e, lots, the branches and leaves, still and its child
+    TESTING_ASSERT( hier.getNumXforms() == 8 + NUM_WIDE );
+
+    std::size_t a = hier.find( "/a" );
+    std::size_t c = hier.find( "/a/b/group/c" );
+    TESTING_ASSERT( a == 0 );
+    TESTING_ASSERT( c != XformHierarchy::NO_XFORM );
+    TESTING_ASSERT( hier.getParent( c ) == hier.find( "/a/b" ) );
+    TESTING_ASSERT( hier.getParent( a ) == XformHierarchy::NO_XFORM );
+    TESTING_ASSERT( hier.find( "/a/b/group" ) == XformHierarchy::NO_XFORM );
+    TESTING_ASSERT( hier.findClosest( "/a/b/group" ) == hier.find( "/a/b" ) );
+    TESTING_ASSERT( hier.findClosest( "/a/b/group/c/shape" ) == c );
+    TESTING_ASSERT( hier.findClosest( "/notThere" ) ==
+                    XformHierarchy::NO_XFORM );
+    TESTING_ASSERT( hier.getFullName( c ) == "/a/b/group/c" );
+
+    for ( index_t i = 0; i < ( index_t ) NUM_SAMPLES; ++i )
+    {
+        checkSample( archive, hier, ISampleSelector( i ) );
+    }
+
+    // before, between and after the samples
+    checkSample( archive, hier, ISampleSelector( -1.0 ) );
+    checkSample( archive, hier, ISampleSelector( 2.5 ) );
+    checkSample( archive, hier, ISampleSelector( 2.5,
+                                 ISampleSelector::kCeilIndex ) );
+    checkSample( archive, hier, ISampleSelector( 100.0 ) );
+
+    // the same time comes back from the cache, until it is pushed out
+    XformHierarchySamplePtr first = hier.get( ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( first == hier.get( ISampleSelector( ( index_t ) 1 ) ) );
+    hier.get( ISampleSelector( ( index_t ) 2 ) );
+    TESTING_ASSERT( first == hier.get( ISampleSelector( ( index_t ) 1 ) ) );
+    hier.get( ISampleSelector( ( index_t ) 2 ) );
+    hier.get( ISampleSelector( ( index_t ) 3 ) );
+    TESTING_ASSERT( first != hier.get( ISampleSelector( ( index_t ) 1 ) ) );
+
+    XformHierarchySamplePtr again = hier.get( ISampleSelector( ( index_t ) 1 ) );
+    hier.clearCache();
+    TESTING_ASSERT( again != hier.get( ISampleSelector( ( index_t ) 1 ) ) );
+
+    // d stopped inheriting at the fourth sample
+    std::size_t d = hier.find( "/a/b/group/c/d" );
+    XformHierarchySamplePtr late = hier.get( ISampleSelector( ( index_t ) 4 ) );
+    TESTING_ASSERT( late->getWorldMatrix( d ) == late->getLocalMatrix( d ) );
+    XformHierarchySamplePtr early = hier.get( ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( early->getWorldMatrix( d ) == early->getLocalMatrix( d ) *
+                    early->getWorldMatrix( c ) );
+}
+
+//-*****************************************************************************
+void emptyArchive()
+{
+    std::string name = "xformHierarchyEmpty.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OObject child( archive.getTop(), "notAnXform" );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    XformHierarchy hier( archive );
+    TESTING_ASSERT( hier.getNumXforms() == 0 );
+    TESTING_ASSERT( hier.get()->getNumXforms() == 0 );
+    TESTING_ASSERT( hier.findClosest( "/notAnXform" ) ==
+                    XformHierarchy::NO_XFORM );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "xformHierarchy.abc";
+    writeArchive( name );
+    readArchive( name );
+    emptyArchive();
+    return 0;
+}
@@ -689,6 +689,77 @@ void malformed_xform()
         xformObj.getSchema().get( xs );
 }
 
+//-*****************************************************************************
+void reuseSample()
+{
+    std::string name = "reuseXformSample.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OXform axform( OObject( archive ), "a" );
+        OXform bxform( OObject( archive ), "b" );
+        for ( std::size_t i = 0; i < 4; ++i )
+        {
+            XformSample asamp;
+            asamp.setTranslation( V3d( 1.0, ( double ) i, 3.0 ) );
+            asamp.setZRotation( 30.0 );
+            axform.getSchema().set( asamp );
+
+            // b never changes
+            XformSample bsamp;
+            bsamp.setScale( V3d( 2.0, 3.0, 4.0 ) );
+            M44d mat;
+            mat.setTranslation( V3d( 5.0, 6.0, 7.0 ) );
+            bsamp.setMatrix( mat );
+            bxform.getSchema().set( bsamp );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IXform axform( archive.getTop(), "a" );
+    IXform bxform( archive.getTop(), "b" );
+    TESTING_ASSERT( !axform.getSchema().isConstant() );
+    TESTING_ASSERT( bxform.getSchema().isConstant() );
+
+    // the same sample read into from xforms with different ops
+    XformSample samp;
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        axform.getSchema().get( samp, ISampleSelector( i ) );
+        TESTING_ASSERT( samp.getNumOps() == 2 );
+        TESTING_ASSERT( samp.getNumOpChannels() == 4 );
+        TESTING_ASSERT( samp.getTranslation() == V3d( 1.0, i, 3.0 ) );
+        TESTING_ASSERT( samp[1].getZRotation() == 30.0 );
+        TESTING_ASSERT( !samp[0].isXAnimated() );
+        TESTING_ASSERT( samp[0].isYAnimated() );
+        TESTING_ASSERT( !samp[0].isZAnimated() );
+        TESTING_ASSERT( !samp[1].isAngleAnimated() );
+        TESTING_ASSERT( !samp[0].isChannelAnimated( 100 ) );
+
+        bxform.getSchema().get( samp, ISampleSelector( i ) );
+        TESTING_ASSERT( samp.getNumOps() == 2 );
+        TESTING_ASSERT( samp.getNumOpChannels() == 19 );
+        TESTING_ASSERT( samp[0].getScale() == V3d( 2.0, 3.0, 4.0 ) );
+        TESTING_ASSERT( samp[1].getMatrix().translation() ==
+                        V3d( 5.0, 6.0, 7.0 ) );
+        for ( std::size_t j = 0; j < 16; ++j )
+        {
+            TESTING_ASSERT( !samp[1].isChannelAnimated( j ) );
+        }
+    }
+
+    // changing the type of an op keeps the channels it had
+    XformOp op( kTranslateOperation );
+    op.setTranslate( V3d( 1.0, 2.0, 3.0 ) );
+    op.setType( kRotateXOperation );
+    TESTING_ASSERT( op.getNumChannels() == 1 );
+    TESTING_ASSERT( op.getChannelValue( 0 ) == 1.0 );
+    op.setType( kMatrixOperation );
+    TESTING_ASSERT( op.getNumChannels() == 16 );
+    TESTING_ASSERT( op.getChannelValue( 0 ) == 1.0 );
+    TESTING_ASSERT( op.getChannelValue( 1 ) == 0.0 );
+    TESTING_ASSERT( op.getChannelValue( 15 ) == 0.0 );
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -702,5 +773,6 @@ int main( int argc, char *argv[] )
     fuzzer_issue25695(false);
     fuzzer_issue25695(true);
     malformed_xform();
+    reuseSample();
     return 0;
 }
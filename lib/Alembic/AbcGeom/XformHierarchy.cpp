@@ -0,0 +1,501 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/XformHierarchy.h>
+#include <Alembic/Util/ThreadPool.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+const std::size_t XformHierarchy::NO_XFORM = std::size_t( -1 );
+
+namespace {
+
+// below this many xforms it isn't worth handing them to other threads
+const std::size_t MIN_PARALLEL_XFORMS = 1024;
+
+// and subtrees smaller than this aren't split up any further
+const std::size_t MIN_RANGE_XFORMS = 64;
+
+//-*****************************************************************************
+// does what XformSample::getMatrix does, without an XformOp per op
+void ComputeMatrix( const Util::uint8_t * iOps, std::size_t iNumOps,
+                    const double * iChannels, Abc::M44d & oMatrix )
+{
+    oMatrix.makeIdentity();
+
+    for ( std::size_t i = 0; i < iNumOps; ++i )
+    {
+        // translating and scaling only touch a few values, the rest are
+        // multiplied by 0 or 1, so they are left alone
+        switch ( iOps[i] )
+        {
+        case kTranslateOperation:
+        {
+            for ( std::size_t j = 0; j < 4; ++j )
+            {
+                oMatrix.x[3][j] = iChannels[0] * oMatrix.x[0][j] +
+                    iChannels[1] * oMatrix.x[1][j] +
+                    iChannels[2] * oMatrix.x[2][j] + oMatrix.x[3][j];
+            }
+            iChannels += 3;
+        }
+        break;
+
+        case kScaleOperation:
+        {
+            for ( std::size_t j = 0; j < 3; ++j )
+            {
+                for ( std::size_t k = 0; k < 4; ++k )
+                {
+                    oMatrix.x[j][k] = iChannels[j] * oMatrix.x[j][k];
+                }
+            }
+            iChannels += 3;
+        }
+        break;
+
+        case kMatrixOperation:
+        {
+            Abc::M44d m;
+            for ( std::size_t j = 0; j < 4; ++j )
+            {
+                for ( std::size_t k = 0; k < 4; ++k )
+                {
+                    m.x[j][k] = iChannels[( 4 * j ) + k];
+                }
+            }
+            oMatrix = m * oMatrix;
+            iChannels += 16;
+        }
+        break;
+
+        case kRotateOperation:
+        {
+            Abc::M44d m;
+            m.setAxisAngle( Abc::V3d( iChannels[0], iChannels[1],
+                                      iChannels[2] ),
+                            DegreesToRadians( iChannels[3] ) );
+            oMatrix = m * oMatrix;
+            iChannels += 4;
+        }
+        break;
+
+        case kRotateXOperation:
+        case kRotateYOperation:
+        case kRotateZOperation:
+        {
+            Abc::V3d axis( 0.0, 0.0, 0.0 );
+            axis[iOps[i] - kRotateXOperation] = 1.0;
+            Abc::M44d m;
+            m.setAxisAngle( axis, DegreesToRadians( iChannels[0] ) );
+            oMatrix = m * oMatrix;
+            iChannels += 1;
+        }
+        break;
+
+        default:
+        break;
+        }
+    }
+}
+
+}
+
+//-*****************************************************************************
+XformHierarchy::XformHierarchy( Abc::IArchive iArchive,
+                                std::size_t iMaxCachedTimes )
+    : m_archive( iArchive )
+    , m_maxCachedTimes( iMaxCachedTimes )
+{
+    addXforms( m_archive.getTop(), NO_XFORM );
+    splitIntoRanges();
+}
+
+//-*****************************************************************************
+XformHierarchy::~XformHierarchy()
+{
+}
+
+//-*****************************************************************************
+void XformHierarchy::addXforms( Abc::IObject iObject, std::size_t iParent )
+{
+    std::size_t numChildren = iObject.getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        Abc::IObject child = iObject.getChild( i );
+        if ( !IXform::matches( child.getHeader() ) )
+        {
+            addXforms( child, iParent );
+            continue;
+        }
+
+        IXform xform( child );
+        IXformSchema & schema = xform.getSchema();
+
+        // the ops don't change, the first sample has them all
+        XformSample sample;
+        schema.get( sample );
+
+        Xform x;
+        x.fullName = child.getFullName();
+        x.parent = iParent;
+        x.end = 0;
+        x.firstOp = m_ops.size();
+        x.numOps = sample.getNumOps();
+        x.firstChannel = m_defaults.size();
+        for ( std::size_t j = 0; j < x.numOps; ++j )
+        {
+            XformOp op = sample.getOp( j );
+            m_ops.push_back( op.getType() );
+
+            XformOp defaultOp( op.getType(), op.getHint() );
+            for ( std::size_t k = 0; k < defaultOp.getNumChannels(); ++k )
+            {
+                m_defaults.push_back( defaultOp.getDefaultChannelValue( k ) );
+            }
+        }
+        x.numChannels = m_defaults.size() - x.firstChannel;
+
+        x.isConstant = schema.isConstant();
+        x.constantInherits = sample.getInheritsXforms();
+        x.constantLocal = sample.getMatrix();
+
+        if ( !x.isConstant )
+        {
+            AbcA::CompoundPropertyReaderPtr ptr = schema.getPtr();
+            const AbcA::PropertyHeader * valsPH =
+                ptr->getPropertyHeader( ".vals" );
+            if ( valsPH && valsPH->isScalar() )
+            {
+                x.scalarVals = ptr->getScalarProperty( ".vals" );
+            }
+            else if ( valsPH && valsPH->isArray() )
+            {
+                x.arrayVals = ptr->getArrayProperty( ".vals" );
+            }
+
+            const AbcA::PropertyHeader * inheritsPH =
+                ptr->getPropertyHeader( ".inherits" );
+            if ( inheritsPH && inheritsPH->isScalar() )
+            {
+                x.inherits = ptr->getScalarProperty( ".inherits" );
+            }
+        }
+
+        std::size_t index = m_xforms.size();
+        m_names[x.fullName] = index;
+        m_xforms.push_back( x );
+
+        addXforms( child, index );
+        m_xforms[index].end = m_xforms.size();
+    }
+}
+
+//-*****************************************************************************
+void XformHierarchy::splitIntoRanges()
+{
+    m_prefix.clear();
+    m_ranges.clear();
+
+    std::size_t numXforms = m_xforms.size();
+    if ( numXforms < MIN_PARALLEL_XFORMS )
+    {
+        return;
+    }
+
+    // each xform at the top is the start of an independent subtree
+    for ( std::size_t i = 0; i < numXforms; i = m_xforms[i].end )
+    {
+        m_ranges.push_back( std::make_pair( i, m_xforms[i].end ) );
+    }
+
+    // break up the biggest subtrees until there is plenty for every thread
+    // to do, their roots are worked out first
+    std::size_t targetRanges =
+        4 * ( Util::ThreadPool::global().getNumThreads() + 1 );
+    while ( m_ranges.size() < targetRanges )
+    {
+        std::size_t biggest = 0;
+        for ( std::size_t i = 1; i < m_ranges.size(); ++i )
+        {
+            if ( m_ranges[i].second - m_ranges[i].first >
+                 m_ranges[biggest].second - m_ranges[biggest].first )
+            {
+                biggest = i;
+            }
+        }
+
+        std::size_t root = m_ranges[biggest].first;
+        std::size_t end = m_ranges[biggest].second;
+        if ( end - root < 2 * MIN_RANGE_XFORMS )
+        {
+            break;
+        }
+
+        m_prefix.push_back( root );
+        m_ranges.erase( m_ranges.begin() + biggest );
+        for ( std::size_t i = root + 1; i < end; i = m_xforms[i].end )
+        {
+            m_ranges.push_back( std::make_pair( i, m_xforms[i].end ) );
+        }
+    }
+
+    // the biggest first, so the small ones fill in at the end
+    std::sort( m_ranges.begin(), m_ranges.end(),
+        []( const std::pair< std::size_t, std::size_t > & iA,
+            const std::pair< std::size_t, std::size_t > & iB )
+        { return iA.second - iA.first > iB.second - iB.first; } );
+}
+
+//-*****************************************************************************
+const std::string & XformHierarchy::getFullName( std::size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_xforms.size(),
+                 "Invalid index in XformHierarchy::getFullName: " << iIndex );
+    return m_xforms[iIndex].fullName;
+}
+
+//-*****************************************************************************
+std::size_t XformHierarchy::getParent( std::size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_xforms.size(),
+                 "Invalid index in XformHierarchy::getParent: " << iIndex );
+    return m_xforms[iIndex].parent;
+}
+
+//-*****************************************************************************
+std::size_t XformHierarchy::find( const std::string & iFullName ) const
+{
+    std::map< std::string, std::size_t >::const_iterator it =
+        m_names.find( iFullName );
+    if ( it == m_names.end() )
+    {
+        return NO_XFORM;
+    }
+    return it->second;
+}
+
+//-*****************************************************************************
+std::size_t XformHierarchy::findClosest( const std::string & iFullName ) const
+{
+    std::string name = iFullName;
+    while ( !name.empty() )
+    {
+        std::size_t found = find( name );
+        if ( found != NO_XFORM )
+        {
+            return found;
+        }
+
+        std::size_t slash = name.rfind( '/' );
+        if ( slash == std::string::npos )
+        {
+            break;
+        }
+        name.resize( slash );
+    }
+
+    return NO_XFORM;
+}
+
+//-*****************************************************************************
+bool XformHierarchy::evaluateLocal( const Xform & iXform,
+                                    const Abc::ISampleSelector & iSS,
+                                    std::vector< double > & ioChannels,
+                                    Abc::M44d & oLocal ) const
+{
+    if ( iXform.isConstant )
+    {
+        oLocal = iXform.constantLocal;
+        return iXform.constantInherits;
+    }
+
+    // like IXformSchema::get, channels without a value keep their default
+    ioChannels.assign( m_defaults.begin() + iXform.firstChannel,
+                       m_defaults.begin() + iXform.firstChannel +
+                       iXform.numChannels );
+
+    if ( iXform.scalarVals && iXform.scalarVals->getNumSamples() > 0 )
+    {
+        index_t index = iSS.getIndex( iXform.scalarVals->getTimeSampling(),
+                                      iXform.scalarVals->getNumSamples() );
+        std::size_t extent =
+            iXform.scalarVals->getDataType().getExtent();
+        if ( index >= 0 && extent == iXform.numChannels )
+        {
+            iXform.scalarVals->getSample( index, &ioChannels.front() );
+        }
+        else if ( index >= 0 && extent > 0 )
+        {
+            std::vector< double > vals( extent );
+            iXform.scalarVals->getSample( index, &vals.front() );
+            std::copy( vals.begin(), vals.begin() +
+                       std::min( extent, iXform.numChannels ),
+                       ioChannels.begin() );
+        }
+    }
+    else if ( iXform.arrayVals && iXform.arrayVals->getNumSamples() > 0 )
+    {
+        index_t index = iSS.getIndex( iXform.arrayVals->getTimeSampling(),
+                                      iXform.arrayVals->getNumSamples() );
+        if ( index >= 0 )
+        {
+            AbcA::ArraySamplePtr vals;
+            iXform.arrayVals->getSample( index, vals );
+            const double * data =
+                static_cast< const double * >( vals->getData() );
+            std::copy( data, data +
+                       std::min( vals->size(), iXform.numChannels ),
+                       ioChannels.begin() );
+        }
+    }
+
+    bool inherits = true;
+    if ( iXform.inherits && iXform.inherits->getNumSamples() > 0 )
+    {
+        index_t index = iSS.getIndex( iXform.inherits->getTimeSampling(),
+                                      iXform.inherits->getNumSamples() );
+        if ( index >= 0 )
+        {
+            Util::bool_t val;
+            iXform.inherits->getSample( index, &val );
+            inherits = val;
+        }
+    }
+
+    ComputeMatrix( &m_ops.front() + iXform.firstOp, iXform.numOps,
+                   ioChannels.empty() ? NULL : &ioChannels.front(), oLocal );
+    return inherits;
+}
+
+//-*****************************************************************************
+void XformHierarchy::evaluate( std::size_t iBegin, std::size_t iEnd,
+                               const Abc::ISampleSelector & iSS,
+                               std::vector< double > & ioChannels,
+                               XformHierarchySample & oSample ) const
+{
+    for ( std::size_t i = iBegin; i < iEnd; ++i )
+    {
+        const Xform & x = m_xforms[i];
+        Abc::M44d & local = oSample.m_local[i];
+        bool inherits = evaluateLocal( x, iSS, ioChannels, local );
+
+        if ( x.parent != NO_XFORM && inherits )
+        {
+            oSample.m_world[i] = local * oSample.m_world[x.parent];
+        }
+        else
+        {
+            oSample.m_world[i] = local;
+        }
+    }
+}
+
+//-*****************************************************************************
+XformHierarchySamplePtr
+XformHierarchy::get( const Abc::ISampleSelector & iSS )
+{
+    CacheKey key;
+    key.index = iSS.getRequestedIndex();
+    key.time = iSS.getRequestedTime();
+    key.timeIndexType = iSS.getRequestedTimeIndexType();
+
+    {
+        Alembic::Util::scoped_lock l( m_cacheLock );
+        for ( Cache::iterator it = m_cache.begin(); it != m_cache.end();
+              ++it )
+        {
+            if ( it->first == key )
+            {
+                m_cache.splice( m_cache.begin(), m_cache, it );
+                return m_cache.front().second;
+            }
+        }
+    }
+
+    Util::shared_ptr< XformHierarchySample > sample(
+        new XformHierarchySample() );
+    sample->m_local.resize( m_xforms.size() );
+    sample->m_world.resize( m_xforms.size() );
+
+    std::vector< double > channels;
+    if ( m_ranges.empty() )
+    {
+        evaluate( 0, m_xforms.size(), iSS, channels, *sample );
+    }
+    else
+    {
+        for ( std::size_t i = 0; i < m_prefix.size(); ++i )
+        {
+            evaluate( m_prefix[i], m_prefix[i] + 1, iSS, channels, *sample );
+        }
+
+        XformHierarchySample * samplePtr = sample.get();
+        Util::ThreadPool::global().parallelFor( m_ranges.size(),
+            [this, &iSS, samplePtr]( std::size_t iRange )
+            {
+                std::vector< double > rangeChannels;
+                evaluate( m_ranges[iRange].first, m_ranges[iRange].second,
+                          iSS, rangeChannels, *samplePtr );
+            } );
+    }
+
+    if ( m_maxCachedTimes > 0 )
+    {
+        Alembic::Util::scoped_lock l( m_cacheLock );
+        m_cache.push_front( std::make_pair( key, sample ) );
+        while ( m_cache.size() > m_maxCachedTimes )
+        {
+            m_cache.pop_back();
+        }
+    }
+
+    return sample;
+}
+
+//-*****************************************************************************
+void XformHierarchy::clearCache()
+{
+    Alembic::Util::scoped_lock l( m_cacheLock );
+    m_cache.clear();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
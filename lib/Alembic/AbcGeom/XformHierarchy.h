@@ -0,0 +1,218 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_XformHierarchy_h
+#define Alembic_AbcGeom_XformHierarchy_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+#include <list>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The local and world matrices of every xform of an XformHierarchy at one
+//! time, in the same order as the hierarchy's xforms.
+class ALEMBIC_EXPORT XformHierarchySample
+{
+public:
+    XformHierarchySample() {}
+
+    std::size_t getNumXforms() const { return m_local.size(); }
+
+    const Abc::M44d & getLocalMatrix( std::size_t iIndex ) const
+    { return m_local[iIndex]; }
+
+    //! The local matrix of the xform, times the world matrix of its parent
+    //! if it inherits its parent's transform.
+    const Abc::M44d & getWorldMatrix( std::size_t iIndex ) const
+    { return m_world[iIndex]; }
+
+    const std::vector< Abc::M44d > & getLocalMatrices() const
+    { return m_local; }
+
+    const std::vector< Abc::M44d > & getWorldMatrices() const
+    { return m_world; }
+
+private:
+    friend class XformHierarchy;
+
+    std::vector< Abc::M44d > m_local;
+    std::vector< Abc::M44d > m_world;
+};
+
+typedef Util::shared_ptr< const XformHierarchySample >
+    XformHierarchySamplePtr;
+
+//-*****************************************************************************
+//! Every xform in an archive, read once up front so that the local and world
+//! matrices of all of them can be worked out together, instead of getting
+//! an XformSample for each one and walking up its parents.
+//! The ops of all the xforms are kept in one flat list, and the channels
+//! read at each time go into one array.  Xforms which never change are only
+//! read once.  Big hierarchies are split up into subtrees which are worked
+//! out on the global thread pool.
+//! The last few times asked for are kept, so asking for the same time
+//! again costs nothing.
+//! It is safe to call get() from many threads at once.
+class ALEMBIC_EXPORT XformHierarchy : private Alembic::Util::noncopyable
+{
+public:
+    //! Returned by getParent and find when there isn't one.
+    static const std::size_t NO_XFORM;
+
+    //! Walks the whole of iArchive, including instances, finding the xforms.
+    //! iMaxCachedTimes is how many times get() remembers.
+    explicit XformHierarchy( Abc::IArchive iArchive,
+                             std::size_t iMaxCachedTimes = 4 );
+
+    ~XformHierarchy();
+
+    //! The xforms are in depth first order, so parents come before their
+    //! children.
+    std::size_t getNumXforms() const { return m_xforms.size(); }
+
+    const std::string & getFullName( std::size_t iIndex ) const;
+
+    //! The closest xform above this one, objects which aren't xforms in
+    //! between are skipped.
+    std::size_t getParent( std::size_t iIndex ) const;
+
+    //! The xform with this full name, or NO_XFORM.
+    std::size_t find( const std::string & iFullName ) const;
+
+    //! The xform with this full name, or else the closest xform above it.
+    //! The world matrix of that xform is the one to use for any object at
+    //! iFullName.  NO_XFORM if there isn't one.
+    std::size_t findClosest( const std::string & iFullName ) const;
+
+    //! Works out the local and world matrices of every xform at iSS.
+    XformHierarchySamplePtr get(
+        const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    //! Forgets the times get() has remembered.
+    void clearCache();
+
+private:
+    struct Xform
+    {
+        std::string fullName;
+        std::size_t parent;
+
+        // one past the last xform below this one
+        std::size_t end;
+
+        // where its ops are in m_ops, and its channels in m_defaults
+        std::size_t firstOp;
+        std::size_t numOps;
+        std::size_t firstChannel;
+        std::size_t numChannels;
+
+        // only kept for xforms which change
+        AbcA::ScalarPropertyReaderPtr scalarVals;
+        AbcA::ArrayPropertyReaderPtr arrayVals;
+        AbcA::ScalarPropertyReaderPtr inherits;
+
+        bool isConstant;
+        bool constantInherits;
+        Abc::M44d constantLocal;
+    };
+
+    void addXforms( Abc::IObject iObject, std::size_t iParent );
+    void splitIntoRanges();
+
+    // works out xforms iBegin to iEnd, their parents must already be done
+    void evaluate( std::size_t iBegin, std::size_t iEnd,
+                   const Abc::ISampleSelector & iSS,
+                   std::vector< double > & ioChannels,
+                   XformHierarchySample & oSample ) const;
+
+    // returns whether it inherits
+    bool evaluateLocal( const Xform & iXform,
+                        const Abc::ISampleSelector & iSS,
+                        std::vector< double > & ioChannels,
+                        Abc::M44d & oLocal ) const;
+
+    Abc::IArchive m_archive;
+
+    std::vector< Xform > m_xforms;
+    std::map< std::string, std::size_t > m_names;
+
+    // one entry per op, all of the xforms' ops one after another
+    std::vector< Util::uint8_t > m_ops;
+
+    // the default value of each channel, laid out like m_ops
+    std::vector< double > m_defaults;
+
+    // worked out before everything else, in order, the ranges of xforms
+    // after that don't depend on each other
+    std::vector< std::size_t > m_prefix;
+    std::vector< std::pair< std::size_t, std::size_t > > m_ranges;
+
+    struct CacheKey
+    {
+        index_t index;
+        chrono_t time;
+        Abc::ISampleSelector::TimeIndexType timeIndexType;
+
+        bool operator==( const CacheKey & iOther ) const
+        {
+            return index == iOther.index && time == iOther.time &&
+                timeIndexType == iOther.timeIndexType;
+        }
+    };
+
+    // most recently used at the front
+    typedef std::list< std::pair< CacheKey, XformHierarchySamplePtr > >
+        Cache;
+    Cache m_cache;
+    std::size_t m_maxCachedTimes;
+    Alembic::Util::mutex m_cacheLock;
+};
+
+typedef Util::shared_ptr< XformHierarchy > XformHierarchyPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -44,65 +44,33 @@ namespace ALEMBIC_VERSION_NS {
 XformOp::XformOp()
   : m_type( kTranslateOperation )
   , m_hint( 0 )
+  , m_numChannels( 0 )
+  , m_animChannels( 0 )
 {
-    m_channels.clear();
-    m_channels.resize( 3 );
+    setNumChannels();
 }
 
 //-*****************************************************************************
 XformOp::XformOp( const XformOperationType iType,
                   const Alembic::Util::uint8_t iHint )
     : m_type( iType )
+    , m_numChannels( 0 )
+    , m_animChannels( 0 )
 {
-    m_channels.clear();
-
-    switch ( m_type )
-    {
-    case kRotateXOperation:
-    case kRotateYOperation:
-    case kRotateZOperation:
-        m_channels.resize( 1 );
-        break;
-    case kScaleOperation:
-    case kTranslateOperation:
-        m_channels.resize( 3 );
-        break;
-    case kRotateOperation:
-        m_channels.resize( 4 );
-        break;
-    case kMatrixOperation:
-        m_channels.resize( 16 );
-        break;
-    }
+    setNumChannels();
 
     setHint( iHint );
 }
 
 //-*****************************************************************************
 XformOp::XformOp( const Alembic::Util::uint8_t iEncodedOp )
+    : m_numChannels( 0 )
+    , m_animChannels( 0 )
 {
 
     m_type = (XformOperationType)(iEncodedOp >> 4);
     setHint( iEncodedOp & 0xF );
-
-    switch ( m_type )
-    {
-    case kRotateXOperation:
-    case kRotateYOperation:
-    case kRotateZOperation:
-        m_channels.resize( 1 );
-        break;
-    case kScaleOperation:
-    case kTranslateOperation:
-        m_channels.resize( 3 );
-        break;
-    case kRotateOperation:
-        m_channels.resize( 4 );
-        break;
-    case kMatrixOperation:
-        m_channels.resize( 16 );
-        break;
-    }
+    setNumChannels();
 }
 
 //-*****************************************************************************
@@ -117,24 +85,38 @@ void XformOp::setType( const XformOperationType iType )
     m_type = iType;
     m_hint = 0;
 
+    setNumChannels();
+}
+
+//-*****************************************************************************
+void XformOp::setNumChannels()
+{
+    std::size_t numChannels = 0;
     switch ( m_type )
     {
     case kRotateXOperation:
     case kRotateYOperation:
     case kRotateZOperation:
-        m_channels.resize( 1 );
+        numChannels = 1;
         break;
     case kScaleOperation:
     case kTranslateOperation:
-        m_channels.resize( 3 );
+        numChannels = 3;
         break;
     case kRotateOperation:
-        m_channels.resize( 4 );
+        numChannels = 4;
         break;
     case kMatrixOperation:
-        m_channels.resize( 16 );
+        numChannels = 16;
         break;
     }
+
+    // like resizing a vector, channels which weren't there before are 0
+    for ( std::size_t i = m_numChannels; i < numChannels; ++i )
+    {
+        m_channels[i] = 0.0;
+    }
+    m_numChannels = ( Alembic::Util::uint8_t ) numChannels;
 }
 
 //-*****************************************************************************
@@ -181,7 +163,7 @@ bool XformOp::isXAnimated() const
         return false;
     }
 
-    return m_animChannels.count( 0 ) > 0;
+    return isChannelAnimated( 0 );
 }
 
 //-*****************************************************************************
@@ -193,7 +175,7 @@ bool XformOp::isYAnimated() const
         return false;
     }
 
-    return m_animChannels.count( 1 ) > 0;
+    return isChannelAnimated( 1 );
 }
 
 //-*****************************************************************************
@@ -205,7 +187,7 @@ bool XformOp::isZAnimated() const
         return false;
     }
 
-    return m_animChannels.count( 2 ) > 0;
+    return isChannelAnimated( 2 );
 }
 
 //-*****************************************************************************
@@ -214,22 +196,22 @@ bool XformOp::isAngleAnimated() const
     if ( m_type == kRotateXOperation || m_type == kRotateYOperation ||
          m_type == kRotateZOperation )
     {
-        return m_animChannels.count( 0 ) > 0;
+        return isChannelAnimated( 0 );
     }
 
-    return m_animChannels.count( 3 ) > 0;
+    return isChannelAnimated( 3 );
 }
 
 //-*****************************************************************************
 bool XformOp::isChannelAnimated( std::size_t iIndex ) const
 {
-    return m_animChannels.count( iIndex ) > 0;
+    return iIndex < MAX_CHANNELS && ( m_animChannels >> iIndex ) & 1;
 }
 
 //-*****************************************************************************
 std::size_t XformOp::getNumChannels() const
 {
-    return m_channels.size();
+    return m_numChannels;
 }
 
 //-*****************************************************************************
@@ -227,16 +227,25 @@ public:
 
 
 private:
+    void setNumChannels();
+
+    //! The most channels any op has, a matrix.
+    static const std::size_t MAX_CHANNELS = 16;
+
     XformOperationType m_type;
     Alembic::Util::uint8_t m_hint;
 
-    std::vector<double> m_channels;
+    //! Kept in the op, instead of on the heap, so that samples can be
+    //! copied and read into without allocating anything for each op.
+    Alembic::Util::uint8_t m_numChannels;
+    double m_channels[MAX_CHANNELS];
 
-    std::set<Alembic::Util::uint32_t> m_animChannels;
+    //! Bit i is set when channel i is animated.
+    Alembic::Util::uint16_t m_animChannels;
 
 private:
     //! The IXform can tell the op if its channels are animated
-    //! by directly inserting keys into the m_animChannels set.
+    //! by directly setting bits in m_animChannels.
     friend class IXformSchema;
 
 };
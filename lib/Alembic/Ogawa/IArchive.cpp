@@ -47,6 +47,14 @@ IArchive::IArchive(const std::string & iFileName,
     init();
 }
 
+IArchive::IArchive(const std::string & iFileName,
+                   std::size_t iNumStreams,
+                   ReadStrategy iStrategy) :
+    mStreams(new IStreams(iFileName, iNumStreams, iStrategy))
+{
+    init();
+}
+
 IArchive::IArchive(const std::vector< std::istream * > & iStreams) :
     mStreams(new IStreams(iStreams))
 {
@@ -87,6 +95,47 @@ IGroupPtr IArchive::getGroup() const
     return mGroup;
 }
 
+IGroupPtr IArchive::getGroup(Alembic::Util::uint64_t iPos, bool iLight,
+                             std::size_t iThreadIndex) const
+{
+    IGroupPtr group;
+
+    // same sanity check as IGroup::getGroup, plus it has to fit in the file
+    if (mStreams->isValid() && (iPos & EMPTY_DATA) == 0 && iPos > 8 &&
+        iPos + 8 <= mStreams->getSize())
+    {
+        group.reset(new IGroup(mStreams, iPos, iLight, iThreadIndex));
+    }
+
+    return group;
+}
+
+void IArchive::setBlockCache(Alembic::Util::uint64_t iMaxBytes,
+                             Alembic::Util::uint64_t iBlockSize)
+{
+    mStreams->setBlockCache(iMaxBytes, iBlockSize);
+}
+
+Alembic::Util::uint64_t IArchive::getBlockCacheHits() const
+{
+    return mStreams->getBlockCacheHits();
+}
+
+Alembic::Util::uint64_t IArchive::getBlockCacheMisses() const
+{
+    return mStreams->getBlockCacheMisses();
+}
+
+Alembic::Util::uint64_t IArchive::getBlockCacheBytes() const
+{
+    return mStreams->getBlockCacheBytes();
+}
+
+void IArchive::clearBlockCache() const
+{
+    mStreams->clearBlockCache();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
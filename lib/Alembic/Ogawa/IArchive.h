@@ -53,6 +53,9 @@ public:
     IArchive(const std::string & iFileName,
              std::size_t iNumStreams=1,
              bool iUseMMap=true);
+    IArchive(const std::string & iFileName,
+             std::size_t iNumStreams,
+             ReadStrategy iStrategy);
     IArchive(const std::vector< std::istream * > & iStreams);
     ~IArchive();
 
@@ -64,6 +67,24 @@ public:
 
     IGroupPtr getGroup() const;
 
+    // the group at iPos (see OGroup::getPos), or an empty pointer if iPos
+    // can't be the position of a group in this archive
+    IGroupPtr getGroup(Alembic::Util::uint64_t iPos, bool iLight,
+                       std::size_t iThreadIndex) const;
+
+    // see IStreams::setBlockCache
+    void setBlockCache(Alembic::Util::uint64_t iMaxBytes,
+                       Alembic::Util::uint64_t iBlockSize = 65536);
+
+    Alembic::Util::uint64_t getBlockCacheHits() const;
+
+    Alembic::Util::uint64_t getBlockCacheMisses() const;
+
+    // see IStreams::getBlockCacheBytes and IStreams::clearBlockCache
+    Alembic::Util::uint64_t getBlockCacheBytes() const;
+
+    void clearBlockCache() const;
+
 private:
     void init();
     IStreamsPtr mStreams;
@@ -104,6 +104,59 @@ void IData::read(Alembic::Util::uint64_t iSize, void * iData,
     mData->streams->read(iThreadId, mData->pos + iOffset + 8, iSize, iData);
 }
 
+const void * IData::getMappedData(Alembic::Util::uint64_t iSize,
+                                  Alembic::Util::uint64_t iOffset) const
+{
+    if (iSize == 0 || mData->size == 0 || iOffset + iSize > mData->size)
+    {
+        return NULL;
+    }
+
+    // +8 is to account for the size
+    return mData->streams->getMappedData(mData->pos + iOffset + 8, iSize);
+}
+
+void ReadBatch(const std::vector< IDataRead > & iReads,
+               std::size_t iThreadId)
+{
+    IStreamsPtr streams;
+    std::vector< ReadRange > ranges;
+    ranges.reserve(iReads.size());
+    for (std::size_t i = 0; i < iReads.size(); ++i)
+    {
+        const IDataRead & r = iReads[i];
+
+        // like IData::read, skip anything which reads beyond the data
+        if (!r.data || r.size == 0 || r.data->mData->size == 0 ||
+            r.offset + r.size > r.data->mData->size)
+        {
+            continue;
+        }
+
+        if (!streams)
+        {
+            streams = r.data->mData->streams;
+        }
+        else if (streams != r.data->mData->streams)
+        {
+            throw std::runtime_error(
+                "Ogawa ReadBatch given data from different archives.");
+        }
+
+        // +8 is to account for the size
+        ReadRange range;
+        range.pos = r.data->mData->pos + r.offset + 8;
+        range.size = r.size;
+        range.buf = r.buf;
+        ranges.push_back(range);
+    }
+
+    if (streams)
+    {
+        streams->readRanges(iThreadId, ranges);
+    }
+}
+
 Alembic::Util::uint64_t IData::getSize() const
 {
     return mData->size;
@@ -44,6 +44,23 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+class IData;
+typedef Alembic::Util::shared_ptr< IData > IDataPtr;
+
+// one read for ReadBatch, like IData::read
+struct IDataRead
+{
+    IDataPtr data;
+    Alembic::Util::uint64_t size;
+    void * buf;
+    Alembic::Util::uint64_t offset;
+};
+
+// does all of the reads, which have to be of IData from the same archive.
+// Reads of IData which are close together in the file are merged.
+ALEMBIC_EXPORT void ReadBatch(const std::vector< IDataRead > & iReads,
+                              std::size_t iThreadId);
+
 class ALEMBIC_EXPORT IData
 {
 public:
@@ -55,12 +72,20 @@ public:
 
     Alembic::Util::uint64_t getSize() const;
 
+    // returns a pointer to iSize bytes of the data starting at iOffset when
+    // the file is memory mapped, otherwise NULL.  The pointer is valid for
+    // as long as this IData is, no copy of the data is made.
+    const void * getMappedData(Alembic::Util::uint64_t iSize,
+                               Alembic::Util::uint64_t iOffset) const;
+
     // not really necessary for most workflows, it could be used by some
     // Ogawa utilities to detect when this IData is shared
     Alembic::Util::uint64_t getPos() const;
 
 private:
     friend class IGroup;
+    friend void ReadBatch(const std::vector< IDataRead > & iReads,
+                          std::size_t iThreadId);
     IData(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos,
           std::size_t iThreadId);
 
@@ -68,8 +93,6 @@ private:
     Alembic::Util::unique_ptr< PrivateData > mData;
 };
 
-typedef Alembic::Util::shared_ptr< IData > IDataPtr;
-
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
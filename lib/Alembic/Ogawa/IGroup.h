@@ -68,6 +68,9 @@ public:
 
     bool isLight() const;
 
+    // where this group is in the stream, see IArchive::getGroup
+    Alembic::Util::uint64_t getPos() const;
+
 private:
     friend class IArchive;
     IGroup(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos, bool iLight,
@@ -34,6 +34,8 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/IStreams.h>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <stdexcept>
 
@@ -85,6 +87,21 @@ public:
 
     // not all streams have a size
     virtual Alembic::Util::uint64_t size() {return 0xffffffffffffffff;};
+
+    // only readers which have the whole file in memory can hand out
+    // pointers into it
+    virtual const void * getMappedData(Alembic::Util::uint64_t,
+                                       Alembic::Util::uint64_t)
+    {
+        return NULL;
+    }
+
+    // whether small reads are worth serving from the block cache, which
+    // needs to know how big the file is so blocks don't read past the end
+    virtual bool useBlockCache()
+    {
+        return size() != 0xffffffffffffffff;
+    }
 };
 
 typedef Alembic::Util::shared_ptr<IStreamReader> IStreamReaderPtr;
@@ -151,7 +168,7 @@ private:
 
 class FileIStreamReader : public IStreamReader
 {
-private:
+protected:
 
 // Platform support functions for file access
 #ifdef _WIN32
@@ -377,12 +394,180 @@ public:
         return readFile(fid, oBuf, iPos, iSize);
     }
 
-private:
+protected:
     FileDescriptor fid;
     size_t nstreams;
     Alembic::Util::uint64_t fileLen;
 };
 
+#ifndef _WIN32
+
+// Reads large blocks with O_DIRECT (F_NOCACHE on OSX) so they neither go
+// through nor evict anything from the file cache.  Direct reads have to be
+// aligned in the file and in memory, so the aligned middle of a large read
+// goes through a pool of aligned bounce buffers (or straight into oBuf when
+// it happens to line up), while the unaligned edges and small reads, which
+// are mostly headers and other metadata, go through the normal descriptor.
+class DirectIStreamReader : public FileIStreamReader
+{
+public:
+    // alignment of the file offsets, sizes and memory of direct reads
+    static const Alembic::Util::uint64_t ALIGNMENT = 4096;
+
+    // reads smaller than this are left to the file cache
+    static const Alembic::Util::uint64_t MIN_DIRECT_SIZE = 1024 * 1024;
+
+    static const std::size_t BOUNCE_SIZE = 4 * 1024 * 1024;
+
+    DirectIStreamReader(const std::string& iFileName, std::size_t iNumStreams)
+        : FileIStreamReader(iFileName, iNumStreams), directFid(-1)
+    {
+        if (!isOpen())
+        {
+            return;
+        }
+
+#if defined(O_DIRECT)
+        directFid = openFile(iFileName.c_str(), O_RDONLY | O_DIRECT);
+#elif defined(F_NOCACHE)
+        directFid = openFile(iFileName.c_str(), O_RDONLY);
+        if (directFid > -1 && fcntl(directFid, F_NOCACHE, 1) == -1)
+        {
+            closeFile(directFid);
+            directFid = -1;
+        }
+#endif
+        // if the file system doesn't allow direct reads then everything
+        // goes through the file cache
+    }
+
+    ~DirectIStreamReader()
+    {
+        closeFile(directFid);
+        for (std::size_t i = 0; i < bounceBuffers.size(); ++i)
+        {
+            free(bounceBuffers[i]);
+        }
+    }
+
+    bool read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
+              Alembic::Util::uint64_t iSize, void* oBuf)
+    {
+        if (directFid < 0 || iSize < MIN_DIRECT_SIZE)
+        {
+            return FileIStreamReader::read(iThreadId, iPos, iSize, oBuf);
+        }
+
+        if (iPos > fileLen || iSize > fileLen - iPos)
+        {
+            return false;
+        }
+
+        Alembic::Util::uint64_t end = iPos + iSize;
+        Alembic::Util::uint64_t alignedPos =
+            (iPos + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        Alembic::Util::uint64_t alignedEnd = end & ~(ALIGNMENT - 1);
+        char * buf = static_cast< char * >(oBuf);
+
+        if (alignedPos > iPos &&
+            !readFile(fid, buf, iPos, alignedPos - iPos))
+        {
+            return false;
+        }
+
+        if (end > alignedEnd &&
+            !readFile(fid, buf + (alignedEnd - iPos), alignedEnd,
+                      end - alignedEnd))
+        {
+            return false;
+        }
+
+        char * middle = buf + (alignedPos - iPos);
+        Alembic::Util::uint64_t middleSize = alignedEnd - alignedPos;
+        if (readDirect(middle, alignedPos, middleSize))
+        {
+            return true;
+        }
+
+        // some file systems only allow direct reads with a bigger alignment
+        return readFile(fid, middle, alignedPos, middleSize);
+    }
+
+private:
+    bool readDirect(char * oBuf, Alembic::Util::uint64_t iPos,
+                    Alembic::Util::uint64_t iSize)
+    {
+        if (reinterpret_cast< std::size_t >(oBuf) % ALIGNMENT == 0)
+        {
+            return readFile(directFid, oBuf, iPos, iSize);
+        }
+
+        char * bounce = acquireBuffer();
+        if (!bounce)
+        {
+            return false;
+        }
+
+        bool success = true;
+        for (Alembic::Util::uint64_t done = 0; success && done < iSize;
+             done += BOUNCE_SIZE)
+        {
+            Alembic::Util::uint64_t numBytes = iSize - done;
+            if (numBytes > BOUNCE_SIZE)
+            {
+                numBytes = BOUNCE_SIZE;
+            }
+
+            success = readFile(directFid, bounce, iPos + done, numBytes);
+            if (success)
+            {
+                memcpy(oBuf + done, bounce, numBytes);
+            }
+        }
+
+        releaseBuffer(bounce);
+        return success;
+    }
+
+    // the pool only grows to as many buffers as there are concurrent reads
+    char * acquireBuffer()
+    {
+        {
+            Alembic::Util::scoped_lock l(bounceLock);
+            if (!freeBuffers.empty())
+            {
+                char * buf = freeBuffers.back();
+                freeBuffers.pop_back();
+                return buf;
+            }
+        }
+
+        void * buf = NULL;
+        if (posix_memalign(&buf, ALIGNMENT, BOUNCE_SIZE) != 0)
+        {
+            return NULL;
+        }
+
+        Alembic::Util::scoped_lock l(bounceLock);
+        bounceBuffers.push_back(static_cast< char * >(buf));
+        return static_cast< char * >(buf);
+    }
+
+    void releaseBuffer(char * iBuf)
+    {
+        Alembic::Util::scoped_lock l(bounceLock);
+        freeBuffers.push_back(iBuf);
+    }
+
+    FileDescriptor directFid;
+
+    Alembic::Util::mutex bounceLock;
+    std::vector< char * > bounceBuffers;
+    std::vector< char * > freeBuffers;
+};
+
+#endif
+
 
 
 class MemoryMappedIStreamReader : public IStreamReader
@@ -615,6 +800,23 @@ public:
         return true;
     }
 
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize)
+    {
+        if (iPos > mappedRegion.len || iSize > mappedRegion.len - iPos)
+        {
+            return NULL;
+        }
+
+        return static_cast<const char*>(mappedRegion.p) + iPos;
+    }
+
+    // already in memory
+    bool useBlockCache()
+    {
+        return false;
+    }
+
 private:
     std::size_t nstreams;
     std::string fileName;
@@ -626,15 +828,23 @@ private:
 IStreamReaderPtr constructStreamReader(
     const std::string & iFileName,
     std::size_t iNumStreams,
-    bool iUseMMap)
+    ReadStrategy iStrategy)
 {
     // if allowed by the options, use memory mapped file access
-    if (iUseMMap)
+    if (iStrategy == kMemoryMappedReads)
     {
         return IStreamReaderPtr(
             new MemoryMappedIStreamReader(iFileName, iNumStreams));
     }
 
+#ifndef _WIN32
+    if (iStrategy == kDirectReads)
+    {
+        return IStreamReaderPtr(
+            new DirectIStreamReader(iFileName, iNumStreams));
+    }
+#endif
+
     // otherwise, use file streams
     return IStreamReaderPtr(new FileIStreamReader(iFileName, iNumStreams));
 }
@@ -651,6 +861,162 @@ IStreamReaderPtr constructStreamReader(
 
 
 
+namespace
+{
+
+// Keeps whole, aligned blocks of the file around so that the many small
+// reads of headers, child tables and sizes that are close together in the
+// file only go to the file once.  The least recently used blocks are dropped
+// once they take up more than the byte budget.
+class BlockCache
+{
+public:
+    BlockCache() : maxBytes(0), blockSize(65536), numBytes(0), hits(0),
+        misses(0) {}
+
+    void setSize(Alembic::Util::uint64_t iMaxBytes,
+                 Alembic::Util::uint64_t iBlockSize)
+    {
+        Alembic::Util::scoped_lock l(lock);
+        blockSize = iBlockSize > 0 ? iBlockSize : 1;
+        maxBytes = iMaxBytes;
+        blocks.clear();
+        blockMap.clear();
+        numBytes = 0;
+    }
+
+    // returns false if the read should go straight to the reader
+    bool read(IStreamReader & iReader, std::size_t iThreadId,
+              Alembic::Util::uint64_t iPos, Alembic::Util::uint64_t iSize,
+              Alembic::Util::uint64_t iFileSize, void * oBuf)
+    {
+        // checked without the lock, so reads don't queue up on it when
+        // the cache is off, which it is unless setSize turned it on
+        if (maxBytes == 0)
+        {
+            return false;
+        }
+
+        Alembic::Util::uint64_t bs = blockSize;
+        if (iSize >= bs || iSize == 0 || iPos + iSize > iFileSize)
+        {
+            return false;
+        }
+
+        // a read smaller than a block touches at most 2 of them
+        char * buf = static_cast< char * >(oBuf);
+        Alembic::Util::uint64_t end = iPos + iSize;
+        for (Alembic::Util::uint64_t b = iPos / bs; b * bs < end; ++b)
+        {
+            Alembic::Util::uint64_t blockPos = b * bs;
+            BlockPtr block = getBlock(iReader, iThreadId, blockPos,
+                std::min(bs, iFileSize - blockPos));
+            if (!block)
+            {
+                return false;
+            }
+
+            Alembic::Util::uint64_t start = std::max(iPos, blockPos);
+            Alembic::Util::uint64_t stop = std::min(end, blockPos + bs);
+            memcpy(buf + (start - iPos), &((*block)[start - blockPos]),
+                   stop - start);
+        }
+
+        return true;
+    }
+
+    Alembic::Util::uint64_t getHits()
+    {
+        Alembic::Util::scoped_lock l(lock);
+        return hits;
+    }
+
+    Alembic::Util::uint64_t getMisses()
+    {
+        Alembic::Util::scoped_lock l(lock);
+        return misses;
+    }
+
+    Alembic::Util::uint64_t getNumBytes()
+    {
+        Alembic::Util::scoped_lock l(lock);
+        return numBytes;
+    }
+
+    // drops all the blocks but keeps the budget
+    void clear()
+    {
+        Alembic::Util::scoped_lock l(lock);
+        blocks.clear();
+        blockMap.clear();
+        numBytes = 0;
+    }
+
+private:
+    typedef Alembic::Util::shared_ptr< std::vector< char > > BlockPtr;
+    typedef std::list< std::pair< Alembic::Util::uint64_t, BlockPtr > >
+        BlockList;
+
+    BlockPtr getBlock(IStreamReader & iReader, std::size_t iThreadId,
+                      Alembic::Util::uint64_t iPos,
+                      Alembic::Util::uint64_t iSize)
+    {
+        {
+            Alembic::Util::scoped_lock l(lock);
+            std::map< Alembic::Util::uint64_t, BlockList::iterator >::iterator
+                it = blockMap.find(iPos);
+            if (it != blockMap.end())
+            {
+                // move it to the front as the most recently used
+                blocks.splice(blocks.begin(), blocks, it->second);
+                ++hits;
+                return it->second->second;
+            }
+            ++misses;
+        }
+
+        // read without holding the lock, other threads may read the same
+        // block in the meantime, whoever is first gets to keep theirs
+        BlockPtr block(new std::vector< char >(iSize));
+        if (!iReader.read(iThreadId, iPos, iSize, &(block->front())))
+        {
+            return BlockPtr();
+        }
+
+        Alembic::Util::scoped_lock l(lock);
+        if (blockMap.find(iPos) == blockMap.end())
+        {
+            blocks.push_front(std::make_pair(iPos, block));
+            blockMap[iPos] = blocks.begin();
+            numBytes += iSize;
+
+            while (numBytes > maxBytes && !blocks.empty())
+            {
+                numBytes -= blocks.back().second->size();
+                blockMap.erase(blocks.back().first);
+                blocks.pop_back();
+            }
+        }
+
+        return block;
+    }
+
+    Alembic::Util::mutex lock;
+
+    // only changed by setSize, while holding the lock
+    std::atomic< Alembic::Util::uint64_t > maxBytes;
+    std::atomic< Alembic::Util::uint64_t > blockSize;
+    Alembic::Util::uint64_t numBytes;
+    Alembic::Util::uint64_t hits;
+    Alembic::Util::uint64_t misses;
+
+    // most recently used are at the front
+    BlockList blocks;
+    std::map< Alembic::Util::uint64_t, BlockList::iterator > blockMap;
+};
+
+}
+
 class IStreams::PrivateData
 {
 public:
@@ -735,6 +1101,7 @@ public:
     Alembic::Util::uint64_t size;
 
     IStreamReaderPtr reader;
+    BlockCache blockCache;
 };
 
 IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams,
@@ -742,7 +1109,16 @@ IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams,
     mData(new IStreams::PrivateData())
 {
     IStreamReaderPtr reader = constructStreamReader(iFileName, iNumStreams,
-                                                    iUseMMap);
+        iUseMMap ? kMemoryMappedReads : kFileReads);
+    mData->init(reader, 1);
+}
+
+IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams,
+                   ReadStrategy iStrategy) :
+    mData(new IStreams::PrivateData())
+{
+    IStreamReaderPtr reader = constructStreamReader(iFileName, iNumStreams,
+                                                    iStrategy);
     mData->init(reader, 1);
 }
 
@@ -785,6 +1161,12 @@ void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
         return;
     }
 
+    if (mData->blockCache.read(*(mData->reader), iThreadId, iPos, iSize,
+                               mData->size, oBuf))
+    {
+        return;
+    }
+
     bool success = mData->reader->read(iThreadId, iPos, iSize, oBuf);
     if (!success)
     {
@@ -793,6 +1175,122 @@ void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
     }
 }
 
+namespace
+{
+
+// ranges bigger than this are read on their own
+const Alembic::Util::uint64_t MAX_MERGED_RANGE = 1024 * 1024;
+
+// ranges further apart than this are read separately
+const Alembic::Util::uint64_t MAX_MERGE_GAP = 64 * 1024;
+
+// the most we will read at once when merging ranges
+const Alembic::Util::uint64_t MAX_MERGED_READ = 8 * 1024 * 1024;
+
+bool rangeLess(const ReadRange & iA, const ReadRange & iB)
+{
+    return iA.pos < iB.pos;
+}
+
+}
+
+void IStreams::readRanges(std::size_t iThreadId,
+                          const std::vector< ReadRange > & iRanges)
+{
+    std::vector< ReadRange > ranges;
+    ranges.reserve(iRanges.size());
+    for (std::size_t i = 0; i < iRanges.size(); ++i)
+    {
+        if (iRanges[i].size > 0)
+        {
+            ranges.push_back(iRanges[i]);
+        }
+    }
+    std::sort(ranges.begin(), ranges.end(), rangeLess);
+
+    std::vector< char > merged;
+    std::size_t i = 0;
+    while (i < ranges.size())
+    {
+        // find the ranges which can be read along with this one
+        Alembic::Util::uint64_t start = ranges[i].pos;
+        Alembic::Util::uint64_t end = start + ranges[i].size;
+        std::size_t j = i + 1;
+        if (ranges[i].size <= MAX_MERGED_RANGE)
+        {
+            while (j < ranges.size() && ranges[j].size <= MAX_MERGED_RANGE &&
+                   ranges[j].pos <= end + MAX_MERGE_GAP &&
+                   ranges[j].pos + ranges[j].size - start <= MAX_MERGED_READ)
+            {
+                if (ranges[j].pos + ranges[j].size > end)
+                {
+                    end = ranges[j].pos + ranges[j].size;
+                }
+                ++j;
+            }
+        }
+
+        if (j == i + 1)
+        {
+            read(iThreadId, ranges[i].pos, ranges[i].size, ranges[i].buf);
+        }
+        else
+        {
+            merged.resize(end - start);
+            read(iThreadId, start, end - start, &(merged.front()));
+            for (std::size_t k = i; k < j; ++k)
+            {
+                memcpy(ranges[k].buf, &(merged[ranges[k].pos - start]),
+                       ranges[k].size);
+            }
+        }
+
+        i = j;
+    }
+}
+
+void IStreams::setBlockCache(Alembic::Util::uint64_t iMaxBytes,
+                             Alembic::Util::uint64_t iBlockSize)
+{
+    if (!isValid() || !mData->reader->useBlockCache())
+    {
+        return;
+    }
+
+    mData->blockCache.setSize(iMaxBytes, iBlockSize);
+}
+
+Alembic::Util::uint64_t IStreams::getBlockCacheHits()
+{
+    return mData->blockCache.getHits();
+}
+
+Alembic::Util::uint64_t IStreams::getBlockCacheMisses()
+{
+    return mData->blockCache.getMisses();
+}
+
+Alembic::Util::uint64_t IStreams::getBlockCacheBytes()
+{
+    return mData->blockCache.getNumBytes();
+}
+
+void IStreams::clearBlockCache()
+{
+    mData->blockCache.clear();
+}
+
+const void * IStreams::getMappedData(Alembic::Util::uint64_t iPos,
+                                     Alembic::Util::uint64_t iSize)
+{
+    if (!isValid())
+    {
+        return NULL;
+    }
+
+    return mData->reader->getMappedData(iPos, iSize);
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
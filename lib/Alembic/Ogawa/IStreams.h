@@ -40,17 +40,38 @@
 #include <Alembic/Ogawa/Foundation.h>
 
 #include <istream>
+#include <vector>
 
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+// how a file is read, kDirectReads bypasses the file cache for large reads
+// on platforms which allow it and otherwise behaves like kFileReads
+enum ReadStrategy
+{
+    kFileReads,
+    kMemoryMappedReads,
+    kDirectReads
+};
+
+// one read for IStreams::readRanges
+struct ReadRange
+{
+    Alembic::Util::uint64_t pos;
+    Alembic::Util::uint64_t size;
+    void * buf;
+};
+
 class ALEMBIC_EXPORT IStreams
 {
 public:
     IStreams(const std::string & iFileName,
              std::size_t iNumStreams=1,
              bool iUseMMap=true);
+    IStreams(const std::string & iFileName,
+             std::size_t iNumStreams,
+             ReadStrategy iStrategy);
     IStreams(const std::vector< std::istream * > & iStreams);
     ~IStreams();
 
@@ -64,6 +85,32 @@ public:
     void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void * oBuf);
 
+    // reads all of the ranges, small ranges which are close together in the
+    // file are merged into a single read
+    void readRanges(std::size_t iThreadId,
+                    const std::vector< ReadRange > & iRanges);
+
+    // Reads smaller than iBlockSize are served from whole, aligned blocks of
+    // the file which are kept in memory, up to iMaxBytes of them.  0 turns
+    // it off.  Memory mapped files and streams which don't know their size
+    // don't use it.  By default it is off.
+    void setBlockCache(Alembic::Util::uint64_t iMaxBytes,
+                       Alembic::Util::uint64_t iBlockSize = 65536);
+
+    // how many blocks the block cache found, and had to read
+    Alembic::Util::uint64_t getBlockCacheHits();
+    Alembic::Util::uint64_t getBlockCacheMisses();
+
+    // how many bytes the block cache is holding, and dropping all of them
+    Alembic::Util::uint64_t getBlockCacheBytes();
+    void clearBlockCache();
+
+    // returns a pointer to the iSize bytes at iPos when the file is memory
+    // mapped, otherwise NULL.  The pointer is only valid for as long as
+    // this IStreams is.
+    const void * getMappedData(Alembic::Util::uint64_t iPos,
+                               Alembic::Util::uint64_t iSize);
+
 private:
     // noncopyable
     IStreams(const IStreams &);
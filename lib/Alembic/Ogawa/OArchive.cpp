@@ -41,14 +41,14 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-OArchive::OArchive(const std::string & iFileName) :
-    mStream(new OStream(iFileName))
+OArchive::OArchive(const std::string & iFileName, WriteStrategy iStrategy) :
+    mStream(new OStream(iFileName, iStrategy))
 {
     mGroup.reset(new OGroup(mStream));
 }
 
-OArchive::OArchive(std::ostream * iStream) :
-    mStream(new OStream(iStream)), mGroup(new OGroup(mStream))
+OArchive::OArchive(std::ostream * iStream, WriteStrategy iStrategy) :
+    mStream(new OStream(iStream, iStrategy)), mGroup(new OGroup(mStream))
 {
 }
 
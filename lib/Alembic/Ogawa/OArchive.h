@@ -48,8 +48,10 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OArchive
 {
 public:
-    OArchive(const std::string & iFileName);
-    OArchive(std::ostream * iStream);
+    OArchive(const std::string & iFileName,
+             WriteStrategy iStrategy = kSynchronousWrites);
+    OArchive(std::ostream * iStream,
+             WriteStrategy iStrategy = kSynchronousWrites);
     ~OArchive();
 
     OGroupPtr getGroup();
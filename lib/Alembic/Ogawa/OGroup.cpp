@@ -110,11 +110,10 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iSize, const void * iData)
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
-
     Alembic::Util::uint64_t size = iSize;
-    mData->stream->write(&size, 8);
-    mData->stream->write(iData, iSize);
+    const Alembic::Util::uint64_t sizes[2] = { 8, iSize };
+    const void * datas[2] = { &size, iData };
+    Alembic::Util::uint64_t pos = mData->stream->append(2, sizes, datas);
 
     child.reset(new OData(mData->stream, pos, iSize));
 
@@ -156,18 +155,20 @@ ODataPtr OGroup::createData(Alembic::Util::uint64_t iNumData,
         return child;
     }
 
-    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
-
-    mData->stream->write(&totalSize, 8);
+    // the total size goes in front of all the datas
+    std::vector< Alembic::Util::uint64_t > sizes(iNumData + 1);
+    std::vector< const void * > datas(iNumData + 1);
+    sizes[0] = 8;
+    datas[0] = &totalSize;
     for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
     {
-        Alembic::Util::uint64_t size = iSizes[i];
-        if (size != 0)
-        {
-            mData->stream->write(iDatas[i], size);
-        }
+        sizes[i + 1] = iSizes[i];
+        datas[i + 1] = iDatas[i];
     }
 
+    Alembic::Util::uint64_t pos = mData->stream->append(iNumData + 1,
+        &sizes.front(), &datas.front());
+
     child.reset(new OData(mData->stream, pos, totalSize));
 
     return child;
@@ -187,6 +188,34 @@ ODataPtr OGroup::addData(Alembic::Util::uint64_t iNumData,
     return child;
 }
 
+ODataPtr OGroup::createData(IDataPtr iData, std::size_t iThreadId)
+{
+    Alembic::Util::uint64_t size = iData->getSize();
+    const void * data = iData->getMappedData(size, 0);
+
+    std::vector< char > buf;
+    if (!data && size > 0)
+    {
+        buf.resize(size);
+        iData->read(size, &buf.front(), 0, iThreadId);
+        data = &buf.front();
+    }
+
+    return createData(size, data);
+}
+
+ODataPtr OGroup::addData(IDataPtr iData, std::size_t iThreadId)
+{
+    ODataPtr child = createData(iData, iThreadId);
+    if (child)
+    {
+        // flip top bit for data so we can easily distinguish between it and
+        // a group
+        mData->childVec.push_back(child->getPos() | 0x8000000000000000ULL);
+    }
+    return child;
+}
+
 void OGroup::addData(ODataPtr iData)
 {
     if (!isFrozen())
@@ -195,6 +224,14 @@ void OGroup::addData(ODataPtr iData)
     }
 }
 
+void OGroup::addExistingData(Alembic::Util::uint64_t iPos)
+{
+    if (!isFrozen())
+    {
+        mData->childVec.push_back(iPos | 0x8000000000000000ULL);
+    }
+}
+
 void OGroup::addGroup(OGroupPtr iGroup)
 {
     if (!isFrozen())
@@ -245,10 +282,10 @@ void OGroup::freeze()
     }
     else
     {
-        mData->pos = mData->stream->getAndSeekEndPos();
         Alembic::Util::uint64_t size = mData->childVec.size();
-        mData->stream->write(&size, 8);
-        mData->stream->write(&mData->childVec.front(), size*8);
+        const Alembic::Util::uint64_t sizes[2] = { 8, size * 8 };
+        const void * datas[2] = { &size, &mData->childVec.front() };
+        mData->pos = mData->stream->append(2, sizes, datas);
     }
 
     // go through and update each of the parents
@@ -258,14 +295,13 @@ void OGroup::freeze()
         // special group owned by the archive
         if (!it->first && it->second == 0)
         {
-            mData->stream->seek(8);
-            mData->stream->write(&mData->pos, 8);
+            mData->stream->writeAt(8, &mData->pos, 8);
             continue;
         }
         else if (it->first->isFrozen())
         {
-            mData->stream->seek(it->first->mData->pos + (it->second + 1) * 8);
-            mData->stream->write(&mData->pos, 8);
+            mData->stream->writeAt(
+                it->first->mData->pos + (it->second + 1) * 8, &mData->pos, 8);
         }
         it->first->mData->childVec[it->second] = mData->pos;
     }
@@ -279,6 +315,11 @@ bool OGroup::isFrozen()
     return mData->pos != INVALID_GROUP;
 }
 
+Alembic::Util::uint64_t OGroup::getPos() const
+{
+    return mData->pos;
+}
+
 Alembic::Util::uint64_t OGroup::getNumChildren() const
 {
     return mData->childVec.size();
@@ -318,8 +359,7 @@ void OGroup::replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData)
     Alembic::Util::uint64_t pos = iData->getPos() | 0x8000000000000000ULL;
     if (isFrozen())
     {
-        mData->stream->seek(mData->pos + (iIndex + 1) * 8);
-        mData->stream->write(&pos, 8);
+        mData->stream->writeAt(mData->pos + (iIndex + 1) * 8, &pos, 8);
     }
     mData->childVec[iIndex] = pos;
 }
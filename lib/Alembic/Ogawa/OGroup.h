@@ -40,6 +40,7 @@
 #include <Alembic/Ogawa/Foundation.h>
 #include <Alembic/Ogawa/OStream.h>
 #include <Alembic/Ogawa/OData.h>
+#include <Alembic/Ogawa/IData.h>
 
 namespace Alembic {
 namespace Ogawa {
@@ -79,9 +80,22 @@ public:
                         const Alembic::Util::uint64_t * iSizes,
                         const void ** iDatas);
 
+    // write a copy of data read from another archive and add it as a child
+    // to this group, memory mapped data is written without copying it first
+    ODataPtr addData(IDataPtr iData, std::size_t iThreadId);
+
+    // write a copy of data read from another archive but DON'T add it as a
+    // child to this group.
+    // If ODataPtr isn't added to this or any other group, you will
+    // end up abandoning it within the file and waste disk space.
+    ODataPtr createData(IDataPtr iData, std::size_t iThreadId);
+
     // reference existing data
     void addData(ODataPtr iData);
 
+    // reference existing data by its position (see OData::getPos)
+    void addExistingData(Alembic::Util::uint64_t iPos);
+
     // reference an existing group
     void addGroup(OGroupPtr iGroup);
 
@@ -97,6 +111,10 @@ public:
 
     bool isFrozen();
 
+    // where the group is in the stream once it is frozen, this can be handed
+    // to IArchive::getGroup to read it back without going through its parents
+    Alembic::Util::uint64_t getPos() const;
+
     Alembic::Util::uint64_t getNumChildren() const;
 
     bool isChildGroup(Alembic::Util::uint64_t iIndex) const;
@@ -34,8 +34,14 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/OStream.h>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 // for mingw support
 #if defined _WIN32 || defined _WIN64
@@ -46,11 +52,30 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+// contiguous small writes are gathered into blocks of about this size before
+// being handed to the background thread
+const Alembic::Util::uint64_t STAGING_BLOCK_SIZE = 1024 * 1024;
+
+// the caller waits once this much data is queued but not yet written
+const Alembic::Util::uint64_t MAX_QUEUED_BYTES = 64 * 1024 * 1024;
+
+// data waiting to be written to the stream at an already decided position
+struct PendingWrite
+{
+    Alembic::Util::uint64_t pos;
+    std::vector< char > data;
+};
+
+}
+
 class OStream::PrivateData
 {
 public:
     PrivateData(const std::string & iFileName) :
-        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0)
+        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0),
+        background(false), queuedBytes(0), stopWriter(false), failed(false)
     {
 #ifdef _WIN32
         // to wchar_t
@@ -91,7 +116,8 @@ public:
     }
 
     PrivateData(std::ostream * iStream) :
-        stream(iStream), startPos(0), curPos(0), maxPos(0)
+        stream(iStream), startPos(0), curPos(0), maxPos(0),
+        background(false), queuedBytes(0), stopWriter(false), failed(false)
     {
         if (stream)
         {
@@ -108,6 +134,8 @@ public:
 
     ~PrivateData()
     {
+        stopBackground();
+
         // if this was done via file, try to clean it up
         if (!fileName.empty() && stream)
         {
@@ -120,6 +148,161 @@ public:
         }
     }
 
+    void startBackground()
+    {
+        background = true;
+        writer = std::thread(&PrivateData::writeQueued, this);
+    }
+
+    void stopBackground()
+    {
+        if (!writer.joinable())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard< std::mutex > l(queueLock);
+            stopWriter = true;
+        }
+        queueCond.notify_all();
+        writer.join();
+    }
+
+    // write iSize bytes at iPos, the caller must hold lock
+    // synchronous writes have already been seeked to iPos
+    void put(Alembic::Util::uint64_t iPos, const void * iBuf,
+             Alembic::Util::uint64_t iSize)
+    {
+        if (!background)
+        {
+            stream->write((const char *)iBuf, iSize).flush();
+            return;
+        }
+
+        const char * buf = (const char *)iBuf;
+        if (!staging.data.empty() &&
+            staging.pos + staging.data.size() == iPos &&
+            staging.data.size() + iSize <= STAGING_BLOCK_SIZE)
+        {
+            staging.data.insert(staging.data.end(), buf, buf + iSize);
+            return;
+        }
+
+        queueStaging();
+        staging.pos = iPos;
+        staging.data.assign(buf, buf + iSize);
+        if (iSize >= STAGING_BLOCK_SIZE)
+        {
+            queueStaging();
+        }
+    }
+
+    // hand the staged data to the background thread, the caller must
+    // hold lock
+    void queueStaging()
+    {
+        if (staging.data.empty())
+        {
+            return;
+        }
+
+        Alembic::Util::uint64_t size = staging.data.size();
+        std::unique_lock< std::mutex > l(queueLock);
+
+        // a single write bigger than the whole queue is let in once the
+        // queue is empty
+        spaceCond.wait(l, [this, size] {
+            return failed || queuedBytes == 0 ||
+                queuedBytes + size <= MAX_QUEUED_BYTES; });
+
+        checkFailed();
+
+        queue.push_back(PendingWrite());
+        queue.back().pos = staging.pos;
+        queue.back().data.swap(staging.data);
+        queuedBytes += size;
+        l.unlock();
+        queueCond.notify_one();
+    }
+
+    // the caller must hold queueLock
+    void checkFailed()
+    {
+        if (failed)
+        {
+            throw std::runtime_error(
+                "Ogawa background write failed: " + error);
+        }
+    }
+
+    void waitForQueue()
+    {
+        queueStaging();
+        std::unique_lock< std::mutex > l(queueLock);
+        spaceCond.wait(l, [this] { return failed || queuedBytes == 0; });
+        checkFailed();
+    }
+
+    void writeQueued()
+    {
+        std::unique_lock< std::mutex > l(queueLock);
+        for (;;)
+        {
+            queueCond.wait(l, [this] { return stopWriter || !queue.empty(); });
+            if (queue.empty())
+            {
+                break;
+            }
+
+            PendingWrite pending;
+            pending.pos = queue.front().pos;
+            pending.data.swap(queue.front().data);
+            queue.pop_front();
+            l.unlock();
+
+            std::string what;
+            try
+            {
+                if (!failed)
+                {
+                    stream->seekp(pending.pos + startPos);
+                    stream->write(&pending.data.front(), pending.data.size());
+                }
+            }
+            catch (std::exception & e)
+            {
+                what = e.what();
+            }
+            catch (...)
+            {
+                what = "unknown error";
+            }
+
+            l.lock();
+            if (!what.empty() && !failed)
+            {
+                failed = true;
+                error = what;
+            }
+            queuedBytes -= pending.data.size();
+            spaceCond.notify_all();
+        }
+
+        // leave the stream in the same state as synchronous writes would
+        if (!failed)
+        {
+            try
+            {
+                stream->flush();
+            }
+            catch (...)
+            {
+                failed = true;
+            }
+        }
+    }
+
 #if defined _WIN32 || defined _WIN64
     char buffer [STREAM_BUF_SIZE];
 #endif
@@ -129,28 +312,75 @@ public:
     Alembic::Util::uint64_t curPos;
     Alembic::Util::uint64_t maxPos;
     Alembic::Util::mutex lock;
+
+    // only used by kBackgroundWrites, staging is guarded by lock, the rest
+    // by queueLock
+    bool background;
+    PendingWrite staging;
+    std::deque< PendingWrite > queue;
+    Alembic::Util::uint64_t queuedBytes;
+    bool stopWriter;
+    bool failed;
+    std::string error;
+    std::mutex queueLock;
+    std::condition_variable queueCond;
+    std::condition_variable spaceCond;
+    std::thread writer;
 };
 
-OStream::OStream(const std::string & iFileName) :
+OStream::OStream(const std::string & iFileName, WriteStrategy iStrategy) :
     mData(new PrivateData(iFileName))
 {
     init();
+    if (isValid() && iStrategy == kBackgroundWrites)
+    {
+        mData->startBackground();
+    }
 }
 
 // we'll be writing from this already open stream which we don't own
-OStream::OStream(std::ostream * iStream) : mData(new PrivateData(iStream))
+OStream::OStream(std::ostream * iStream, WriteStrategy iStrategy) :
+    mData(new PrivateData(iStream))
 {
     init();
+    if (isValid() && iStrategy == kBackgroundWrites)
+    {
+        mData->startBackground();
+    }
 }
 
 OStream::~OStream()
 {
-    // write our "frozen" byte (totally done writing)
-    if (isValid())
+    if (!isValid())
     {
-        char frozen = 0xff;
-        mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
+        return;
     }
+
+    // everything else has to be on disk before the archive is marked done
+    if (mData->background)
+    {
+        {
+            Alembic::Util::scoped_lock l(mData->lock);
+            try
+            {
+                mData->queueStaging();
+            }
+            catch (...)
+            {
+            }
+        }
+        mData->stopBackground();
+
+        // a write failed, so leave the archive unfinished
+        if (mData->failed)
+        {
+            return;
+        }
+    }
+
+    // write our "frozen" byte (totally done writing)
+    char frozen = 0xff;
+    mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
 }
 
 bool OStream::isValid()
@@ -197,7 +427,10 @@ Alembic::Util::uint64_t OStream::getAndSeekEndPos()
         Alembic::Util::scoped_lock l(mData->lock);
 
         mData->curPos = mData->maxPos;
-        mData->stream->seekp(mData->curPos + mData->startPos);
+        if (!mData->background)
+        {
+            mData->stream->seekp(mData->curPos + mData->startPos);
+        }
         return mData->curPos;
     }
     return 0;
@@ -208,7 +441,10 @@ void OStream::seek(Alembic::Util::uint64_t iPos)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->seekp(iPos + mData->startPos);
+        if (!mData->background)
+        {
+            mData->stream->seekp(iPos + mData->startPos);
+        }
         mData->curPos = iPos;
     }
 }
@@ -218,7 +454,7 @@ void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->write((const char *)iBuf, iSize).flush();
+        mData->put(mData->curPos, iBuf, iSize);
         mData->curPos += iSize;
         if(mData->curPos > mData->maxPos)
         {
@@ -227,6 +463,66 @@ void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
     }
 }
 
+Alembic::Util::uint64_t OStream::append(Alembic::Util::uint64_t iNumData,
+                                        const Alembic::Util::uint64_t * iSizes,
+                                        const void * const * iDatas)
+{
+    if (!isValid())
+    {
+        return 0;
+    }
+
+    Alembic::Util::scoped_lock l(mData->lock);
+    Alembic::Util::uint64_t pos = mData->maxPos;
+    if (!mData->background && mData->curPos != pos)
+    {
+        mData->stream->seekp(pos + mData->startPos);
+    }
+
+    mData->curPos = pos;
+    for (Alembic::Util::uint64_t i = 0; i < iNumData; ++i)
+    {
+        if (iSizes[i] != 0)
+        {
+            mData->put(mData->curPos, iDatas[i], iSizes[i]);
+            mData->curPos += iSizes[i];
+        }
+    }
+    mData->maxPos = mData->curPos;
+    return pos;
+}
+
+void OStream::writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                      Alembic::Util::uint64_t iSize)
+{
+    if (!isValid())
+    {
+        return;
+    }
+
+    Alembic::Util::scoped_lock l(mData->lock);
+    if (!mData->background && mData->curPos != iPos)
+    {
+        mData->stream->seekp(iPos + mData->startPos);
+    }
+
+    mData->put(iPos, iBuf, iSize);
+    mData->curPos = iPos + iSize;
+    if(mData->curPos > mData->maxPos)
+    {
+        mData->maxPos = mData->curPos;
+    }
+}
+
+void OStream::flush()
+{
+    if (isValid() && mData->background)
+    {
+        Alembic::Util::scoped_lock l(mData->lock);
+        mData->waitForQueue();
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
@@ -49,11 +49,22 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+// how a file is written, kBackgroundWrites copies the data into a bounded
+// queue, in the order it was given and at the offsets it was given, and a
+// background thread writes it out so the caller doesn't wait on the disk
+enum WriteStrategy
+{
+    kSynchronousWrites,
+    kBackgroundWrites
+};
+
 class ALEMBIC_EXPORT OStream
 {
 public:
-    OStream(const std::string & iFileName);
-    OStream(std::ostream * iStream);
+    OStream(const std::string & iFileName,
+            WriteStrategy iStrategy = kSynchronousWrites);
+    OStream(std::ostream * iStream,
+            WriteStrategy iStrategy = kSynchronousWrites);
     ~OStream();
 
     bool isValid();
@@ -62,6 +73,22 @@ public:
     void write(const void * iBuf, Alembic::Util::uint64_t iSize);
     void seek(Alembic::Util::uint64_t iPos);
 
+    // These two do their work as one step, so they are safe to use from
+    // multiple threads at once.
+    // append writes the iNumData buffers one after the other at the end of
+    // the stream and returns where the first one starts.
+    Alembic::Util::uint64_t append(Alembic::Util::uint64_t iNumData,
+                                   const Alembic::Util::uint64_t * iSizes,
+                                   const void * const * iDatas);
+
+    // writeAt writes over already written data at iPos
+    void writeAt(Alembic::Util::uint64_t iPos, const void * iBuf,
+                 Alembic::Util::uint64_t iSize);
+
+    // waits until everything queued for the background thread is written,
+    // throws if any of those writes failed
+    void flush();
+
 private:
     // noncopyable
     OStream(const OStream &);
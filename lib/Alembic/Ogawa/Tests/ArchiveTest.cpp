@@ -36,6 +36,8 @@
 
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <fstream>
+#include <sstream>
 
 void test(bool iUseMMap)
 {
@@ -78,10 +80,354 @@ void stringStreamTest()
 }
 
 
+void directReadTest()
+{
+    // big enough to be read directly, with sizes and offsets that don't
+    // line up with the direct read alignment
+    std::vector< std::size_t > sizes;
+    sizes.push_back(7);
+    sizes.push_back(3 * 1024 * 1024 + 13);
+    sizes.push_back(100);
+    sizes.push_back(1024 * 1024);
+    sizes.push_back(9 * 1024 * 1024 + 4095);
+
+    std::vector< std::vector< char > > blocks(sizes.size());
+    {
+        Alembic::Ogawa::OArchive oa("directTest.ogawa");
+        Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            blocks[i].resize(sizes[i]);
+            for (std::size_t j = 0; j < sizes[i]; ++j)
+            {
+                blocks[i][j] = (char)((j * 31 + i) % 251);
+            }
+            top->addData(sizes[i], &(blocks[i].front()));
+        }
+    }
+
+    Alembic::Ogawa::IArchive ia("directTest.ogawa", 2,
+                                Alembic::Ogawa::kDirectReads);
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.isFrozen());
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    TESTING_ASSERT(top->getNumChildren() == sizes.size());
+
+    for (std::size_t i = 0; i < sizes.size(); ++i)
+    {
+        Alembic::Ogawa::IDataPtr data = top->getData(i, 0);
+        TESTING_ASSERT(data->getSize() == sizes[i]);
+
+        // read it all, and also at an odd offset into an odd buffer
+        std::vector< char > buf(sizes[i] + 1);
+        data->read(sizes[i], &(buf.front()), 0, 0);
+        TESTING_ASSERT(memcmp(&(buf.front()), &(blocks[i].front()),
+                              sizes[i]) == 0);
+
+        std::size_t offset = sizes[i] / 3;
+        data->read(sizes[i] - offset, &(buf[1]), offset, 1);
+        TESTING_ASSERT(memcmp(&(buf[1]), &(blocks[i][offset]),
+                              sizes[i] - offset) == 0);
+    }
+
+    // nothing is memory mapped
+    TESTING_ASSERT(!top->getData(1, 0)->getMappedData(16, 0));
+}
+
+void batchReadTest(bool iUseMMap)
+{
+    {
+        Alembic::Ogawa::OArchive oa("batchTest.ogawa");
+        Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            // one big one which won't be merged
+            std::vector< char > buf(i == 5 ? 2 * 1024 * 1024 : i + 1);
+            for (std::size_t j = 0; j < buf.size(); ++j)
+            {
+                buf[j] = (char)(i + j);
+            }
+            top->addData(buf.size(), &(buf.front()));
+        }
+    }
+
+    Alembic::Ogawa::IArchive ia("batchTest.ogawa", 1, iUseMMap);
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+
+    // backwards, with one read twice and partial reads
+    std::vector< std::vector< char > > bufs(12);
+    std::vector< Alembic::Ogawa::IDataRead > reads;
+    for (std::size_t i = 0; i < bufs.size(); ++i)
+    {
+        std::size_t index = i < 10 ? 9 - i : 4;
+        Alembic::Ogawa::IDataRead read;
+        read.data = top->getData(index, 0);
+        read.offset = i == 11 ? 1 : 0;
+        read.size = read.data->getSize() - read.offset;
+        bufs[i].resize(read.size);
+        read.buf = &(bufs[i].front());
+        reads.push_back(read);
+    }
+
+    // reading past the end of the data is ignored, like IData::read
+    Alembic::Ogawa::IDataRead bad = reads[0];
+    bad.offset = 1;
+    reads.push_back(bad);
+
+    Alembic::Ogawa::ReadBatch(reads, 0);
+    for (std::size_t i = 0; i < bufs.size(); ++i)
+    {
+        std::size_t index = i < 10 ? 9 - i : 4;
+        for (std::size_t j = 0; j < bufs[i].size(); ++j)
+        {
+            TESTING_ASSERT(bufs[i][j] == (char)(index + j + reads[i].offset));
+        }
+    }
+}
+
+void blockCacheTest(bool iUseMMap)
+{
+    std::size_t numDatas = 300;
+    {
+        Alembic::Ogawa::OArchive oa("blockCacheTest.ogawa");
+        Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+        for (std::size_t i = 0; i < numDatas; ++i)
+        {
+            // every so often one which is too big for the cache
+            std::vector< char > buf(i % 100 == 50 ? 20000 : 100);
+            for (std::size_t j = 0; j < buf.size(); ++j)
+            {
+                buf[j] = (char)(i * 3 + j);
+            }
+            top->addData(buf.size(), &(buf.front()));
+        }
+    }
+
+    Alembic::Ogawa::IArchive ia("blockCacheTest.ogawa", 1, iUseMMap);
+    ia.setBlockCache(64 * 1024, 4096);
+
+    for (std::size_t pass = 0; pass < 3; ++pass)
+    {
+        // the last pass has too small a budget to keep everything
+        if (pass == 2)
+        {
+            ia.setBlockCache(8192, 4096);
+        }
+
+        Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+        for (std::size_t i = 0; i < numDatas; ++i)
+        {
+            Alembic::Ogawa::IDataPtr data = top->getData(i, 0);
+            std::vector< char > buf(data->getSize());
+            data->read(buf.size(), &(buf.front()), 0, 0);
+            for (std::size_t j = 0; j < buf.size(); ++j)
+            {
+                TESTING_ASSERT(buf[j] == (char)(i * 3 + j));
+            }
+        }
+
+        if (iUseMMap)
+        {
+            TESTING_ASSERT(ia.getBlockCacheHits() == 0);
+            TESTING_ASSERT(ia.getBlockCacheMisses() == 0);
+        }
+        else if (pass == 0)
+        {
+            // about 56 KB of small datas, sizes and the child table
+            TESTING_ASSERT(ia.getBlockCacheMisses() < 20);
+            TESTING_ASSERT(ia.getBlockCacheHits() > numDatas);
+        }
+        else if (pass == 1)
+        {
+            // everything should have stayed in the cache
+            TESTING_ASSERT(ia.getBlockCacheMisses() < 20);
+        }
+    }
+}
+
+void writeBackgroundTestArchive(Alembic::Ogawa::OArchive & oa)
+{
+    Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+    Alembic::Ogawa::ODataPtr first;
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        // mostly small datas with the odd one big enough to skip staging
+        std::vector< char > buf(i % 50 == 25 ? 3 * 1024 * 1024 : i * 7 + 1);
+        for (std::size_t j = 0; j < buf.size(); ++j)
+        {
+            buf[j] = (char)(i + j * 5);
+        }
+
+        if (i % 20 == 0)
+        {
+            Alembic::Ogawa::OGroupPtr child = top->addGroup();
+            child->addData(buf.size(), &(buf.front()));
+            child->addEmptyData();
+        }
+        else
+        {
+            Alembic::Ogawa::ODataPtr data =
+                top->addData(buf.size(), &(buf.front()));
+            if (!first)
+            {
+                first = data;
+            }
+        }
+    }
+
+    // go back and change data which is probably still queued
+    char redo[] = { 'r', 'e', 'd', 'o' };
+    first->rewrite(4, redo);
+}
+
+void readFile(const std::string & iFileName, std::string & oContents)
+{
+    std::ifstream strm(iFileName.c_str(), std::ios_base::binary);
+    std::stringstream ss;
+    ss << strm.rdbuf();
+    oContents = ss.str();
+}
+
+void backgroundWriteTest()
+{
+    {
+        Alembic::Ogawa::OArchive oa("syncWriteTest.ogawa");
+        writeBackgroundTestArchive(oa);
+    }
+
+    {
+        Alembic::Ogawa::OArchive oa("backgroundWriteTest.ogawa",
+                                    Alembic::Ogawa::kBackgroundWrites);
+        TESTING_ASSERT(oa.isValid());
+        writeBackgroundTestArchive(oa);
+    }
+
+    std::stringstream strm;
+    strm << "potato!";
+    {
+        Alembic::Ogawa::OArchive oa(&strm, Alembic::Ogawa::kBackgroundWrites);
+        writeBackgroundTestArchive(oa);
+    }
+
+    // the same bytes in the same places no matter how they were written
+    std::string syncFile, backgroundFile;
+    readFile("syncWriteTest.ogawa", syncFile);
+    readFile("backgroundWriteTest.ogawa", backgroundFile);
+    TESTING_ASSERT(!syncFile.empty());
+    TESTING_ASSERT(syncFile == backgroundFile);
+    TESTING_ASSERT(strm.str() == "potato!" + syncFile);
+
+    Alembic::Ogawa::IArchive ia("backgroundWriteTest.ogawa");
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.isFrozen());
+    TESTING_ASSERT(ia.getGroup()->getNumChildren() == 200);
+    Alembic::Ogawa::IDataPtr data = ia.getGroup()->getData(25, 0);
+    TESTING_ASSERT(data->getSize() == 3 * 1024 * 1024);
+    std::vector< char > buf(data->getSize());
+    data->read(buf.size(), &(buf.front()), 0, 0);
+    for (std::size_t j = 0; j < buf.size(); ++j)
+    {
+        TESTING_ASSERT(buf[j] == (char)(25 + j * 5));
+    }
+}
+
+void copyDataTest(bool iUseMMap)
+{
+    // batchTest.ogawa is written by batchReadTest
+    {
+        Alembic::Ogawa::IArchive ia("batchTest.ogawa", 1, iUseMMap);
+        Alembic::Ogawa::IGroupPtr src = ia.getGroup();
+
+        Alembic::Ogawa::OArchive oa("copyTest.ogawa");
+        Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+        for (std::size_t i = 0; i < src->getNumChildren(); ++i)
+        {
+            Alembic::Ogawa::ODataPtr data =
+                top->addData(src->getData(i, 0), 0);
+            TESTING_ASSERT(data->getSize() == src->getData(i, 0)->getSize());
+        }
+
+        // created data is only added when asked to be
+        Alembic::Ogawa::ODataPtr data = top->createData(src->getData(3, 0), 0);
+        TESTING_ASSERT(top->getNumChildren() == src->getNumChildren());
+        top->addData(data);
+    }
+
+    Alembic::Ogawa::IArchive ia("copyTest.ogawa", 1, iUseMMap);
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    TESTING_ASSERT(top->getNumChildren() == 11);
+    for (std::size_t i = 0; i < 11; ++i)
+    {
+        std::size_t index = i < 10 ? i : 3;
+        Alembic::Ogawa::IDataPtr data = top->getData(i, 0);
+        TESTING_ASSERT(data->getSize() == (index == 5 ? 2 * 1024 * 1024 :
+                                           index + 1));
+        std::vector< char > buf(data->getSize());
+        data->read(buf.size(), &(buf.front()), 0, 0);
+        for (std::size_t j = 0; j < buf.size(); ++j)
+        {
+            TESTING_ASSERT(buf[j] == (char)(index + j));
+        }
+    }
+}
+
+void groupPosTest(bool iUseMMap)
+{
+    Alembic::Util::uint64_t innerPos = 0;
+    Alembic::Util::uint64_t emptyPos = 0;
+    {
+        Alembic::Ogawa::OArchive oa("groupPosTest.ogawa");
+        Alembic::Ogawa::OGroupPtr outer = oa.getGroup()->addGroup();
+        Alembic::Ogawa::OGroupPtr inner = outer->addGroup();
+        char buf[3] = {1, 2, 3};
+        inner->addData(3, buf);
+        inner->addData(1, buf);
+        TESTING_ASSERT(!inner->isFrozen());
+        inner->freeze();
+        innerPos = inner->getPos();
+
+        Alembic::Ogawa::OGroupPtr empty = outer->addGroup();
+        empty->freeze();
+        emptyPos = empty->getPos();
+    }
+
+    // an empty group doesn't get written anywhere
+    TESTING_ASSERT(emptyPos == 0);
+
+    Alembic::Ogawa::IArchive ia("groupPosTest.ogawa", 1, iUseMMap);
+    Alembic::Ogawa::IGroupPtr inner = ia.getGroup(innerPos, false, 0);
+    TESTING_ASSERT(inner);
+    TESTING_ASSERT(inner->getNumChildren() == 2);
+    TESTING_ASSERT(inner->getData(0, 0)->getSize() == 3);
+    TESTING_ASSERT(inner->getData(1, 0)->getSize() == 1);
+
+    // same group as when walking down to it
+    Alembic::Ogawa::IGroupPtr walked =
+        ia.getGroup()->getGroup(0, false, 0)->getGroup(0, false, 0);
+    TESTING_ASSERT(walked->getNumChildren() == 2);
+    TESTING_ASSERT(walked->getData(0, 0)->getPos() ==
+                   inner->getData(0, 0)->getPos());
+
+    // positions that can't be a group
+    TESTING_ASSERT(!ia.getGroup(0, false, 0));
+    TESTING_ASSERT(!ia.getGroup(innerPos | 0x8000000000000000ULL, false, 0));
+    TESTING_ASSERT(!ia.getGroup(1ULL << 40, false, 0));
+}
+
 int main ( int argc, char *argv[] )
 {
     test(true);     // Use mmap
     test(false);    // Use streams
+    directReadTest();
+    batchReadTest(true);
+    batchReadTest(false);
+    copyDataTest(true);
+    copyDataTest(false);
+    blockCacheTest(true);
+    blockCacheTest(false);
+    backgroundWriteTest();
+    groupPosTest(true);
+    groupPosTest(false);
 
     stringStreamTest();
     return 0;
@@ -0,0 +1,192 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// Not run as part of the tests.  Compares how fast each read strategy
+// streams through a big file, and how much of the file each one leaves
+// behind in the file cache.
+//
+// usage: AlembicOgawaReadStrategy_Bench [megabytes] [file]
+
+#include <Alembic/Ogawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+// each data block is a little over 8 MB so none of them line up with pages
+const std::size_t BLOCK_SIZE = 8 * 1024 * 1024 + 17;
+
+void writeFile(const std::string & iFileName, std::size_t iNumBlocks)
+{
+    std::vector< char > block(BLOCK_SIZE);
+    for (std::size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        block[i] = (char)(i % 251);
+    }
+
+    Alembic::Ogawa::OArchive oa(iFileName);
+    Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+    for (std::size_t i = 0; i < iNumBlocks; ++i)
+    {
+        block[0] = (char) i;
+        top->addData(BLOCK_SIZE, &(block.front()));
+    }
+}
+
+#ifndef _WIN32
+// drops what it can of the file from the file cache
+void evictFile(const std::string & iFileName)
+{
+    int fid = open(iFileName.c_str(), O_RDONLY);
+    if (fid < 0)
+    {
+        return;
+    }
+    fdatasync(fid);
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(fid, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    close(fid);
+}
+
+// percent of the file which is in the file cache
+double cachedPercent(const std::string & iFileName)
+{
+    int fid = open(iFileName.c_str(), O_RDONLY);
+    if (fid < 0)
+    {
+        return -1.0;
+    }
+
+    struct stat buf;
+    fstat(fid, &buf);
+    std::size_t len = static_cast< std::size_t >(buf.st_size);
+    void * p = mmap(NULL, len, PROT_READ, MAP_SHARED, fid, 0);
+    close(fid);
+    if (p == MAP_FAILED)
+    {
+        return -1.0;
+    }
+
+    std::size_t pageSize = static_cast< std::size_t >(sysconf(_SC_PAGESIZE));
+    std::size_t numPages = (len + pageSize - 1) / pageSize;
+#ifdef __APPLE__
+    std::vector< char > pages(numPages);
+#else
+    std::vector< unsigned char > pages(numPages);
+#endif
+    std::size_t numCached = 0;
+    if (mincore(p, len, &(pages.front())) == 0)
+    {
+        for (std::size_t i = 0; i < numPages; ++i)
+        {
+            numCached += (pages[i] & 1);
+        }
+    }
+    munmap(p, len);
+    return 100.0 * numCached / numPages;
+}
+#else
+void evictFile(const std::string &) {}
+double cachedPercent(const std::string &) { return -1.0; }
+#endif
+
+void readFile(const std::string & iFileName,
+              Alembic::Ogawa::ReadStrategy iStrategy,
+              const char * iName)
+{
+    evictFile(iFileName);
+
+    std::vector< char > buf(BLOCK_SIZE);
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    Alembic::Ogawa::IArchive ia(iFileName, 1, iStrategy);
+    TESTING_ASSERT(ia.isValid());
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    std::size_t numBytes = 0;
+    for (std::size_t i = 0; i < top->getNumChildren(); ++i)
+    {
+        Alembic::Ogawa::IDataPtr data = top->getData(i, 0);
+        data->read(data->getSize(), &(buf.front()), 0, 0);
+        TESTING_ASSERT(buf[0] == (char) i && buf[BLOCK_SIZE - 1] ==
+                       (char)((BLOCK_SIZE - 1) % 251));
+        numBytes += data->getSize();
+    }
+
+    double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << iName << ": " << numBytes / (seconds * 1024.0 * 1024.0)
+              << " MB/s, " << cachedPercent(iFileName)
+              << "% of the file left in the file cache" << std::endl;
+}
+
+}
+
+int main( int argc, char *argv[] )
+{
+    std::size_t megabytes = 1024;
+    if (argc > 1)
+    {
+        megabytes = strtoul(argv[1], NULL, 10);
+    }
+
+    std::string fileName = "readStrategyBench.ogawa";
+    if (argc > 2)
+    {
+        fileName = argv[2];
+    }
+
+    writeFile(fileName, megabytes / 8 + 1);
+
+    readFile(fileName, Alembic::Ogawa::kFileReads, "file reads");
+    readFile(fileName, Alembic::Ogawa::kMemoryMappedReads,
+             "memory mapped reads");
+    readFile(fileName, Alembic::Ogawa::kDirectReads, "direct reads");
+
+    return 0;
+}
@@ -41,10 +41,12 @@
 #include <Alembic/Util/Digest.h>
 #include <Alembic/Util/Dimensions.h>
 #include <Alembic/Util/Exception.h>
+#include <Alembic/Util/Lz4.h>
 #include <Alembic/Util/Murmur3.h>
 #include <Alembic/Util/Naming.h>
 #include <Alembic/Util/OperatorBool.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <Alembic/Util/ThreadPool.h>
 #include <Alembic/Util/TokenMap.h>
 #include <Alembic/Util/SpookyV2.h>
 
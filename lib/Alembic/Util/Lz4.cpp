@@ -0,0 +1,326 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Lz4.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// the smallest match the format can express
+const std::size_t MIN_MATCH = 4;
+
+// the format requires the last 5 bytes to always be literals, and the
+// last match to start at least 12 bytes before the end of the block
+const std::size_t LAST_LITERALS = 5;
+const std::size_t MATCH_FIND_LIMIT = 12;
+
+// the format stores offsets as 16 bit values
+const std::size_t MAX_DISTANCE = 65535;
+
+const std::size_t HASH_LOG = 14;
+
+//-*****************************************************************************
+inline uint32_t read32( const uint8_t * iPtr )
+{
+    uint32_t ret;
+    memcpy( &ret, iPtr, 4 );
+    return ret;
+}
+
+//-*****************************************************************************
+inline std::size_t hashSequence( uint32_t iSeq )
+{
+    return ( iSeq * 2654435761U ) >> ( 32 - HASH_LOG );
+}
+
+//-*****************************************************************************
+// writes the 255 continuation bytes for lengths of 15 or more
+inline uint8_t * writeLength( uint8_t * oPtr, std::size_t iLen )
+{
+    while ( iLen >= 255 )
+    {
+        *oPtr++ = 255;
+        iLen -= 255;
+    }
+    *oPtr++ = ( uint8_t ) iLen;
+    return oPtr;
+}
+
+//-*****************************************************************************
+// reads the 255 continuation bytes for lengths of 15 or more
+inline bool readLength( const uint8_t *& ioPtr, const uint8_t * iEnd,
+                        std::size_t & ioLen )
+{
+    uint8_t b = 255;
+    while ( b == 255 )
+    {
+        if ( ioPtr >= iEnd )
+        {
+            return false;
+        }
+
+        b = *ioPtr++;
+        ioLen += b;
+    }
+    return true;
+}
+
+//-*****************************************************************************
+// writes a single sequence of literals optionally followed by a match
+// returns NULL if it would not fit
+uint8_t * writeSequence( uint8_t * oPtr, const uint8_t * iEnd,
+                         const uint8_t * iLiterals, std::size_t iNumLiterals,
+                         std::size_t iOffset, std::size_t iMatchLen )
+{
+    std::size_t needed = 1 + iNumLiterals + iNumLiterals / 255 + 1;
+    if ( iMatchLen > 0 )
+    {
+        needed += 2 + ( iMatchLen - MIN_MATCH ) / 255 + 1;
+    }
+
+    if ( needed > ( std::size_t ) ( iEnd - oPtr ) )
+    {
+        return NULL;
+    }
+
+    uint8_t * token = oPtr++;
+
+    if ( iNumLiterals >= 15 )
+    {
+        *token = 15 << 4;
+        oPtr = writeLength( oPtr, iNumLiterals - 15 );
+    }
+    else
+    {
+        *token = ( uint8_t ) ( iNumLiterals << 4 );
+    }
+
+    if ( iNumLiterals > 0 )
+    {
+        memcpy( oPtr, iLiterals, iNumLiterals );
+        oPtr += iNumLiterals;
+    }
+
+    if ( iMatchLen > 0 )
+    {
+        *oPtr++ = ( uint8_t ) ( iOffset & 0xff );
+        *oPtr++ = ( uint8_t ) ( iOffset >> 8 );
+
+        std::size_t matchLen = iMatchLen - MIN_MATCH;
+        if ( matchLen >= 15 )
+        {
+            *token |= 15;
+            oPtr = writeLength( oPtr, matchLen - 15 );
+        }
+        else
+        {
+            *token |= ( uint8_t ) matchLen;
+        }
+    }
+
+    return oPtr;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+std::size_t Lz4CompressBound( std::size_t iSize )
+{
+    return iSize + iSize / 255 + 16;
+}
+
+//-*****************************************************************************
+std::size_t Lz4Compress( const void * iSrc, std::size_t iSize,
+                         void * oDst, std::size_t iDstCapacity )
+{
+    const uint8_t * src = ( const uint8_t * ) iSrc;
+    uint8_t * dst = ( uint8_t * ) oDst;
+    uint8_t * dstEnd = dst + iDstCapacity;
+    uint8_t * op = dst;
+
+    std::size_t anchor = 0;
+
+    if ( iSize > MATCH_FIND_LIMIT )
+    {
+        std::vector< std::size_t > table( ( std::size_t ) 1 << HASH_LOG, 0 );
+
+        const std::size_t matchLimit = iSize - LAST_LITERALS;
+        const std::size_t findLimit = iSize - MATCH_FIND_LIMIT;
+
+        std::size_t ip = 1;
+        table[ hashSequence( read32( src ) ) ] = 0;
+
+        while ( ip < findLimit )
+        {
+            uint32_t seq = read32( src + ip );
+            std::size_t h = hashSequence( seq );
+            std::size_t ref = table[h];
+            table[h] = ip;
+
+            if ( ref >= ip || ip - ref > MAX_DISTANCE ||
+                 read32( src + ref ) != seq )
+            {
+                // skip faster through data which doesn't compress
+                ip += 1 + ( ( ip - anchor ) >> 6 );
+                continue;
+            }
+
+            // extend the match backwards over the pending literals
+            while ( ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1] )
+            {
+                --ip;
+                --ref;
+            }
+
+            std::size_t matchLen = MIN_MATCH;
+            while ( ip + matchLen < matchLimit &&
+                    src[ref + matchLen] == src[ip + matchLen] )
+            {
+                ++matchLen;
+            }
+
+            op = writeSequence( op, dstEnd, src + anchor, ip - anchor,
+                                ip - ref, matchLen );
+            if ( !op )
+            {
+                return 0;
+            }
+
+            ip += matchLen;
+            anchor = ip;
+
+            if ( ip - 2 < findLimit )
+            {
+                table[ hashSequence( read32( src + ip - 2 ) ) ] = ip - 2;
+            }
+        }
+    }
+
+    // the remaining bytes are all literals
+    op = writeSequence( op, dstEnd, src + anchor, iSize - anchor, 0, 0 );
+    if ( !op )
+    {
+        return 0;
+    }
+
+    return op - dst;
+}
+
+//-*****************************************************************************
+bool Lz4Decompress( const void * iSrc, std::size_t iSize,
+                    void * oDst, std::size_t iDstSize )
+{
+    const uint8_t * ip = ( const uint8_t * ) iSrc;
+    const uint8_t * ipEnd = ip + iSize;
+    uint8_t * dst = ( uint8_t * ) oDst;
+    uint8_t * op = dst;
+    uint8_t * opEnd = dst + iDstSize;
+
+    while ( ip < ipEnd )
+    {
+        uint8_t token = *ip++;
+
+        std::size_t numLiterals = token >> 4;
+        if ( numLiterals == 15 && !readLength( ip, ipEnd, numLiterals ) )
+        {
+            return false;
+        }
+
+        if ( numLiterals > ( std::size_t ) ( ipEnd - ip ) ||
+             numLiterals > ( std::size_t ) ( opEnd - op ) )
+        {
+            return false;
+        }
+
+        memcpy( op, ip, numLiterals );
+        ip += numLiterals;
+        op += numLiterals;
+
+        // the last sequence has no match
+        if ( ip == ipEnd )
+        {
+            break;
+        }
+
+        if ( ipEnd - ip < 2 )
+        {
+            return false;
+        }
+
+        std::size_t offset = ip[0] | ( ( std::size_t ) ip[1] << 8 );
+        ip += 2;
+
+        if ( offset == 0 || offset > ( std::size_t ) ( op - dst ) )
+        {
+            return false;
+        }
+
+        std::size_t matchLen = token & 15;
+        if ( matchLen == 15 && !readLength( ip, ipEnd, matchLen ) )
+        {
+            return false;
+        }
+        matchLen += MIN_MATCH;
+
+        if ( matchLen > ( std::size_t ) ( opEnd - op ) )
+        {
+            return false;
+        }
+
+        const uint8_t * match = op - offset;
+        if ( offset >= matchLen )
+        {
+            memcpy( op, match, matchLen );
+            op += matchLen;
+        }
+        else
+        {
+            // overlapping copy, which repeats the last offset bytes
+            for ( std::size_t i = 0; i < matchLen; ++i )
+            {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == opEnd;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,76 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Util_Lz4_h
+#define Alembic_Util_Lz4_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/PlainOldDataType.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// A small, dependency free compressor which produces the LZ4 block format.
+// It trades ratio for speed, making it a good fit for large sample buffers
+// which need to be encoded and decoded at close to memory bandwidth.
+
+//! Returns the worst case compressed size for iSize input bytes.
+ALEMBIC_EXPORT std::size_t Lz4CompressBound( std::size_t iSize );
+
+//! Compresses iSize bytes from iSrc into oDst, which can hold iDstCapacity
+//! bytes.  Returns the number of bytes written to oDst, or 0 if the
+//! compressed result would not fit.
+ALEMBIC_EXPORT std::size_t
+Lz4Compress( const void * iSrc, std::size_t iSize,
+             void * oDst, std::size_t iDstCapacity );
+
+//! Decompresses iSize bytes from iSrc into oDst which must be exactly
+//! iDstSize bytes when decompressed.  Returns false if the compressed
+//! stream is malformed or does not decompress to exactly iDstSize bytes.
+ALEMBIC_EXPORT bool
+Lz4Decompress( const void * iSrc, std::size_t iSize,
+               void * oDst, std::size_t iDstSize );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
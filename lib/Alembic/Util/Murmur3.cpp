@@ -38,6 +38,11 @@
 
 #include <Alembic/Util/Murmur3.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <Alembic/Util/ThreadPool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 #if defined(__APPLE__) || defined(__FreeBSD__)
 #include <machine/endian.h>
@@ -49,98 +54,111 @@ namespace Alembic {
 namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
-//-*****************************************************************************
-void MurmurHash3_x64_128 ( const void * key, const size_t len,
-                           const size_t podSize, void * out )
-{
-    const uint8_t * data = (const uint8_t*)key;
-    const size_t nblocks = len / 16;
+#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
+#define ALEMBIC_MURMUR3_BIG_ENDIAN 1
+#endif
+
+namespace {
 
-    uint64_t h1 = 0;
-    uint64_t h2 = 0;
+#ifdef _MSC_VER
+const uint64_t c1 = 0x87c37b91114253d5LL;
+const uint64_t c2 = 0x4cf5ad432745937fLL;
+#else
+const uint64_t c1 = 0x87c37b91114253d5ULL;
+const uint64_t c2 = 0x4cf5ad432745937fULL;
+#endif
 
+//-*****************************************************************************
+#ifdef ALEMBIC_MURMUR3_BIG_ENDIAN
+inline uint64_t swapPods( uint64_t k, size_t podSize )
+{
+    if (podSize == 8)
+    {
+        k = (k>>56) |
+            ((k<<40) & 0x00FF000000000000ULL) |
+            ((k<<24) & 0x0000FF0000000000ULL) |
+            ((k<<8)  & 0x000000FF00000000ULL) |
+            ((k>>8)  & 0x00000000FF000000ULL) |
+            ((k>>24) & 0x0000000000FF0000ULL) |
+            ((k>>40) & 0x000000000000FF00ULL) |
+            (k<<56);
+    }
+    else if (podSize == 4)
+    {
+        k = ((k<<24) & 0xFF00000000000000ULL) |
+            ((k<<8)  & 0x00FF000000000000ULL) |
+            ((k>>8)  & 0x0000FF0000000000ULL) |
+            ((k>>24) & 0x000000FF00000000ULL) |
+            ((k<<24) & 0x00000000FF000000ULL) |
+            ((k<<8)  & 0x0000000000FF0000ULL) |
+            ((k>>8)  & 0x000000000000FF00ULL) |
+            ((k>>24) & 0x00000000000000FFULL);
+    }
+    else if (podSize == 2)
+    {
+        k = ((k<<8) & 0xFF00000000000000ULL) |
+            ((k>>8) & 0x00FF000000000000ULL) |
+            ((k<<8) & 0x0000FF0000000000ULL) |
+            ((k>>8) & 0x000000FF00000000ULL) |
+            ((k<<8) & 0x00000000FF000000ULL) |
+            ((k>>8) & 0x0000000000FF0000ULL) |
+            ((k<<8) & 0x000000000000FF00ULL) |
+            ((k>>8) & 0x00000000000000FFULL);
+    }
+    return k;
+}
+#endif
 
+//-*****************************************************************************
+inline uint64_t fmix64( uint64_t k )
+{
 #ifdef _MSC_VER
-    uint64_t c1 = 0x87c37b91114253d5LL;
-    uint64_t c2 = 0x4cf5ad432745937fLL;
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdLL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53LL;
+    k ^= k >> 33;
 #else
-    uint64_t c1 = 0x87c37b91114253d5ULL;
-    uint64_t c2 = 0x4cf5ad432745937fULL;
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdLLU;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53LLU;
+    k ^= k >> 33;
 #endif
+    return k;
+}
 
-    //----------
-    // body
+} // End anonymous namespace
 
-    const uint64_t * blocks = (const uint64_t *)(data);
+//-*****************************************************************************
+Murmur3Hash::Murmur3Hash( size_t iPodSize )
+    : m_h1( 0 )
+    , m_h2( 0 )
+    , m_len( 0 )
+    , m_podSize( iPodSize )
+    , m_tailLen( 0 )
+{
+}
 
-    for(size_t i = 0; i < nblocks; i++)
-    {
+//-*****************************************************************************
+void Murmur3Hash::processBlocks( const uint8_t * iData, size_t iNumBlocks )
+{
+    // keep the state in locals so the compiler can hold it in registers
+    uint64_t h1 = m_h1;
+    uint64_t h2 = m_h2;
 
-        uint64_t k1 = blocks[i*2];
-        uint64_t k2 = blocks[i*2+1];
+    for ( size_t i = 0; i < iNumBlocks; ++i, iData += 16 )
+    {
+        uint64_t k1;
+        uint64_t k2;
 
+        // the data isn't necessarily 8 byte aligned
+        memcpy( &k1, iData, 8 );
+        memcpy( &k2, iData + 8, 8 );
 
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-        if (podSize == 8)
-        {
-            k1 = (k1>>56) |
-                ((k1<<40) & 0x00FF000000000000ULL) |
-                ((k1<<24) & 0x0000FF0000000000ULL) |
-                ((k1<<8)  & 0x000000FF00000000ULL) |
-                ((k1>>8)  & 0x00000000FF000000ULL) |
-                ((k1>>24) & 0x0000000000FF0000ULL) |
-                ((k1>>40) & 0x000000000000FF00ULL) |
-                (k1<<56);
-
-            k2 = (k2>>56) |
-                ((k2<<40) & 0x00FF000000000000ULL) |
-                ((k2<<24) & 0x0000FF0000000000ULL) |
-                ((k2<<8)  & 0x000000FF00000000ULL) |
-                ((k2>>8)  & 0x00000000FF000000ULL) |
-                ((k2>>24) & 0x0000000000FF0000ULL) |
-                ((k2>>40) & 0x000000000000FF00ULL) |
-                 (k2<<56);
-        }
-        else if (podSize == 4)
-        {
-            k1 =((k1<<24) & 0xFF00000000000000ULL) |
-                ((k1<<8)  & 0x00FF000000000000ULL) |
-                ((k1>>8)  & 0x0000FF0000000000ULL) |
-                ((k1>>24) & 0x000000FF00000000ULL) |
-                ((k1<<24) & 0x00000000FF000000ULL) |
-                ((k1<<8)  & 0x0000000000FF0000ULL) |
-                ((k1>>8)  & 0x000000000000FF00ULL) |
-                ((k1>>24) & 0x00000000000000FFULL);
-
-            k2 =((k2<<24) & 0xFF00000000000000ULL) |
-                ((k2<<8)  & 0x00FF000000000000ULL) |
-                ((k2>>8)  & 0x0000FF0000000000ULL) |
-                ((k2>>24) & 0x000000FF00000000ULL) |
-                ((k2<<24) & 0x00000000FF000000ULL) |
-                ((k2<<8)  & 0x0000000000FF0000ULL) |
-                ((k2>>8)  & 0x000000000000FF00ULL) |
-                ((k2>>24) & 0x00000000000000FFULL);
-        }
-        else if (podSize == 2)
-        {
-            k1 =((k1<<8) & 0xFF00000000000000ULL) |
-                ((k1>>8) & 0x00FF000000000000ULL) |
-                ((k1<<8) & 0x0000FF0000000000ULL) |
-                ((k1>>8) & 0x000000FF00000000ULL) |
-                ((k1<<8) & 0x00000000FF000000ULL) |
-                ((k1>>8) & 0x0000000000FF0000ULL) |
-                ((k1<<8) & 0x000000000000FF00ULL) |
-                ((k1>>8) & 0x00000000000000FFULL);
-
-            k2 =((k2<<8) & 0xFF00000000000000ULL) |
-                ((k2>>8) & 0x00FF000000000000ULL) |
-                ((k2<<8) & 0x0000FF0000000000ULL) |
-                ((k2>>8) & 0x000000FF00000000ULL) |
-                ((k2<<8) & 0x00000000FF000000ULL) |
-                ((k2>>8) & 0x0000000000FF0000ULL) |
-                ((k2<<8) & 0x000000000000FF00ULL) |
-                ((k2>>8) & 0x00000000000000FFULL);
-        }
+#ifdef ALEMBIC_MURMUR3_BIG_ENDIAN
+        k1 = swapPods( k1, m_podSize );
+        k2 = swapPods( k2, m_podSize );
 #endif
 
         k1 *= c1;
@@ -162,34 +180,73 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         h2 = h2*5+0x38495ab5;
     }
 
-    //----------
-    // tail
+    m_h1 = h1;
+    m_h2 = h2;
+}
 
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-    const uint8_t * unswappedTail = (const uint8_t*)(data + nblocks*16);
+//-*****************************************************************************
+void Murmur3Hash::update( const void * iData, size_t iLen )
+{
+    const uint8_t * data = (const uint8_t *) iData;
+    m_len += iLen;
+
+    // finish off a block started by an earlier update
+    if ( m_tailLen > 0 )
+    {
+        size_t numCopy = std::min( iLen, 16 - m_tailLen );
+        memcpy( m_tail + m_tailLen, data, numCopy );
+        m_tailLen += numCopy;
+        data += numCopy;
+        iLen -= numCopy;
+
+        if ( m_tailLen < 16 )
+        {
+            return;
+        }
+
+        processBlocks( m_tail, 1 );
+        m_tailLen = 0;
+    }
+
+    size_t nblocks = iLen / 16;
+    processBlocks( data, nblocks );
+
+    m_tailLen = iLen & 15;
+    if ( m_tailLen > 0 )
+    {
+        memcpy( m_tail, data + nblocks * 16, m_tailLen );
+    }
+}
+
+//-*****************************************************************************
+void Murmur3Hash::final( void * oOut ) const
+{
+    uint64_t h1 = m_h1;
+    uint64_t h2 = m_h2;
+
+#ifdef ALEMBIC_MURMUR3_BIG_ENDIAN
     uint8_t tail[16];
-    size_t tailSize = len & 15;
 
     // no swapping needed
-    if (podSize == 1)
+    if (m_podSize == 1)
     {
-        memcpy(tail, unswappedTail, tailSize);
+        memcpy(tail, m_tail, m_tailLen);
     }
     else
     {
-        for (size_t j = 0; j < tailSize; ++j)
+        for (size_t j = 0; j < m_tailLen; ++j)
         {
-            tail[j] = unswappedTail[j^(podSize-1)];
+            tail[j] = m_tail[j^(m_podSize-1)];
         }
     }
 #else
-    const uint8_t * tail = (const uint8_t*)(data + nblocks*16);
+    const uint8_t * tail = m_tail;
 #endif
 
     uint64_t k1 = 0;
     uint64_t k2 = 0;
 
-    switch(len & 15)
+    switch(m_tailLen)
     {
         case 15: k2 ^= uint64_t(tail[14]) << 48; //fallthrough
         case 14: k2 ^= uint64_t(tail[13]) << 40; //fallthrough
@@ -225,42 +282,61 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
     //----------
     // finalization
 
-    h1 ^= len;
-    h2 ^= len;
+    h1 ^= m_len;
+    h2 ^= m_len;
 
     h1 += h2;
     h2 += h1;
 
-#ifdef _MSC_VER
-    h1 ^= h1 >> 33;
-    h1 *= 0xff51afd7ed558ccdLL;
-    h1 ^= h1 >> 33;
-    h1 *= 0xc4ceb9fe1a85ec53LL;
-    h1 ^= h1 >> 33;
-
-    h2 ^= h2 >> 33;
-    h2 *= 0xff51afd7ed558ccdLL;
-    h2 ^= h2 >> 33;
-    h2 *= 0xc4ceb9fe1a85ec53LL;
-    h2 ^= h2 >> 33;
-#else
-    h1 ^= h1 >> 33;
-    h1 *= 0xff51afd7ed558ccdLLU;
-    h1 ^= h1 >> 33;
-    h1 *= 0xc4ceb9fe1a85ec53LLU;
-    h1 ^= h1 >> 33;
-
-    h2 ^= h2 >> 33;
-    h2 *= 0xff51afd7ed558ccdLLU;
-    h2 ^= h2 >> 33;
-    h2 *= 0xc4ceb9fe1a85ec53LLU;
-    h2 ^= h2 >> 33;
-#endif
+    h1 = fmix64( h1 );
+    h2 = fmix64( h2 );
+
     h1 += h2;
     h2 += h1;
 
-    ((uint64_t*)out)[0] = h1;
-    ((uint64_t*)out)[1] = h2;
+    ((uint64_t*)oOut)[0] = h1;
+    ((uint64_t*)oOut)[1] = h2;
+}
+
+//-*****************************************************************************
+void MurmurHash3_x64_128 ( const void * key, const size_t len,
+                           const size_t podSize, void * out )
+{
+    Murmur3Hash hash( podSize );
+    hash.update( key, len );
+    hash.final( out );
+}
+
+//-*****************************************************************************
+void ChunkedMurmurHash3_x64_128 ( const void * key, const size_t len,
+                                  const size_t podSize, void * out )
+{
+    if ( len <= MURMUR3_CHUNK_SIZE )
+    {
+        MurmurHash3_x64_128( key, len, podSize, out );
+        return;
+    }
+
+    const uint8_t * data = (const uint8_t *) key;
+    size_t numChunks = ( len + MURMUR3_CHUNK_SIZE - 1 ) / MURMUR3_CHUNK_SIZE;
+    std::vector< uint64_t > digests( numChunks * 2 );
+
+    ThreadPool::global().parallelFor( numChunks,
+        [data, len, podSize, &digests]( size_t i )
+        {
+            size_t offset = i * MURMUR3_CHUNK_SIZE;
+            size_t chunkLen = std::min( MURMUR3_CHUNK_SIZE, len - offset );
+            MurmurHash3_x64_128( data + offset, chunkLen, podSize,
+                                 &digests[i * 2] );
+        } );
+
+    // the chunk digests are hashed as 64 bit words, followed by the total
+    // length so that the digest depends on where the chunks end
+    uint64_t totalLen = len;
+    Murmur3Hash hash( sizeof( uint64_t ) );
+    hash.update( &digests.front(), digests.size() * sizeof( uint64_t ) );
+    hash.update( &totalLen, sizeof( uint64_t ) );
+    hash.final( out );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -50,6 +50,52 @@ ALEMBIC_EXPORT void
 MurmurHash3_x64_128 ( const void * key, const size_t len,
                       const size_t podSize, void * out );
 
+//-*****************************************************************************
+//! Incremental form of MurmurHash3_x64_128.  Feeding the same bytes through
+//! any number of update calls produces the same 128 bit digest as a single
+//! MurmurHash3_x64_128 call over the concatenated bytes, which lets callers
+//! hash data that isn't contiguous in memory without copying it first.
+//! podSize is the size of the elements being hashed, and is used to keep the
+//! digest the same on big endian platforms, so updates should not split
+//! elements between calls.
+class ALEMBIC_EXPORT Murmur3Hash
+{
+public:
+    explicit Murmur3Hash( size_t iPodSize = 1 );
+
+    void update( const void * iData, size_t iLen );
+
+    //! Writes the 16 byte digest of everything passed to update so far.
+    void final( void * oOut ) const;
+
+private:
+    void processBlocks( const uint8_t * iData, size_t iNumBlocks );
+
+    uint64_t m_h1;
+    uint64_t m_h2;
+    uint64_t m_len;
+    size_t m_podSize;
+    size_t m_tailLen;
+    uint8_t m_tail[16];
+};
+
+//-*****************************************************************************
+//! Data larger than this is split into chunks of this size by
+//! ChunkedMurmurHash3_x64_128.
+static const size_t MURMUR3_CHUNK_SIZE = 1024 * 1024;
+
+//-*****************************************************************************
+//! Tree hash built on MurmurHash3_x64_128.  Data no larger than
+//! MURMUR3_CHUNK_SIZE gets exactly the same digest as MurmurHash3_x64_128.
+//! Larger data is split into MURMUR3_CHUNK_SIZE chunks which are hashed in
+//! parallel on the global ThreadPool, and the digest is the
+//! MurmurHash3_x64_128 of the chunk digests followed by the total length.
+//! The calling thread hashes chunks too, so this is safe to call from a
+//! ThreadPool task.
+ALEMBIC_EXPORT void
+ChunkedMurmurHash3_x64_128 ( const void * key, const size_t len,
+                             const size_t podSize, void * out );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
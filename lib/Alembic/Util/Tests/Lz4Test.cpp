@@ -0,0 +1,120 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Lz4.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void roundTrip( const std::vector< uint8_t > & iData )
+{
+    std::vector< uint8_t > compressed( Lz4CompressBound( iData.size() ) );
+    std::size_t compressedSize = Lz4Compress( iData.data(), iData.size(),
+        compressed.data(), compressed.size() );
+    assert( compressedSize > 0 );
+
+    std::vector< uint8_t > decompressed( iData.size() );
+    assert( Lz4Decompress( compressed.data(), compressedSize,
+                           decompressed.data(), decompressed.size() ) );
+    assert( decompressed == iData );
+
+    // the wrong expected size is an error
+    std::vector< uint8_t > tooBig( iData.size() + 1 );
+    assert( !Lz4Decompress( compressed.data(), compressedSize,
+                            tooBig.data(), tooBig.size() ) );
+
+    // as is running out of compressed data
+    if ( compressedSize > 1 && !iData.empty() )
+    {
+        assert( !Lz4Decompress( compressed.data(), compressedSize - 1,
+                                decompressed.data(), decompressed.size() ) );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char* argv[] )
+{
+    roundTrip( std::vector< uint8_t >() );
+    roundTrip( std::vector< uint8_t >( 1, 42 ) );
+    roundTrip( std::vector< uint8_t >( 13, 7 ) );
+
+    // very repetitive data should compress well
+    std::vector< uint8_t > zeros( 1000000, 0 );
+    roundTrip( zeros );
+    std::vector< uint8_t > compressed( Lz4CompressBound( zeros.size() ) );
+    assert( Lz4Compress( zeros.data(), zeros.size(), compressed.data(),
+                         compressed.size() ) < zeros.size() / 100 );
+
+    // but it shouldn't fit into a buffer which is too small
+    assert( Lz4Compress( zeros.data(), zeros.size(), compressed.data(),
+                         10 ) == 0 );
+
+    // a ramp of floats, with short repeats
+    std::vector< uint8_t > floats( 400000 );
+    for ( std::size_t i = 0; i < floats.size() / 4; ++i )
+    {
+        float32_t f = ( float32_t )( i % 1000 ) * 0.25f;
+        memcpy( &floats[i * 4], &f, 4 );
+    }
+    roundTrip( floats );
+
+    // noise which can't compress
+    std::vector< uint8_t > noise( 100000 );
+    uint32_t seed = 12345;
+    for ( std::size_t i = 0; i < noise.size(); ++i )
+    {
+        seed = seed * 1664525 + 1013904223;
+        noise[i] = ( uint8_t )( seed >> 24 );
+    }
+    roundTrip( noise );
+
+    // a match referring to before the start of the output is malformed
+    uint8_t badOffset[] = { 0x14, 'a', 0x05, 0x00, 0x10, 'b' };
+    std::vector< uint8_t > out( 10 );
+    assert( !Lz4Decompress( badOffset, sizeof( badOffset ), out.data(),
+                            out.size() ) );
+
+    // as are literals which run beyond the compressed data
+    uint8_t badLiterals[] = { 0xf0, 0xff, 0xff };
+    assert( !Lz4Decompress( badLiterals, sizeof( badLiterals ), out.data(),
+                            out.size() ) );
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,210 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Murmur3.h>
+#include <Alembic/Util/ThreadPool.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+struct Digest128
+{
+    uint64_t words[2];
+
+    bool operator==( const Digest128 & iRhs ) const
+    {
+        return words[0] == iRhs.words[0] && words[1] == iRhs.words[1];
+    }
+};
+
+//-*****************************************************************************
+Digest128 plainHash( const std::vector< uint8_t > & iData, size_t iLen,
+                     size_t iPodSize = 1 )
+{
+    Digest128 d;
+    MurmurHash3_x64_128( iData.data(), iLen, iPodSize, d.words );
+    return d;
+}
+
+//-*****************************************************************************
+Digest128 chunkedHash( const std::vector< uint8_t > & iData,
+                       size_t iPodSize = 1 )
+{
+    Digest128 d;
+    ChunkedMurmurHash3_x64_128( iData.data(), iData.size(), iPodSize,
+                                d.words );
+    return d;
+}
+
+//-*****************************************************************************
+void testKnownDigests()
+{
+    std::vector< uint8_t > data( 100 );
+    for ( size_t i = 0; i < data.size(); ++i )
+    {
+        data[i] = uint8_t( i * 7 + 3 );
+    }
+
+    // digests from before the incremental hasher, these must never change
+    // since they are stored in and compared across archives
+    struct { size_t len; uint64_t h1; uint64_t h2; } known[] = {
+        {   0, 0x0000000000000000ULL, 0x0000000000000000ULL },
+        {   1, 0x726ac6dd306a3e59ULL, 0x4e711127c5b5a8e4ULL },
+        {  15, 0xba6a4b5e80ade4f4ULL, 0xe00e5a8ff7e8f26dULL },
+        {  16, 0xc4b099c52f8f4ea1ULL, 0x7d670219d92afe48ULL },
+        {  17, 0xd4ae4b39fe53b127ULL, 0x6602453b6681dbe9ULL },
+        { 100, 0x176a52a2b675a4d3ULL, 0xa2ac0b70381c282aULL } };
+
+    for ( size_t i = 0; i < sizeof( known ) / sizeof( known[0] ); ++i )
+    {
+        Digest128 d = plainHash( data, known[i].len );
+        assert( d.words[0] == known[i].h1 );
+        assert( d.words[1] == known[i].h2 );
+    }
+}
+
+//-*****************************************************************************
+void testIncremental()
+{
+    std::vector< uint8_t > data( 1000 );
+    for ( size_t i = 0; i < data.size(); ++i )
+    {
+        data[i] = uint8_t( ( i * 2654435761u ) >> 13 );
+    }
+
+    // every split of the data must give the one shot digest
+    const size_t splits[] = { 1, 3, 7, 15, 16, 17, 33, 100, 999, 1000 };
+    for ( size_t s = 0; s < sizeof( splits ) / sizeof( splits[0] ); ++s )
+    {
+        Murmur3Hash hash;
+        for ( size_t pos = 0; pos < data.size(); pos += splits[s] )
+        {
+            size_t len = std::min( splits[s], data.size() - pos );
+            hash.update( &data[pos], len );
+        }
+
+        Digest128 d;
+        hash.final( d.words );
+        assert( d == plainHash( data, data.size() ) );
+    }
+
+    // empty updates change nothing
+    Murmur3Hash hash;
+    hash.update( NULL, 0 );
+    hash.update( data.data(), 20 );
+    hash.update( NULL, 0 );
+    Digest128 d;
+    hash.final( d.words );
+    assert( d == plainHash( data, 20 ) );
+}
+
+//-*****************************************************************************
+void testChunked()
+{
+    // small data gets the plain digest
+    std::vector< uint8_t > data( MURMUR3_CHUNK_SIZE );
+    for ( size_t i = 0; i < data.size(); ++i )
+    {
+        data[i] = uint8_t( i ^ ( i >> 8 ) );
+    }
+    assert( chunkedHash( data ) == plainHash( data, data.size() ) );
+    assert( chunkedHash( data, 4 ) == plainHash( data, data.size(), 4 ) );
+
+    // larger data is a tree hash which must not depend on the threading
+    data.resize( MURMUR3_CHUNK_SIZE * 5 + 12 );
+    for ( size_t i = 0; i < data.size(); ++i )
+    {
+        data[i] = uint8_t( i ^ ( i >> 8 ) );
+    }
+
+    Digest128 d = chunkedHash( data, 4 );
+    assert( !( d == plainHash( data, data.size(), 4 ) ) );
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        assert( chunkedHash( data, 4 ) == d );
+    }
+
+    // changes in any chunk, or to the length, change the digest
+    data[ MURMUR3_CHUNK_SIZE * 2 + 5 ] ^= 1;
+    assert( !( chunkedHash( data, 4 ) == d ) );
+    data[ MURMUR3_CHUNK_SIZE * 2 + 5 ] ^= 1;
+    data.back() ^= 1;
+    assert( !( chunkedHash( data, 4 ) == d ) );
+    data.back() ^= 1;
+    data.push_back( 0 );
+    assert( !( chunkedHash( data, 4 ) == d ) );
+    data.pop_back();
+
+    // hashing from inside a ThreadPool task must not wait on the pool
+    std::mutex lock;
+    std::condition_variable cond;
+    size_t numDone = 0;
+    const size_t numTasks = ThreadPool::global().getNumThreads() + 2;
+    std::vector< Digest128 > digests( numTasks );
+    for ( size_t i = 0; i < numTasks; ++i )
+    {
+        ThreadPool::global().push( [&, i]()
+        {
+            digests[i] = chunkedHash( data, 4 );
+            std::lock_guard< std::mutex > l( lock );
+            ++numDone;
+            cond.notify_all();
+        } );
+    }
+
+    std::unique_lock< std::mutex > l( lock );
+    cond.wait( l, [&]() { return numDone == numTasks; } );
+    for ( size_t i = 0; i < numTasks; ++i )
+    {
+        assert( digests[i] == d );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testKnownDigests();
+    testIncremental();
+    testChunked();
+    return 0;
+}
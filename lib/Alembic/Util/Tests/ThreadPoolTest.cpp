@@ -0,0 +1,100 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/ThreadPool.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <assert.h>
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void testParallelFor()
+{
+    ThreadPool & pool = ThreadPool::global();
+
+    // nothing to do, and only one thing to do
+    pool.parallelFor( 0, []( size_t ) { assert( false ); } );
+    size_t only = 1;
+    pool.parallelFor( 1, [&only]( size_t i ) { only = i; } );
+    assert( only == 0 );
+
+    // every index exactly once
+    std::vector< std::atomic< int > > counts( 1000 );
+    pool.parallelFor( counts.size(), [&counts]( size_t i ) { ++counts[i]; } );
+    for ( size_t i = 0; i < counts.size(); ++i )
+    {
+        assert( counts[i] == 1 );
+    }
+
+    // from inside the pool's own tasks, more of them than there are threads
+    std::atomic< size_t > total( 0 );
+    pool.parallelFor( pool.getNumThreads() + 2, [&pool, &total]( size_t )
+    {
+        pool.parallelFor( 100, [&total]( size_t i ) { total += i; } );
+    } );
+    assert( total == ( pool.getNumThreads() + 2 ) * 4950 );
+
+    // the first error comes back once everything else is done
+    std::atomic< size_t > numRun( 0 );
+    bool caught = false;
+    try
+    {
+        pool.parallelFor( 100, [&numRun]( size_t i )
+        {
+            ++numRun;
+            if ( i % 10 == 3 )
+            {
+                throw std::runtime_error( "oops" );
+            }
+        } );
+    }
+    catch ( std::runtime_error & )
+    {
+        caught = true;
+    }
+    assert( caught );
+    assert( numRun == 100 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testParallelFor();
+    return 0;
+}
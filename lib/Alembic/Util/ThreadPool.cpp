@@ -0,0 +1,211 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+#include <Alembic/Util/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ThreadPool::ThreadPool( std::size_t iNumThreads )
+    : m_stop( false )
+{
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = 1;
+    }
+
+    for ( std::size_t i = 0; i < iNumThreads; ++i )
+    {
+        m_threads.push_back( std::thread( &ThreadPool::run, this ) );
+    }
+}
+
+//-*****************************************************************************
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard< std::mutex > l( m_lock );
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for ( std::size_t i = 0; i < m_threads.size(); ++i )
+    {
+        m_threads[i].join();
+    }
+}
+
+//-*****************************************************************************
+void ThreadPool::push( const Task & iTask )
+{
+    {
+        std::lock_guard< std::mutex > l( m_lock );
+        m_tasks.push_back( iTask );
+    }
+    m_wake.notify_one();
+}
+
+//-*****************************************************************************
+namespace {
+
+// shared by everyone working on a parallelFor, helpers which only get to run
+// after it has returned find nothing left to do
+struct ParallelForState
+{
+    std::function< void ( std::size_t ) > task;
+    std::size_t numTasks;
+
+    std::atomic< std::size_t > nextTask;
+    std::atomic< std::size_t > numDone;
+    std::mutex doneLock;
+    std::condition_variable doneCond;
+    std::exception_ptr error;
+
+    void work()
+    {
+        std::size_t numWorked = 0;
+        for ( std::size_t i = nextTask++; i < numTasks; i = nextTask++ )
+        {
+            try
+            {
+                task( i );
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > l( doneLock );
+                if ( !error )
+                {
+                    error = std::current_exception();
+                }
+            }
+            ++numWorked;
+        }
+
+        if ( numWorked > 0 && ( numDone += numWorked ) == numTasks )
+        {
+            std::lock_guard< std::mutex > l( doneLock );
+            doneCond.notify_all();
+        }
+    }
+};
+
+}
+
+//-*****************************************************************************
+void ThreadPool::parallelFor( std::size_t iNumTasks,
+                              const std::function< void ( std::size_t ) > &
+                              iTask )
+{
+    if ( iNumTasks == 0 )
+    {
+        return;
+    }
+
+    if ( iNumTasks == 1 )
+    {
+        iTask( 0 );
+        return;
+    }
+
+    std::shared_ptr< ParallelForState > state( new ParallelForState );
+    state->task = iTask;
+    state->numTasks = iNumTasks;
+    state->nextTask = 0;
+    state->numDone = 0;
+
+    std::size_t numHelpers = std::min( getNumThreads(), iNumTasks - 1 );
+    for ( std::size_t i = 0; i < numHelpers; ++i )
+    {
+        push( [state]() { state->work(); } );
+    }
+
+    state->work();
+
+    std::unique_lock< std::mutex > l( state->doneLock );
+    state->doneCond.wait( l, [&state]()
+        { return state->numDone == state->numTasks; } );
+
+    if ( state->error )
+    {
+        std::rethrow_exception( state->error );
+    }
+}
+
+//-*****************************************************************************
+void ThreadPool::run()
+{
+    for ( ;; )
+    {
+        Task task;
+        {
+            std::unique_lock< std::mutex > l( m_lock );
+            while ( !m_stop && m_tasks.empty() )
+            {
+                m_wake.wait( l );
+            }
+
+            if ( m_tasks.empty() )
+            {
+                return;
+            }
+
+            task = m_tasks.front();
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+//-*****************************************************************************
+ThreadPool & ThreadPool::global()
+{
+    // never destroyed, so tasks can still be running while the process
+    // shuts down without anything being joined out from under them
+    static ThreadPool * pool = new ThreadPool(
+        std::thread::hardware_concurrency() < 4 ?
+        4 : std::thread::hardware_concurrency() );
+    return *pool;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,99 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+#ifndef Alembic_Util_ThreadPool_h
+#define Alembic_Util_ThreadPool_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A fixed number of worker threads which run tasks in the order they were
+//! pushed.  Tasks shouldn't throw, anything they need to report back has to
+//! go through whatever they were given.
+class ALEMBIC_EXPORT ThreadPool : noncopyable
+{
+public:
+    typedef std::function< void () > Task;
+
+    explicit ThreadPool( std::size_t iNumThreads );
+
+    //! Runs whatever tasks are still queued, then joins the threads.
+    //! It must not be destroyed by one of its own tasks.
+    ~ThreadPool();
+
+    void push( const Task & iTask );
+
+    std::size_t getNumThreads() const { return m_threads.size(); }
+
+    //! Calls iTask with every index from 0 to iNumTasks - 1, spread over the
+    //! pool's threads and the calling thread, and returns once they have all
+    //! finished.  Unlike push, the tasks may throw, the first exception is
+    //! rethrown here after the rest have finished.
+    //! It is safe to call from one of the pool's own tasks.
+    void parallelFor( std::size_t iNumTasks,
+                      const std::function< void ( std::size_t ) > & iTask );
+
+    //! A pool which lives for as long as the process does, with at least 4
+    //! threads since its tasks are usually waiting on I/O.
+    static ThreadPool & global();
+
+private:
+    void run();
+
+    std::vector< std::thread > m_threads;
+    std::deque< Task > m_tasks;
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    bool m_stop;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -840,7 +840,10 @@ bool AbcWriteJob::eval(double iFrame)
 #ifdef ALEMBIC_WITH_HDF5
         if (mAsOgawa)
         {
-            mRoot = CreateArchiveWithInfo(Alembic::AbcCoreOgawa::WriteArchive(),
+            // overlap writing the file with evaluating the next frame
+            mRoot = CreateArchiveWithInfo(
+                Alembic::AbcCoreOgawa::WriteArchive(
+                    Alembic::Ogawa::kBackgroundWrites),
                 mFileName, fps, appWriter, userInfo,
                 Alembic::Abc::ErrorHandler::kThrowPolicy);
         }
@@ -852,7 +855,9 @@ bool AbcWriteJob::eval(double iFrame)
         }
 #else
         // just write it out as Ogawa
-        mRoot = CreateArchiveWithInfo(Alembic::AbcCoreOgawa::WriteArchive(),
+        mRoot = CreateArchiveWithInfo(
+            Alembic::AbcCoreOgawa::WriteArchive(
+                Alembic::Ogawa::kBackgroundWrites),
             mFileName, fps, appWriter, userInfo,
             Alembic::Abc::ErrorHandler::kThrowPolicy);
 #endif
@@ -100,12 +100,14 @@ void register_coreabstracttypes()
               &AbcA::MetaData::get,
               ( arg( "key" ) ),
               "Return the value of the given key or an empty string if it is "
-              "not set")
+              "not set",
+              return_value_policy<copy_const_reference>() )
         .def( "getRequired",
               &AbcA::MetaData::getRequired,
               ( arg( "key" ) ),
               "Return the value of the given key and throws an exception if "
-              "it is not found" )
+              "it is not found",
+              return_value_policy<copy_const_reference>() )
         .def( "append",
               &AbcA::MetaData::append,
               ( arg( "metaData" ) ),